@@ -50,6 +50,7 @@ help:
 	@echo "   Commands:"
 	@echo "       $(ANSI_YELLOW)help$(ANSI_RESET): show this page"
 	@echo "       $(ANSI_YELLOW)release$(ANSI_RESET): make project to release"
+	@echo "       $(ANSI_YELLOW)bench$(ANSI_RESET): build and run the benchmarks (BENCH_ARGS=\"--benchmark_filter=<regex> ...\")"
 	@echo ""
 
 # clean할 때 target이 삭제될 수 있도록 함
@@ -68,6 +69,13 @@ build_target_list: $(BUILD_TARGET_LIST)
 	@$(TARGET_COUNTER)
 	@echo $(CURRENT_PROGRESS)"$(CONFIG_COMPLETE_COLOR)Completed.$(ANSI_RESET)"$(INCREASE_COUNT)
 
+# Results are written to bin/RELEASE/benchmark_results.json in the format of Google Benchmark
+.PHONY: bench
+bench: directories_to_prepare $(BENCHMARK_TARGET_WITH_PATH)
+	@$(TARGET_COUNTER)
+	@echo $(CURRENT_PROGRESS)"$(CONFIG_BUILDING_COLOR)Running benchmarks$(ANSI_RESET)..."$(INCREASE_COUNT)
+	@$(BENCHMARK_TARGET_WITH_PATH) --benchmark_out=$(BUILD_OUTPUT_DIRECTORY)/benchmark_results.json $(BENCH_ARGS)
+
 .PHONY: directories_to_prepare
 directories_to_prepare:
 	@$(TARGET_COUNTER)
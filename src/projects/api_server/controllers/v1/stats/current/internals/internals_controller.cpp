@@ -18,6 +18,10 @@ namespace api
 			{
 				RegisterGet(R"()", &InternalsController::OnGetInternals);
 				RegisterGet(R"(\/queues)", &InternalsController::OnGetQueues);
+				RegisterGet(R"(\/memorypool)", &InternalsController::OnGetMemoryPool);
+				RegisterGet(R"(\/chunklistcache)", &InternalsController::OnGetChunklistCache);
+				RegisterGet(R"(\/log)", &InternalsController::OnGetLog);
+				RegisterGet(R"(\/ktls)", &InternalsController::OnGetKtls);
 			};
 
 			ApiResponse InternalsController::OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client)
@@ -25,6 +29,10 @@ namespace api
 				Json::Value response(Json::ValueType::arrayValue);
 
 				response.append("/v1/stats/current/internals/queues");
+				response.append("/v1/stats/current/internals/memorypool");
+				response.append("/v1/stats/current/internals/chunklistcache");
+				response.append("/v1/stats/current/internals/log");
+				response.append("/v1/stats/current/internals/ktls");
 
 				return response;
 			}
@@ -47,6 +55,26 @@ namespace api
 
 				return response;
 			}
+
+			ApiResponse InternalsController::OnGetMemoryPool(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				return serdes::JsonFromMemoryPoolStats(MonitorInstance->GetServerMetrics()->GetMemoryPoolStats());
+			}
+
+			ApiResponse InternalsController::OnGetChunklistCache(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				return serdes::JsonFromChunklistCacheStats(MonitorInstance->GetServerMetrics()->GetChunklistCacheStats());
+			}
+
+			ApiResponse InternalsController::OnGetLog(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				return serdes::JsonFromLogStats(MonitorInstance->GetServerMetrics()->GetLogStats());
+			}
+
+			ApiResponse InternalsController::OnGetKtls(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				return serdes::JsonFromKtlsStats(MonitorInstance->GetServerMetrics()->GetKtlsStats());
+			}
 		}  // namespace stats
 	}  // namespace v1
 }  // namespace api
\ No newline at end of file
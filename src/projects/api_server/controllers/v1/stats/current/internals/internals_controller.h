@@ -24,6 +24,10 @@ namespace api
 			protected:
 				ApiResponse OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client);
 				ApiResponse OnGetQueues(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetMemoryPool(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetChunklistCache(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetLog(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetKtls(const std::shared_ptr<http::svr::HttpExchange> &client);
 			};
 		}  // namespace stats
 	}  // namespace v1
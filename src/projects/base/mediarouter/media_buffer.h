@@ -61,7 +61,7 @@ public:
 				int64_t pts, int64_t dts, int64_t duration, MediaPacketFlag flag, cmn::BitstreamFormat bitstream_format, cmn::PacketType packet_type)
 		: MediaPacket(msid, media_type, track_id, nullptr, pts, dts, duration, flag, bitstream_format, packet_type)
 	{
-		_data = std::make_shared<ov::Data>(data, data_size);
+		_data = ov::MakePooledShared<ov::Data>(data, data_size);
 	}
 
 	virtual ~MediaPacket() = default;
@@ -213,7 +213,7 @@ public:
 
 	std::shared_ptr<MediaPacket> ClonePacket() const
 	{
-		auto packet = std::make_shared<MediaPacket>(
+		auto packet = ov::MakePooledShared<MediaPacket>(
 			GetMsid(),
 			GetMediaType(),
 			GetTrackId(),
@@ -0,0 +1,249 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include "media_buffer.h"
+
+// Default number of frames kept by MediaFrameRing of an outbound stream (<Modules><FrameRing><Capacity>)
+#define MEDIA_FRAME_RING_DEFAULT_CAPACITY 1024
+
+// Frames of an outbound stream shared by all publishers
+//
+// MediaRouteStream pushes each frame once, and every publisher reads the frames with its own cursor
+// (the sequence number of the next frame to read) instead of keeping a reference in its own queue.
+// Frames that all cursors have passed are released when the next frame is pushed, and at most <capacity> frames
+// are kept, so the memory used by a stream is bounded no matter how many publishers there are. A reader whose cursor
+// falls behind the oldest frame is lagging, and the video/audio frames that have been overwritten are skipped.
+// Data frames (OVEN_EVENT, ID3, subtitles, ...) are also kept outside of the slots until every reader has passed them,
+// so a lagging reader does not skip them either. At most <capacity> data frames are kept in the same way: once a reader
+// stalls for that many of them, the oldest one is dropped and the reader skips it like an overwritten frame.
+//
+// Frames in the ring are shared by the publishers and must not be modified.
+class MediaFrameRing
+{
+public:
+	enum class ReadResult : uint8_t
+	{
+		// Frames are read (or there was nothing to read)
+		Ok,
+		// Some video/audio frames were overwritten before they are read. The remaining frames are read
+		Lagging
+	};
+
+	// Position of a reader, the frames before it are released once every other reader has passed them too
+	class Cursor
+	{
+	public:
+		explicit Cursor(uint64_t sequence)
+			: _sequence(sequence)
+		{
+		}
+
+		// Sequence number of the next frame to read
+		uint64_t GetSequence() const
+		{
+			return _sequence.load(std::memory_order_acquire);
+		}
+
+	private:
+		friend class MediaFrameRing;
+
+		std::atomic<uint64_t> _sequence;
+	};
+
+	explicit MediaFrameRing(size_t capacity = MEDIA_FRAME_RING_DEFAULT_CAPACITY)
+		: _slots(std::max<size_t>(capacity, 1))
+	{
+	}
+
+	size_t GetCapacity() const
+	{
+		return _slots.size();
+	}
+
+	// Returns a cursor that starts from the latest frame, the ring keeps the frames until the cursor passes them
+	// (or they are overwritten). The cursor is unregistered when it is released.
+	std::shared_ptr<Cursor> CreateCursor()
+	{
+		std::unique_lock lock(_mutex);
+
+		auto cursor = std::make_shared<Cursor>((_next_sequence > 0) ? (_next_sequence - 1) : 0);
+		_cursors.push_back(cursor);
+
+		return cursor;
+	}
+
+	// Returns the sequence number of the frame (Only one thread can push frames)
+	uint64_t Push(const std::shared_ptr<MediaPacket> &packet)
+	{
+		std::unique_lock lock(_mutex);
+
+		auto sequence = _next_sequence;
+
+		_slots[sequence % _slots.size()] = packet;
+		_next_sequence = sequence + 1;
+
+		if (IsDataFrame(packet))
+		{
+			_data_frames.emplace_back(sequence, packet);
+
+			// Only the oldest data frame can be behind a stalled reader
+			if (_data_frames.size() > _slots.size())
+			{
+				_data_frames.pop_front();
+			}
+		}
+
+		ReleaseReadFrames();
+
+		return sequence;
+	}
+
+	// Sequence number of the frame that will be pushed next
+	uint64_t GetNextSequence() const
+	{
+		std::shared_lock lock(_mutex);
+		return _next_sequence;
+	}
+
+	// Reads up to <max_count> frames starting from the cursor, and advances the cursor (Only one thread can read with a cursor)
+	//
+	// If the frame at the cursor has already been overwritten, the data frames kept among the overwritten frames are read first,
+	// the cursor moves to the oldest frame in the ring, the number of skipped frames is stored in *lagged_count,
+	// and ReadResult::Lagging is returned.
+	ReadResult Read(Cursor &cursor, std::vector<std::shared_ptr<MediaPacket>> &frames, size_t max_count, uint64_t *lagged_count = nullptr) const
+	{
+		std::shared_lock lock(_mutex);
+
+		auto result = ReadResult::Ok;
+		auto oldest_sequence = (_next_sequence > _slots.size()) ? (_next_sequence - _slots.size()) : 0;
+		auto sequence = cursor.GetSequence();
+
+		if (sequence < oldest_sequence)
+		{
+			uint64_t kept_count = 0;
+
+			for (const auto &[data_sequence, data_frame] : _data_frames)
+			{
+				if (data_sequence >= oldest_sequence)
+				{
+					break;
+				}
+
+				if (data_sequence >= sequence)
+				{
+					frames.push_back(data_frame);
+					kept_count++;
+				}
+			}
+
+			if (lagged_count != nullptr)
+			{
+				*lagged_count = oldest_sequence - sequence - kept_count;
+			}
+
+			sequence = oldest_sequence;
+			result = ReadResult::Lagging;
+		}
+
+		while ((sequence < _next_sequence) && (max_count > 0))
+		{
+			frames.push_back(_slots[sequence % _slots.size()]);
+
+			sequence++;
+			max_count--;
+		}
+
+		// Push() releases the frames under the unique lock, so the frames read here are still in the slots
+		cursor._sequence.store(sequence, std::memory_order_release);
+
+		return result;
+	}
+
+	// Returns true if there are frames after the cursor
+	bool HasFrames(const Cursor &cursor) const
+	{
+		std::shared_lock lock(_mutex);
+		return cursor.GetSequence() < _next_sequence;
+	}
+
+	void Clear()
+	{
+		std::unique_lock lock(_mutex);
+
+		for (auto &slot : _slots)
+		{
+			slot = nullptr;
+		}
+
+		_data_frames.clear();
+
+		_released_sequence = _next_sequence;
+	}
+
+private:
+	static bool IsDataFrame(const std::shared_ptr<MediaPacket> &packet)
+	{
+		return (packet != nullptr) &&
+			   ((packet->GetMediaType() == cmn::MediaType::Data) || (packet->GetMediaType() == cmn::MediaType::Subtitle));
+	}
+
+	// Releases the frames before the slowest cursor, the latest frame is kept for the readers created after it is pushed
+	void ReleaseReadFrames()
+	{
+		auto release_until = (_next_sequence > 0) ? (_next_sequence - 1) : 0;
+
+		for (auto it = _cursors.begin(); it != _cursors.end();)
+		{
+			auto cursor = it->lock();
+			if (cursor == nullptr)
+			{
+				it = _cursors.erase(it);
+				continue;
+			}
+
+			release_until = std::min(release_until, cursor->GetSequence());
+			++it;
+		}
+
+		// Frames older than the capacity have been overwritten already
+		auto oldest_sequence = (_next_sequence > _slots.size()) ? (_next_sequence - _slots.size()) : 0;
+
+		for (auto sequence = std::max(_released_sequence, oldest_sequence); sequence < release_until; sequence++)
+		{
+			_slots[sequence % _slots.size()] = nullptr;
+		}
+
+		_released_sequence = std::max(_released_sequence, release_until);
+
+		while ((_data_frames.empty() == false) && (_data_frames.front().first < release_until))
+		{
+			_data_frames.pop_front();
+		}
+	}
+
+	mutable std::shared_mutex _mutex;
+
+	std::vector<std::shared_ptr<MediaPacket>> _slots;
+	uint64_t _next_sequence = 0;
+	// Frames before this have been released
+	uint64_t _released_sequence = 0;
+
+	std::vector<std::weak_ptr<Cursor>> _cursors;
+
+	// (sequence, frame) of the data frames that have not been passed by every cursor, in order of sequence (up to <capacity>)
+	std::deque<std::pair<uint64_t, std::shared_ptr<MediaPacket>>> _data_frames;
+};
@@ -7,6 +7,7 @@
 #include <memory>
 #include <vector>
 
+#include "media_frame_ring.h"
 #include "mediarouter_application_interface.h"
 #include "mediarouter_interface.h"
 
@@ -34,6 +35,13 @@ public:
 	// Delivery encoded video/audio frame
 	virtual bool OnSendFrame(const std::shared_ptr<info::Stream> &info, const std::shared_ptr<MediaPacket> &packet) = 0;
 
+	// Called after a frame is pushed to the frame ring of the outbound stream (Publisher only)
+	// If the observer doesn't read frames from the ring, returns false, then OnSendFrame() is called instead
+	virtual bool OnFramePushed(const std::shared_ptr<info::Stream> &info, const std::shared_ptr<MediaFrameRing> &frame_ring)
+	{
+		return false;
+	}
+
 	virtual ObserverType GetObserverType()
 	{
 		return ObserverType::Publisher;
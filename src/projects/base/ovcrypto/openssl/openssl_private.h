@@ -8,4 +8,13 @@
 //==============================================================================
 #pragma once
 
-#define OV_LOG_TAG "OpenSSL"
\ No newline at end of file
+#define OV_LOG_TAG "OpenSSL"
+
+// BIO controls that OpenSSL 3.x sends to the write BIO when SSL_OP_ENABLE_KTLS is set
+// (defined in internal/bio.h of OpenSSL, which is not installed)
+//
+// BIO_CTRL_SET_KTLS: num = 1 (transmit) / 0 (receive), ptr = crypto info (starts with struct tls_crypto_info)
+#define OV_BIO_CTRL_SET_KTLS 72
+// num = record type of the next write
+#define OV_BIO_CTRL_SET_KTLS_SEND_CTRL_MSG 74
+#define OV_BIO_CTRL_CLEAR_KTLS_CTRL_MSG 75
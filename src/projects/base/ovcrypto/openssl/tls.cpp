@@ -157,6 +157,23 @@ namespace ov
 		return ::SSL_get_error(_ssl, code);
 	}
 
+	bool Tls::EnableKtls()
+	{
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+		std::lock_guard<std::mutex> lock(_ssl_lock);
+
+		if (_ssl == nullptr)
+		{
+			return false;
+		}
+
+		::SSL_set_options(_ssl, SSL_OP_ENABLE_KTLS);
+		return true;
+#else
+		return false;
+#endif
+	}
+
 	void Tls::SetTlsHostName(const ov::String &host_name)
 	{
 		OV_ASSERT2(_ssl != nullptr);
@@ -24,6 +24,10 @@ namespace ov
 
 		void SetTlsHostName(const ov::String &host_name);
 
+		// Asks OpenSSL to hand over the keys to the BIO (BIO_CTRL_SET_KTLS) when they are changed
+		// Returns false if OpenSSL is built without kTLS
+		bool EnableKtls();
+
 		// @return Returns SSL_ERROR_NONE on success
 		int Accept();
 
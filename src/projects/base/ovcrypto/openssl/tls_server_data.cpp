@@ -12,6 +12,10 @@
 
 namespace ov
 {
+	static std::atomic<uint64_t> ktls_requested_count{0};
+	static std::atomic<uint64_t> ktls_enabled_count{0};
+	static std::atomic<uint64_t> ktls_fallback_count{0};
+
 	TlsServerData::TlsServerData(const std::shared_ptr<TlsContext> &tls_context, bool is_nonblocking)
 	{
 		TlsBioCallback callback = {
@@ -88,6 +92,21 @@ namespace ov
 						case SSL_ERROR_NONE: {
 							logtd("Accepted");
 							_state = State::Accepted;
+
+							if (_ktls_send_callback != nullptr)
+							{
+								if (_ktls_send_enabled)
+								{
+									ktls_enabled_count++;
+									logtd("Outgoing records are encrypted by the kernel (%s)", _tls.GetServerName().CStr());
+								}
+								else
+								{
+									// TLS 1.2 with a non-AEAD cipher, or the kernel refused the key
+									ktls_fallback_count++;
+									logtd("Outgoing records are encrypted in user space (%s)", _tls.GetServerName().CStr());
+								}
+							}
 							break;
 						}
 
@@ -173,6 +192,38 @@ namespace ov
 		return false;
 	}
 
+	bool TlsServerData::EnableKtls(KtlsSendCallback send_callback, KtlsRecordCallback record_callback)
+	{
+		if ((_state != State::WaitingForAccept) || (send_callback == nullptr) || (record_callback == nullptr))
+		{
+			return false;
+		}
+
+		if (_tls.EnableKtls() == false)
+		{
+			logtd("Could not enable kTLS: OpenSSL is built without kTLS");
+			return false;
+		}
+
+		_ktls_send_callback = send_callback;
+		_ktls_record_callback = record_callback;
+
+		ktls_requested_count++;
+
+		return true;
+	}
+
+	TlsServerData::KtlsStats TlsServerData::GetKtlsStats()
+	{
+		KtlsStats stats;
+
+		stats.requested_count = ktls_requested_count;
+		stats.enabled_count = ktls_enabled_count;
+		stats.fallback_count = ktls_fallback_count;
+
+		return stats;
+	}
+
 	TlsServerData::AlpnProtocol TlsServerData::GetSelectedAlpnProtocol() const
 	{
 		auto alpn_protocol = _tls.GetSelectedAlpnName();
@@ -229,6 +280,15 @@ namespace ov
 
 	ssize_t TlsServerData::OnTlsWrite(Tls *tls, const void *data, size_t length)
 	{
+		if (_ktls_record_type != 0)
+		{
+			// A plain text record (alert, handshake, ...) that the kernel encrypts
+			auto record_type = _ktls_record_type;
+			_ktls_record_type = 0;
+
+			return _ktls_record_callback(record_type, data, length) ? length : -1LL;
+		}
+
 		if (_state == State::WaitingForAccept)
 		{
 			if (_write_callback != nullptr)
@@ -269,6 +329,30 @@ namespace ov
 			case BIO_CTRL_FLUSH:
 				return 1;
 
+			case OV_BIO_CTRL_SET_KTLS:
+				// The key is not installed for receiving, incoming records are decrypted in user space
+				if ((num == 1) && (_ktls_send_callback != nullptr) && (arg != nullptr))
+				{
+					// From now on, OpenSSL writes records in plain text
+					_ktls_send_enabled = _ktls_send_callback(arg);
+					return _ktls_send_enabled ? 1 : 0;
+				}
+				return 0;
+
+			case BIO_CTRL_GET_KTLS_SEND:
+				return _ktls_send_enabled ? 1 : 0;
+
+			case BIO_CTRL_GET_KTLS_RECV:
+				return 0;
+
+			case OV_BIO_CTRL_SET_KTLS_SEND_CTRL_MSG:
+				_ktls_record_type = static_cast<uint8_t>(num);
+				return 0;
+
+			case OV_BIO_CTRL_CLEAR_KTLS_CTRL_MSG:
+				_ktls_record_type = 0;
+				return 0;
+
 			default:
 				return 0;
 		}
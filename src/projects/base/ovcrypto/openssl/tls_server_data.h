@@ -18,6 +18,22 @@ namespace ov
 	public:
 		using WriteCallback = std::function<ssize_t(const void *data, int64_t length)>;
 
+		// Called when OpenSSL hands over the transmit key, <crypto_info> is a struct tls_crypto_info of linux/tls.h
+		// Returns false if the kernel cannot encrypt the records (the records are encrypted in user space)
+		using KtlsSendCallback = std::function<bool(const void *crypto_info)>;
+		// Sends a record other than application data (alert, handshake, ...) after the transmit key is handed over
+		using KtlsRecordCallback = std::function<bool(uint8_t record_type, const void *data, size_t length)>;
+
+		struct KtlsStats
+		{
+			// Number of connections that requested kTLS
+			uint64_t requested_count = 0;
+			// Number of connections whose records are encrypted by the kernel
+			uint64_t enabled_count = 0;
+			// Number of connections that fell back to user space encryption (unsupported protocol/cipher, kernel refused the key)
+			uint64_t fallback_count = 0;
+		};
+
 		enum class State
 		{
 			Invalid,
@@ -64,6 +80,18 @@ namespace ov
 			return _tls;
 		}
 
+		// Encrypts outgoing records in the kernel (kTLS) if OpenSSL, the kernel and the negotiated cipher support it.
+		// Must be called before the handshake.
+		bool EnableKtls(KtlsSendCallback send_callback, KtlsRecordCallback record_callback);
+
+		// If true, application data must be written to the socket as it is (without Encrypt())
+		bool IsKtlsSendEnabled() const
+		{
+			return _ktls_send_enabled;
+		}
+
+		static KtlsStats GetKtlsStats();
+
 		// Get ALPN protocol
 		AlpnProtocol GetSelectedAlpnProtocol() const;
 		ov::String GetSelectedAlpnProtocolStr() const;
@@ -108,6 +136,12 @@ namespace ov
 
 		AlpnProtocol _selected_alpn_protocol = AlpnProtocol::Http11;
 
+		KtlsSendCallback _ktls_send_callback;
+		KtlsRecordCallback _ktls_record_callback;
+		std::atomic<bool> _ktls_send_enabled{false};
+		// Type of the record that OpenSSL writes next (0: application data)
+		uint8_t _ktls_record_type = 0;
+
 	private:
 		std::mutex _tls_sequential_send_mutex;	// for atomic send
 	};
@@ -166,6 +166,29 @@ namespace ov
         return time_string;
     }
 
+	bool Converter::FromRFC7231String(const ov::String &rfc7231_string, std::chrono::system_clock::time_point &tp)
+	{
+		std::tm gmt_time{};
+		std::istringstream iss(rfc7231_string.CStr());
+		iss.imbue(std::locale::classic());
+		iss >> std::get_time(&gmt_time, "%a, %d %b %Y %H:%M:%S GMT");
+
+		if (iss.fail())
+		{
+			return false;
+		}
+
+		auto time = ::timegm(&gmt_time);
+		if (time == static_cast<std::time_t>(-1))
+		{
+			return false;
+		}
+
+		tp = std::chrono::system_clock::from_time_t(time);
+
+		return true;
+	}
+
 	// From ISO8601 string to time_point
 	std::chrono::system_clock::time_point Converter::FromISO8601(const String &iso8601)
 	{
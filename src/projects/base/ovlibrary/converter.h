@@ -51,6 +51,8 @@ namespace ov
 
 		// HTTP Date format
 		static String ToRFC7231String(const std::chrono::system_clock::time_point &tp);
+		// Returns false if <rfc7231_string> is not an IMF-fixdate (e.g. "Sun, 06 Nov 1994 08:49:37 GMT")
+		static bool FromRFC7231String(const ov::String &rfc7231_string, std::chrono::system_clock::time_point &tp);
 
 		static ov::String ToSiString(int64_t number, int precision);
 
@@ -47,12 +47,19 @@ namespace ov
 		}
 	}
 
+	Data::Data(const void *data, size_t length, const std::shared_ptr<const void> &owner)
+		: Data(data, length, true)
+	{
+		_reference_owner = owner;
+	}
+
 	Data::Data(const Data &data)
 	{
 		_reference_data = data._reference_data;
+		_reference_owner = data._reference_owner;
 		if (data._allocated_data != nullptr)
 		{
-			_allocated_data = std::make_shared<std::vector<uint8_t>>();
+			_allocated_data = MakePooledShared<Buffer>();
 			Append(&data);
 		}
 		_offset = data._offset;
@@ -62,6 +69,7 @@ namespace ov
 	Data::Data(Data &&data) noexcept
 	{
 		std::swap(_reference_data, data._reference_data);
+		std::swap(_reference_owner, data._reference_owner);
 		std::swap(_allocated_data, data._allocated_data);
 		std::swap(_offset, data._offset);
 		std::swap(_length, data._length);
@@ -87,7 +95,7 @@ namespace ov
 			return nullptr;
 		}
 
-		auto instance = std::make_shared<Data>();
+		auto instance = MakePooledShared<Data>();
 
 		size_t current_length = GetLength();
 
@@ -105,6 +113,7 @@ namespace ov
 		{
 			// Refer _reference_data
 			instance->_reference_data = _reference_data;
+			instance->_reference_owner = _reference_owner;
 		}
 		else
 		{
@@ -153,6 +162,7 @@ namespace ov
 
 		// ov::Data supports COW (Copy-on-write), so we just assign the variables of data to member variables.
 		_reference_data = data._reference_data;
+		_reference_owner = data._reference_owner;
 		_allocated_data = data._allocated_data;
 		_offset = data._offset;
 		_length = data._length;
@@ -231,6 +241,8 @@ namespace ov
 		{
 			// Copy from original data
 			const void *original_data = _reference_data;
+			// Keep the original data alive until it is copied
+			auto original_owner = std::move(_reference_owner);
 			off_t offset = _offset;
 			size_t length = _length;
 
@@ -267,7 +279,7 @@ namespace ov
 		// Reset the offset
 		_offset = 0L;
 
-		_allocated_data = std::make_shared<std::vector<uint8_t>>(begin, end);
+		_allocated_data = MakePooledShared<Buffer>(begin, end);
 		_allocated_data->reserve(old_data->capacity() - old_offset);
 
 		return (_allocated_data != nullptr);
@@ -286,7 +298,7 @@ namespace ov
 		}
 		else
 		{
-			_allocated_data = std::make_shared<std::vector<uint8_t>>();
+			_allocated_data = MakePooledShared<Buffer>();
 		}
 
 		_allocated_data->reserve(capacity);
@@ -298,7 +310,8 @@ namespace ov
 	{
 		// Reallocate the buffer (this method is faster than Detach() & clear());
 		_reference_data = nullptr;
-		_allocated_data = std::make_shared<std::vector<uint8_t>>();
+		_reference_owner = nullptr;
+		_allocated_data = MakePooledShared<Buffer>();
 		_offset = 0;
 		_length = 0;
 
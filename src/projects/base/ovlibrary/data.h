@@ -11,6 +11,7 @@
 #include "./string.h"
 #include "./assert.h"
 #include "./memory_utilities.h"
+#include "./memory_pool.h"
 #include "./data.h"
 
 #include <memory>
@@ -41,6 +42,13 @@ namespace ov
 		/// If reference_only is false, it will not be affected if the data changes because it allocates a new memory and copies it there.
 		Data(const void *data, size_t length, bool reference_only = false);
 
+		/// Constructs a instance that refers the memory owned by <owner> (such as a memory-mapped file)
+		///
+		/// @param data data to reference
+		/// @param length length of data
+		/// @param owner keeps the memory valid while this instance (and its subdata/clones) refer it
+		Data(const void *data, size_t length, const std::shared_ptr<const void> &owner);
+
 		// Copy constructor
 		Data(const Data &data);
 
@@ -213,6 +221,9 @@ namespace ov
 		String ToHexString() const;
 
 	protected:
+		// Backing storage, allocated from ov::MemoryPool
+		using Buffer = std::vector<uint8_t, PoolAllocator<uint8_t>>;
+
 		std::shared_ptr<const Data> SubdataInternal(off_t offset, size_t length) const;
 
 		/// Called to separate from the origin data
@@ -221,9 +232,11 @@ namespace ov
 		bool Detach();
 
 		const void *_reference_data = nullptr;
+		// Keeps _reference_data alive (nullptr if the caller manages the lifetime of _reference_data)
+		std::shared_ptr<const void> _reference_owner = nullptr;
 
 		// Allocated data. If this data is subdata, _current_data and _data can be different.
-		std::shared_ptr<std::vector<uint8_t>> _allocated_data = nullptr;
+		std::shared_ptr<Buffer> _allocated_data = nullptr;
 		// Offset from _allocated_data
 		off_t _offset = 0;
 
@@ -0,0 +1,200 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "epoch_reclaimer.h"
+
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace ov
+{
+	// Owned by one thread at a time, and reused by another thread after the owner exits
+	struct alignas(64) EpochReclaimer::Slot
+	{
+		// The epoch when the owner started reading (0: not reading)
+		std::atomic<uint64_t> epoch{0};
+		// Depth of the nested ReadGuards (Used only by the owner thread)
+		uint32_t depth = 0;
+
+		std::atomic<bool> in_use{false};
+		// Slots are never freed, so the list can be traversed without a lock
+		Slot *next = nullptr;
+	};
+
+	namespace
+	{
+		struct RetiredItem
+		{
+			uint64_t epoch;
+			std::function<void()> deleter;
+		};
+
+		std::atomic<uint64_t> g_epoch{1};
+		std::atomic<EpochReclaimer::Slot *> g_slot_list{nullptr};
+
+		std::mutex g_retired_list_mutex;
+		// Sorted by epoch
+		std::deque<RetiredItem> g_retired_list;
+
+		EpochReclaimer::Slot *AcquireSlot()
+		{
+			for (auto slot = g_slot_list.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+			{
+				bool in_use = false;
+
+				if ((slot->in_use.load(std::memory_order_relaxed) == false) &&
+					slot->in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire))
+				{
+					return slot;
+				}
+			}
+
+			auto slot = new EpochReclaimer::Slot();
+			slot->in_use.store(true, std::memory_order_relaxed);
+			slot->next = g_slot_list.load(std::memory_order_relaxed);
+
+			while (g_slot_list.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed) == false)
+			{
+			}
+
+			return slot;
+		}
+
+		void ReleaseSlot(EpochReclaimer::Slot *slot)
+		{
+			slot->epoch.store(0, std::memory_order_release);
+			slot->depth = 0;
+			slot->in_use.store(false, std::memory_order_release);
+		}
+
+		// If the kernel supports it, the writer forces a memory barrier on all threads of the process with membarrier(),
+		// so readers don't need a memory fence (which stalls until all pending loads and stores are done)
+		bool UseMembarrier()
+		{
+			static const bool use_membarrier = (::syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0) == 0);
+			return use_membarrier;
+		}
+
+		// Set when the holder of the current thread is destroyed
+		thread_local bool slot_holder_destroyed = false;
+
+		// Keeps the slot of the current thread, and releases it when the thread exits
+		struct SlotHolder
+		{
+			~SlotHolder()
+			{
+				slot_holder_destroyed = true;
+
+				if (slot != nullptr)
+				{
+					ReleaseSlot(slot);
+				}
+			}
+
+			EpochReclaimer::Slot *slot = nullptr;
+		};
+	}  // namespace
+
+	EpochReclaimer::ReadGuard::ReadGuard()
+	{
+		if (slot_holder_destroyed)
+		{
+			// The thread is exiting - use a temporary slot
+			_slot = AcquireSlot();
+		}
+		else
+		{
+			thread_local SlotHolder holder;
+
+			if (holder.slot == nullptr)
+			{
+				holder.slot = AcquireSlot();
+			}
+
+			_slot = holder.slot;
+		}
+
+		if (_slot->depth++ == 0)
+		{
+			_slot->epoch.store(g_epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+
+			// Pairs with the barrier of RetireInternal(): either the writer sees this slot, or this reader sees the new object
+			if (UseMembarrier())
+			{
+				std::atomic_signal_fence(std::memory_order_seq_cst);
+			}
+			else
+			{
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+			}
+		}
+	}
+
+	EpochReclaimer::ReadGuard::~ReadGuard()
+	{
+		if (--_slot->depth == 0)
+		{
+			_slot->epoch.store(0, std::memory_order_release);
+
+			if (slot_holder_destroyed)
+			{
+				ReleaseSlot(_slot);
+			}
+		}
+	}
+
+	void EpochReclaimer::RetireInternal(std::function<void()> deleter)
+	{
+		// The caller has already unpublished the object
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (UseMembarrier())
+		{
+			::syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0);
+		}
+
+		std::vector<std::function<void()>> deleter_list;
+
+		{
+			std::lock_guard lock_guard(g_retired_list_mutex);
+
+			// Readers that start from now on get a newer epoch, so they cannot see the object
+			g_retired_list.push_back({g_epoch.fetch_add(1, std::memory_order_acq_rel), std::move(deleter)});
+
+			auto min_epoch = std::numeric_limits<uint64_t>::max();
+
+			for (auto slot = g_slot_list.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+			{
+				auto epoch = slot->epoch.load(std::memory_order_acquire);
+
+				if ((epoch != 0) && (epoch < min_epoch))
+				{
+					min_epoch = epoch;
+				}
+			}
+
+			// An object retired at epoch N may be seen only by readers that started at epoch N or earlier
+			while ((g_retired_list.empty() == false) && (g_retired_list.front().epoch < min_epoch))
+			{
+				deleter_list.push_back(std::move(g_retired_list.front().deleter));
+				g_retired_list.pop_front();
+			}
+		}
+
+		// Deleted without the lock, because a destructor may retire another object
+		for (auto &item : deleter_list)
+		{
+			item();
+		}
+	}
+}  // namespace ov
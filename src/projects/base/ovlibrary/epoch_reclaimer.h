@@ -0,0 +1,68 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+namespace ov
+{
+	// Epoch-based reclamation of objects that are published through atomic pointers
+	//
+	// Readers wrap their accesses in a ReadGuard, which writes only to a slot owned by the current thread,
+	// so readers never share a cache line or take a lock. A writer publishes a new object and then passes
+	// the old one to Retire(). The old object is deleted once every reader that might still see it has left.
+	//
+	// Usage:
+	//   // Reader
+	//   {
+	//       ov::EpochReclaimer::ReadGuard guard;
+	//       auto object = _object.load(std::memory_order_acquire);
+	//       ... (object must not be used after the guard is destroyed)
+	//   }
+	//
+	//   // Writer
+	//   auto old_object = _object.exchange(new_object);
+	//   ov::EpochReclaimer::Retire(old_object);
+	class EpochReclaimer
+	{
+	public:
+		struct Slot;
+
+		// Can be nested
+		class ReadGuard
+		{
+		public:
+			ReadGuard();
+			~ReadGuard();
+
+			ReadGuard(const ReadGuard &) = delete;
+			ReadGuard &operator=(const ReadGuard &) = delete;
+
+		private:
+			Slot *_slot;
+		};
+
+		// Deletes the object when no reader can access it anymore
+		// (The deletion runs on the thread that calls Retire() later, so it may be delayed until the next Retire())
+		template <typename T>
+		static void Retire(const T *object)
+		{
+			if (object != nullptr)
+			{
+				RetireInternal([object]() {
+					delete object;
+				});
+			}
+		}
+
+	private:
+		static void RetireInternal(std::function<void()> deleter);
+	};
+}  // namespace ov
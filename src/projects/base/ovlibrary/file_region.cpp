@@ -0,0 +1,127 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "file_region.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "./assert.h"
+#include "./log.h"
+
+#define OV_LOG_TAG "FileRegion"
+
+namespace ov
+{
+	std::shared_ptr<FileRegion> FileRegion::Open(const ov::String &path)
+	{
+		int fd = ::open(path.CStr(), O_RDONLY | O_CLOEXEC);
+
+		if (fd < 0)
+		{
+			logte("Could not open file: %s (%s)", path.CStr(), ::strerror(errno));
+			return nullptr;
+		}
+
+		struct stat file_stat;
+
+		if (::fstat(fd, &file_stat) != 0)
+		{
+			logte("Could not get the status of file: %s (%s)", path.CStr(), ::strerror(errno));
+			::close(fd);
+			return nullptr;
+		}
+
+		auto fd_owner = std::shared_ptr<int>(new int(fd), [](int *fd) {
+			::close(*fd);
+			delete fd;
+		});
+
+		auto identity = String::FormatString("%jx-%jx-%jx",
+											 static_cast<uintmax_t>(file_stat.st_ino),
+											 static_cast<uintmax_t>(file_stat.st_size),
+											 static_cast<uintmax_t>(file_stat.st_mtime));
+
+		return std::make_shared<FileRegion>(fd, 0, static_cast<size_t>(file_stat.st_size), fd_owner, identity);
+	}
+
+	FileRegion::FileRegion(int fd, off_t offset, size_t length, const std::shared_ptr<const void> &fd_owner, const ov::String &identity)
+		: _fd(fd),
+		  _offset(offset),
+		  _length(length),
+		  _fd_owner(fd_owner),
+		  _identity(identity)
+	{
+		OV_ASSERT2(_fd >= 0);
+		OV_ASSERT2(_offset >= 0);
+	}
+
+	std::shared_ptr<FileRegion> FileRegion::Subregion(size_t offset) const
+	{
+		if (offset > _length)
+		{
+			OV_ASSERT(false, "offset (%zu) must be smaller than %zu", offset, _length);
+			return nullptr;
+		}
+
+		return std::make_shared<FileRegion>(_fd, _offset + offset, _length - offset, _fd_owner, _identity);
+	}
+
+	std::shared_ptr<FileRegion> FileRegion::Subregion(size_t offset, size_t length) const
+	{
+		if ((offset > _length) || (length > (_length - offset)))
+		{
+			OV_ASSERT(false, "offset (%zu) + length (%zu) must be smaller than %zu", offset, length, _length);
+			return nullptr;
+		}
+
+		return std::make_shared<FileRegion>(_fd, _offset + offset, length, _fd_owner, _identity);
+	}
+
+	std::shared_ptr<Data> FileRegion::Read() const
+	{
+		auto data = std::make_shared<Data>(_length);
+		data->SetLength(_length);
+
+		auto buffer = data->GetWritableDataAs<uint8_t>();
+		size_t total_read_bytes = 0;
+
+		while (total_read_bytes < _length)
+		{
+			auto read_bytes = ::pread(_fd, buffer + total_read_bytes, _length - total_read_bytes, _offset + total_read_bytes);
+
+			if (read_bytes < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				logte("Could not read %s (%s)", ToString().CStr(), ::strerror(errno));
+				return nullptr;
+			}
+
+			if (read_bytes == 0)
+			{
+				logte("Could not read %s (unexpected end of file at %zu bytes)", ToString().CStr(), total_read_bytes);
+				return nullptr;
+			}
+
+			total_read_bytes += read_bytes;
+		}
+
+		return data;
+	}
+
+	String FileRegion::ToString() const
+	{
+		return String::FormatString("<FileRegion: %p, fd: %d, offset: %jd, length: %zu>", this, _fd, static_cast<intmax_t>(_offset), _length);
+	}
+}  // namespace ov
@@ -0,0 +1,72 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <sys/types.h>
+
+#include <memory>
+
+#include "./data.h"
+#include "./string.h"
+
+namespace ov
+{
+	// A range of an opened file
+	//
+	// Used to send the contents of a file to a socket without copying them to user space (sendfile()).
+	// The file descriptor is kept open while any FileRegion (or its subregion) refers to it.
+	class FileRegion
+	{
+	public:
+		// Opens <path> and returns a region that covers the whole file
+		static std::shared_ptr<FileRegion> Open(const ov::String &path);
+
+		// <fd_owner> must keep <fd> open while this instance is alive
+		// <identity> identifies the contents of the region (used to create an ETag without reading the file)
+		FileRegion(int fd, off_t offset, size_t length, const std::shared_ptr<const void> &fd_owner, const ov::String &identity = "");
+
+		int GetFd() const
+		{
+			return _fd;
+		}
+
+		off_t GetOffset() const
+		{
+			return _offset;
+		}
+
+		size_t GetLength() const
+		{
+			return _length;
+		}
+
+		const ov::String &GetIdentity() const
+		{
+			return _identity;
+		}
+
+		// Returns the rest of the region after <offset> bytes
+		std::shared_ptr<FileRegion> Subregion(size_t offset) const;
+		// Returns <length> bytes of the region from <offset> (e.g. Range requests)
+		std::shared_ptr<FileRegion> Subregion(size_t offset, size_t length) const;
+
+		// Reads the region into memory
+		// Used when the region cannot be sent using sendfile() (TLS, HTTP/2, chunked transfer, ...)
+		std::shared_ptr<Data> Read() const;
+
+		String ToString() const;
+
+	private:
+		int _fd = -1;
+		off_t _offset = 0;
+		size_t _length = 0;
+
+		std::shared_ptr<const void> _fd_owner;
+		ov::String _identity;
+	};
+}  // namespace ov
@@ -48,6 +48,21 @@ bool ov_log_get_enabled(const char *tag, OVLogLevel level)
 	return g_log_internal.IsEnabled(tag, level);
 }
 
+const uint32_t *ov_log_get_enabled_mask(const char *tag)
+{
+	return g_log_internal.GetEnabledMaskWord(tag);
+}
+
+void ov_log_set_async(bool enable, size_t queue_size, OVLogOverflowPolicy overflow_policy, int fsync_interval_ms)
+{
+	g_log_internal.SetAsync(enable, queue_size, overflow_policy, fsync_interval_ms);
+}
+
+uint64_t ov_log_get_dropped_count()
+{
+	return g_log_internal.GetDroppedCount();
+}
+
 void ov_log_internal(OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, ...)
 {
 	va_list arg_list;
@@ -58,6 +73,16 @@ void ov_log_internal(OVLogLevel level, const char *tag, const char *file, int li
 	va_end(arg_list);
 }
 
+void ov_log_write(OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, ...)
+{
+	va_list arg_list;
+	va_start(arg_list, format);
+
+	g_log_internal.Write(true, level, tag, file, line, method, format, arg_list);
+
+	va_end(arg_list);
+}
+
 void ov_log_set_path(const char *log_path)
 {
 	g_log_internal.SetLogPath(log_path);
@@ -8,6 +8,10 @@
 //==============================================================================
 #pragma once
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -59,6 +63,15 @@ extern "C"
 		OVLogLevelCritical
 	} OVLogLevel;
 
+	// What to do when the queue of the asynchronous logger is full
+	typedef enum OVLogOverflowPolicy
+	{
+		// Discard the log (The number of discarded logs is written to the log file later)
+		OVLogOverflowPolicyDrop,
+		// Wait until the writer thread makes room
+		OVLogOverflowPolicyBlock
+	} OVLogOverflowPolicy;
+
 	typedef enum StatLogType
 	{
 		STAT_LOG_WEBRTC_EDGE_SESSION,
@@ -78,21 +91,57 @@ extern "C"
 //--------------------------------------------------------------------
 // Logging APIs
 //--------------------------------------------------------------------
+// Address of the enabled mask cached in each call site
+// (In C++, the static is declared in a lambda, so the macros can also be used in constexpr functions)
+#ifdef __cplusplus
+#	define __ov_log_cache()                                     \
+		([]() -> const uint32_t ** {                            \
+			static const uint32_t *__ov_log_enabled_mask = NULL; \
+			return &__ov_log_enabled_mask;                       \
+		}())
+#else  // __cplusplus
+#	define __ov_log_cache()                                     \
+		({                                                      \
+			static const uint32_t *__ov_log_enabled_mask = NULL; \
+			&__ov_log_enabled_mask;                              \
+		})
+#endif	// __cplusplus
+
+// Checks the level of the tag with the cached mask, so a disabled log costs a single branch
+// (The tag of a call site must not change: string literals and static strings are fine)
+#define __ov_log(level, tag, format, ...)                                                               \
+	do                                                                                                  \
+	{                                                                                                   \
+		const uint32_t **__enabled_mask_cache = __ov_log_cache();                                       \
+		const uint32_t *__enabled_mask = __atomic_load_n(__enabled_mask_cache, __ATOMIC_ACQUIRE);       \
+                                                                                                        \
+		if (__enabled_mask == NULL)                                                                     \
+		{                                                                                               \
+			__enabled_mask = ov_log_get_enabled_mask(tag);                                              \
+			__atomic_store_n(__enabled_mask_cache, __enabled_mask, __ATOMIC_RELEASE);                   \
+		}                                                                                               \
+                                                                                                        \
+		if ((__atomic_load_n(__enabled_mask, __ATOMIC_RELAXED) >> (level)) & 0x01)                      \
+		{                                                                                               \
+			ov_log_write(level, tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ##__VA_ARGS__);    \
+		}                                                                                               \
+	} while (false)
+
 #if DEBUG
 #	ifdef ENABLE_TRACE_LOG
-#		define logt(tag, format, ...) ov_log_internal(OVLogLevelTrace, tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ##__VA_ARGS__)
+#		define logt(tag, format, ...) __ov_log(OVLogLevelTrace, tag, format, ##__VA_ARGS__)
 #	else  // ENABLE_TRACE_LOG
 #		define logt __ov_noop
 #	endif	// ENABLE_TRACE_LOG
-#	define logd(tag, format, ...) ov_log_internal(OVLogLevelDebug, tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ##__VA_ARGS__)
+#	define logd(tag, format, ...) __ov_log(OVLogLevelDebug, tag, format, ##__VA_ARGS__)
 #else  // DEBUG
 #	define logt __ov_noop
 #	define logd __ov_noop
 #endif	// DEBUG
-#define logi(tag, format, ...) ov_log_internal(OVLogLevelInformation, tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ##__VA_ARGS__)
-#define logw(tag, format, ...) ov_log_internal(OVLogLevelWarning, tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ##__VA_ARGS__)
-#define loge(tag, format, ...) ov_log_internal(OVLogLevelError, tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ##__VA_ARGS__)
-#define logc(tag, format, ...) ov_log_internal(OVLogLevelCritical, tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ##__VA_ARGS__)
+#define logi(tag, format, ...) __ov_log(OVLogLevelInformation, tag, format, ##__VA_ARGS__)
+#define logw(tag, format, ...) __ov_log(OVLogLevelWarning, tag, format, ##__VA_ARGS__)
+#define loge(tag, format, ...) __ov_log(OVLogLevelError, tag, format, ##__VA_ARGS__)
+#define logc(tag, format, ...) __ov_log(OVLogLevelCritical, tag, format, ##__VA_ARGS__)
 
 //--------------------------------------------------------------------
 // Logging APIs with tag
@@ -129,8 +178,27 @@ extern "C"
 	///         e.g. 4) If level is info and is_enabled is true, debug logs are not printed, information~critical logs are printed.
 	bool ov_log_set_enable(const char *tag_regex, OVLogLevel level, bool is_enabled);
 	bool ov_log_get_enabled(const char *tag, OVLogLevel level);
+	/// @returns The address of a word whose bit N is set if OVLogLevel N of the tag is enabled
+	///
+	/// @remarks The word is updated whenever the log level or the enable rules are changed, and stays valid until the process exits
+	const uint32_t *ov_log_get_enabled_mask(const char *tag);
+
+	/// Moves writing of logs to a background thread
+	///
+	/// @param enable Whether to write logs asynchronously
+	/// @param queue_size Maximum number of pending logs per thread
+	/// @param overflow_policy What to do when the queue of a thread is full
+	/// @param fsync_interval_ms Interval of fsync() of the log file (0: never)
+	///
+	/// @remarks Critical logs are written synchronously, after the pending logs
+	void ov_log_set_async(bool enable, size_t queue_size, OVLogOverflowPolicy overflow_policy, int fsync_interval_ms);
+	/// @returns The number of logs discarded by OVLogOverflowPolicyDrop
+	uint64_t ov_log_get_dropped_count();
 
+	/// Writes the log if the level of the tag is enabled
 	void ov_log_internal(OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, ...);
+	/// Writes the log without filtering (Called from the logging macros after checking ov_log_get_enabled_mask())
+	void ov_log_write(OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, ...);
 	void ov_log_set_path(const char *log_path);
 	const char *ov_log_get_path();
 
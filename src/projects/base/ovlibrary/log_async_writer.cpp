@@ -0,0 +1,369 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "log_async_writer.h"
+
+#include <pthread.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+
+namespace ov
+{
+	// Single-producer (the owner thread) / single-consumer (the writer thread) ring
+	class LogAsyncWriter::ThreadBuffer
+	{
+	public:
+		explicit ThreadBuffer(size_t capacity)
+			: _slots(capacity)
+		{
+		}
+
+		bool TryPush(Entry &entry)
+		{
+			auto tail = _tail.load(std::memory_order_relaxed);
+			auto head = _head.load(std::memory_order_acquire);
+
+			if ((tail - head) >= _slots.size())
+			{
+				// Full
+				return false;
+			}
+
+			_slots[tail % _slots.size()] = std::move(entry);
+			_tail.store(tail + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		bool IsFull() const
+		{
+			return (_tail.load(std::memory_order_relaxed) - _head.load(std::memory_order_acquire)) >= _slots.size();
+		}
+
+		// Returns true if more than half of the ring is used
+		bool IsCongested() const
+		{
+			return (_tail.load(std::memory_order_relaxed) - _head.load(std::memory_order_relaxed)) > (_slots.size() / 2);
+		}
+
+		size_t Drain(std::vector<Entry> &entries)
+		{
+			auto head = _head.load(std::memory_order_relaxed);
+			auto tail = _tail.load(std::memory_order_acquire);
+
+			for (auto position = head; position < tail; position++)
+			{
+				entries.push_back(std::move(_slots[position % _slots.size()]));
+			}
+
+			_head.store(tail, std::memory_order_release);
+
+			return tail - head;
+		}
+
+		bool IsEmpty() const
+		{
+			return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+		}
+
+		// Set when the owner thread exits
+		std::atomic<bool> orphaned{false};
+
+	private:
+		std::vector<Entry> _slots;
+
+		alignas(64) std::atomic<size_t> _head{0};
+		alignas(64) std::atomic<size_t> _tail{0};
+	};
+
+	namespace
+	{
+		std::atomic<uint64_t> g_last_writer_id{0};
+
+		// Set when the holder of the current thread is destroyed
+		thread_local bool thread_buffer_destroyed = false;
+
+		// Keeps the buffer of the current thread, and marks it orphaned when the thread exits
+		struct ThreadBufferHolder
+		{
+			~ThreadBufferHolder()
+			{
+				thread_buffer_destroyed = true;
+
+				if (buffer != nullptr)
+				{
+					buffer->orphaned = true;
+				}
+			}
+
+			uint64_t writer_id = 0;
+			std::shared_ptr<LogAsyncWriter::ThreadBuffer> buffer;
+		};
+
+	}  // namespace
+
+	LogAsyncWriter::LogAsyncWriter(size_t queue_size, OVLogOverflowPolicy overflow_policy, int fsync_interval_ms,
+								   FlushCallback flush_callback, SyncCallback sync_callback)
+		: _id(++g_last_writer_id),
+		  _queue_size(std::max<size_t>(queue_size, 16)),
+		  _overflow_policy(overflow_policy),
+		  _fsync_interval_ms(std::max(fsync_interval_ms, 0)),
+		  _flush_callback(std::move(flush_callback)),
+		  _sync_callback(std::move(sync_callback))
+	{
+	}
+
+	LogAsyncWriter::~LogAsyncWriter()
+	{
+		Stop();
+	}
+
+	bool LogAsyncWriter::Start()
+	{
+		if (_running.exchange(true))
+		{
+			return true;
+		}
+
+		try
+		{
+			_thread = std::thread(&LogAsyncWriter::ThreadProc, this);
+			::pthread_setname_np(_thread.native_handle(), "LogWriter");
+		}
+		catch (const std::system_error &e)
+		{
+			_running = false;
+			return false;
+		}
+
+		return true;
+	}
+
+	void LogAsyncWriter::Stop()
+	{
+		if (_running.exchange(false) == false)
+		{
+			return;
+		}
+
+		WakeUp();
+
+		{
+			// Release the threads waiting for room
+			std::lock_guard lock_guard(_space_mutex);
+		}
+		_space_condition.notify_all();
+
+		if (_thread.joinable())
+		{
+			_thread.join();
+		}
+	}
+
+	std::shared_ptr<LogAsyncWriter::ThreadBuffer> LogAsyncWriter::GetThreadBuffer()
+	{
+		if (thread_buffer_destroyed)
+		{
+			return nullptr;
+		}
+
+		thread_local ThreadBufferHolder holder;
+
+		if ((holder.buffer == nullptr) || (holder.writer_id != _id))
+		{
+			if (holder.buffer != nullptr)
+			{
+				// The buffer belongs to a previous writer
+				holder.buffer->orphaned = true;
+			}
+
+			holder.writer_id = _id;
+			holder.buffer = std::make_shared<ThreadBuffer>(_queue_size);
+
+			std::lock_guard lock_guard(_buffer_list_mutex);
+			_buffer_list.push_back(holder.buffer);
+		}
+
+		return holder.buffer;
+	}
+
+	void LogAsyncWriter::WakeUp()
+	{
+		_wake_condition.notify_one();
+	}
+
+	bool LogAsyncWriter::Push(bool show_format, OVLogLevel level, String log)
+	{
+		if (_running == false)
+		{
+			return false;
+		}
+
+		auto buffer = GetThreadBuffer();
+
+		Entry entry;
+		entry.sequence = _sequence++;
+		entry.show_format = show_format;
+		entry.level = level;
+		entry.log = std::move(log);
+
+		if (buffer == nullptr)
+		{
+			// The thread is exiting - write the log on the caller's thread
+			std::vector<Entry> entries;
+			Drain(entries, &entry);
+
+			return true;
+		}
+
+		while (buffer->TryPush(entry) == false)
+		{
+			if ((_overflow_policy == OVLogOverflowPolicyDrop) || (_running == false))
+			{
+				_dropped_count++;
+				WakeUp();
+				return false;
+			}
+
+			// OVLogOverflowPolicyBlock: wait for the writer thread to make room
+			WakeUp();
+
+			std::unique_lock lock(_space_mutex);
+			_space_condition.wait(lock, [&]() {
+				return (buffer->IsFull() == false) || (_running == false);
+			});
+		}
+
+		if (buffer->IsCongested())
+		{
+			WakeUp();
+		}
+
+		return true;
+	}
+
+	void LogAsyncWriter::Flush(bool show_format, OVLogLevel level, String log)
+	{
+		Entry entry;
+		entry.sequence = _sequence++;
+		entry.show_format = show_format;
+		entry.level = level;
+		entry.log = std::move(log);
+
+		std::vector<Entry> entries;
+		Drain(entries, &entry);
+	}
+
+	size_t LogAsyncWriter::Drain(std::vector<Entry> &entries, Entry *extra_entry)
+	{
+		std::lock_guard drain_lock_guard(_drain_mutex);
+
+		entries.clear();
+
+		{
+			std::lock_guard lock_guard(_buffer_list_mutex);
+
+			for (auto &buffer : _buffer_list)
+			{
+				buffer->Drain(entries);
+			}
+
+			// Remove the buffers of exited threads
+			_buffer_list.erase(
+				std::remove_if(_buffer_list.begin(), _buffer_list.end(),
+							   [](const std::shared_ptr<ThreadBuffer> &buffer) {
+								   return buffer->orphaned && buffer->IsEmpty();
+							   }),
+				_buffer_list.end());
+		}
+
+		if (_overflow_policy == OVLogOverflowPolicyBlock)
+		{
+			// The buffers have room now
+			{
+				std::lock_guard lock_guard(_space_mutex);
+			}
+			_space_condition.notify_all();
+		}
+
+		auto dropped_count = _dropped_count.load();
+		if (dropped_count != _reported_dropped_count)
+		{
+			Entry entry;
+			entry.sequence = _sequence++;
+			entry.show_format = false;
+			entry.level = OVLogLevelWarning;
+			entry.log.Format("[LogWriter] %" PRIu64 " logs have been dropped because the log queue is full (total: %" PRIu64 ")",
+							 dropped_count - _reported_dropped_count, dropped_count);
+			entries.push_back(std::move(entry));
+
+			_reported_dropped_count = dropped_count;
+		}
+
+		if (extra_entry != nullptr)
+		{
+			entries.push_back(std::move(*extra_entry));
+		}
+
+		if (entries.size() > 1)
+		{
+			std::sort(entries.begin(), entries.end(), [](const Entry &entry1, const Entry &entry2) {
+				return entry1.sequence < entry2.sequence;
+			});
+		}
+
+		if ((entries.empty() == false) && (_flush_callback != nullptr))
+		{
+			_flush_callback(entries);
+		}
+
+		return entries.size();
+	}
+
+	void LogAsyncWriter::ThreadProc()
+	{
+		std::vector<Entry> entries;
+		auto last_sync_time = std::chrono::steady_clock::now();
+		bool need_to_sync = false;
+
+		while (_running)
+		{
+			{
+				std::unique_lock lock(_wake_mutex);
+				_wake_condition.wait_for(lock, std::chrono::milliseconds(OV_LOG_ASYNC_FLUSH_INTERVAL_MS));
+			}
+
+			if (Drain(entries) > 0)
+			{
+				need_to_sync = true;
+			}
+
+			if (need_to_sync && (_fsync_interval_ms > 0) && (_sync_callback != nullptr))
+			{
+				auto now = std::chrono::steady_clock::now();
+
+				if (std::chrono::duration_cast<std::chrono::milliseconds>(now - last_sync_time).count() >= _fsync_interval_ms)
+				{
+					_sync_callback();
+
+					last_sync_time = now;
+					need_to_sync = false;
+				}
+			}
+		}
+
+		// Write the remaining logs
+		Drain(entries);
+
+		if ((_fsync_interval_ms > 0) && (_sync_callback != nullptr))
+		{
+			_sync_callback();
+		}
+	}
+}  // namespace ov
@@ -0,0 +1,127 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "./log.h"
+#include "./string.h"
+
+// How long the writer thread sleeps when nobody wakes it up
+#define OV_LOG_ASYNC_FLUSH_INTERVAL_MS 10
+
+namespace ov
+{
+	// Moves log writing (console and file) off the caller's thread
+	//
+	// Each logging thread owns a single-producer/single-consumer ring, so Push() never takes a lock.
+	// The writer thread drains all rings, restores the order using a global sequence number,
+	// and hands the batch to the flush callback at once.
+	class LogAsyncWriter
+	{
+	public:
+		struct Entry
+		{
+			uint64_t sequence = 0;
+			bool show_format = true;
+			OVLogLevel level = OVLogLevelInformation;
+			String log;
+		};
+
+		// Called with the entries in the order of Push() (Calls never overlap)
+		using FlushCallback = std::function<void(const std::vector<Entry> &entries)>;
+		// Called from the writer thread every fsync_interval_ms
+		using SyncCallback = std::function<void()>;
+
+		LogAsyncWriter(size_t queue_size, OVLogOverflowPolicy overflow_policy, int fsync_interval_ms,
+					   FlushCallback flush_callback, SyncCallback sync_callback);
+		~LogAsyncWriter();
+
+		bool Start();
+		// Writes all pending logs before returning
+		void Stop();
+
+		// Returns false if the log is dropped
+		bool Push(bool show_format, OVLogLevel level, String log);
+		// Writes the pending logs and then the log on the caller's thread
+		void Flush(bool show_format, OVLogLevel level, String log);
+
+		bool IsRunning() const
+		{
+			return _running;
+		}
+
+		size_t GetQueueSize() const
+		{
+			return _queue_size;
+		}
+
+		OVLogOverflowPolicy GetOverflowPolicy() const
+		{
+			return _overflow_policy;
+		}
+
+		int GetFsyncIntervalMs() const
+		{
+			return _fsync_interval_ms;
+		}
+
+		uint64_t GetDroppedCount() const
+		{
+			return _dropped_count;
+		}
+
+		class ThreadBuffer;
+
+	private:
+		std::shared_ptr<ThreadBuffer> GetThreadBuffer();
+
+		void WakeUp();
+		void ThreadProc();
+		// Writes the pending logs followed by extra_entry (if not nullptr)
+		// Returns the number of entries written
+		size_t Drain(std::vector<Entry> &entries, Entry *extra_entry = nullptr);
+
+		// Used to detect a thread buffer that belongs to a previous writer
+		const uint64_t _id;
+
+		const size_t _queue_size;
+		const OVLogOverflowPolicy _overflow_policy;
+		const int _fsync_interval_ms;
+
+		FlushCallback _flush_callback;
+		SyncCallback _sync_callback;
+
+		std::atomic<bool> _running{false};
+		std::thread _thread;
+
+		std::mutex _wake_mutex;
+		std::condition_variable _wake_condition;
+
+		// Used by OVLogOverflowPolicyBlock to wait for the writer thread to make room
+		std::mutex _space_mutex;
+		std::condition_variable _space_condition;
+
+		std::mutex _buffer_list_mutex;
+		std::vector<std::shared_ptr<ThreadBuffer>> _buffer_list;
+
+		// Serializes Drain(), so the writer thread and Flush() never consume the buffers or call _flush_callback at the same time
+		std::mutex _drain_mutex;
+
+		std::atomic<uint64_t> _sequence{0};
+		std::atomic<uint64_t> _dropped_count{0};
+		// Number of dropped logs already reported to the log file (Protected by _drain_mutex)
+		uint64_t _reported_dropped_count = 0;
+	};
+}  // namespace ov
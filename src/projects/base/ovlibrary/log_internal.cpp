@@ -52,6 +52,25 @@
 
 namespace ov
 {
+	namespace
+	{
+		constexpr const char *LOG_COLOR_PREFIX[] = {
+			OV_LOG_COLOR_FG_BLUE,
+			OV_LOG_COLOR_FG_CYAN,
+			OV_LOG_COLOR_FG_WHITE,
+			OV_LOG_COLOR_FG_YELLOW,
+			OV_LOG_COLOR_FG_BR_RED,
+			OV_LOG_COLOR_FG_BR_WHITE OV_LOG_COLOR_BG_RED};
+
+		constexpr const char *LOG_COLOR_SUFFIX[] = {
+			OV_LOG_COLOR_RESET,
+			OV_LOG_COLOR_RESET,
+			OV_LOG_COLOR_RESET,
+			OV_LOG_COLOR_RESET,
+			OV_LOG_COLOR_RESET,
+			OV_LOG_COLOR_RESET};
+	}  // namespace
+
 	LogInternal::LogInternal(std::string log_file_name) noexcept
 		: _level(OVLogLevelTrace),
 		  _log_file(log_file_name)
@@ -60,12 +79,28 @@ namespace ov
 
 	LogInternal::~LogInternal()
 	{
+		auto async_writer = _async_writer.exchange(nullptr);
+
+		if (async_writer != nullptr)
+		{
+			async_writer->Stop();
+		}
+
 		_released = true;
 	}
 
 	void LogInternal::SetLogLevel(OVLogLevel level)
 	{
+		if (_released)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(_mutex);
+
 		_level = level;
+
+		UpdateEnabledMasks();
 	}
 
 	void LogInternal::ResetEnable()
@@ -79,6 +114,8 @@ namespace ov
 
 		_enable_map.clear();
 		_enable_list.clear();
+
+		UpdateEnabledMasks();
 	}
 
 	bool LogInternal::IsEnabled(const char *tag, OVLogLevel level)
@@ -88,8 +125,77 @@ namespace ov
 			return false;
 		}
 
+		return ((__atomic_load_n(GetEnabledMaskWord(tag), __ATOMIC_RELAXED) >> level) & 0x01) != 0;
+	}
+
+	const uint32_t *LogInternal::GetEnabledMaskWord(const char *tag)
+	{
+		// Used after the instance is released
+		static const uint32_t disabled_mask = 0;
+
+		if (_released)
+		{
+			return &disabled_mask;
+		}
+
+		if (tag == nullptr)
+		{
+			tag = "";
+		}
+
 		std::lock_guard<std::mutex> lock(_mutex);
 
+		auto item = _enabled_mask_map.find(tag);
+
+		if (item != _enabled_mask_map.end())
+		{
+			return item->second;
+		}
+
+		auto enabled_mask = new uint32_t(GetEnabledMask(tag));
+		_enabled_mask_map[tag] = enabled_mask;
+
+		return enabled_mask;
+	}
+
+	uint32_t LogInternal::GetEnabledMask(const char *tag)
+	{
+		auto &enable_item = FindEnableItem(tag);
+		uint32_t enabled_mask = 0;
+
+		for (int level = OVLogLevelTrace; level <= OVLogLevelCritical; level++)
+		{
+			if (level < _level)
+			{
+				// Disabled log level
+				continue;
+			}
+
+			bool is_enabled = (level >= enable_item.level)
+								  // Returns whether the log level for the tag is activated
+								  ? enable_item.is_enabled
+								  // Levels below level behave as opposed to being activated
+								  : (enable_item.is_enabled == false);
+
+			if (is_enabled)
+			{
+				enabled_mask |= (1 << level);
+			}
+		}
+
+		return enabled_mask;
+	}
+
+	void LogInternal::UpdateEnabledMasks()
+	{
+		for (auto &item : _enabled_mask_map)
+		{
+			__atomic_store_n(item.second, GetEnabledMask(item.first.CStr()), __ATOMIC_RELAXED);
+		}
+	}
+
+	const LogInternal::EnableItem &LogInternal::FindEnableItem(const char *tag)
+	{
 		auto item = _enable_map.find(tag);
 
 		if (item == _enable_map.cend())
@@ -118,22 +224,11 @@ namespace ov
 
 			item = _enable_map.find(tag);
 
-			if (item == _enable_map.cend())
-			{
-				// Item must be added
-				OV_ASSERT2(false);
-				return false;
-			}
+			// Item must be added
+			OV_ASSERT2(item != _enable_map.cend());
 		}
 
-		if (level >= item->second.level)
-		{
-			// Returns whether the log level for the tag is activated
-			return item->second.is_enabled;
-		}
-
-		// Levels below level behave as opposed to being activated
-		return (item->second.is_enabled == false);
+		return item->second;
 	}
 
 	bool LogInternal::SetEnable(const char *tag_regex, OVLogLevel level, bool is_enabled)
@@ -170,6 +265,8 @@ namespace ov
 				item->is_enabled = is_enabled;
 			}
 
+			UpdateEnabledMasks();
+
 			return true;
 		}
 		catch (const std::regex_error &e)
@@ -191,17 +288,27 @@ namespace ov
 			return;
 		}
 
-		if (tag == nullptr)
+		if (IsEnabled(tag, level) == false)
 		{
-			tag = "";
+			// Disabled log level for the tag
+			return;
 		}
 
-		if (IsEnabled(tag, level) == false)
+		Write(show_format, level, tag, file, line, method, format, arg_list);
+	}
+
+	void LogInternal::Write(bool show_format, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, va_list &arg_list)
+	{
+		if (_released)
 		{
-			// Disabled log level for the tag
 			return;
 		}
 
+		if (tag == nullptr)
+		{
+			tag = "";
+		}
+
 		constexpr const char *log_level[] = {
 			"T",
 			"D",
@@ -210,22 +317,6 @@ namespace ov
 			"E",
 			"C"};
 
-		constexpr const char *color_prefix[] = {
-			OV_LOG_COLOR_FG_BLUE,
-			OV_LOG_COLOR_FG_CYAN,
-			OV_LOG_COLOR_FG_WHITE,
-			OV_LOG_COLOR_FG_YELLOW,
-			OV_LOG_COLOR_FG_BR_RED,
-			OV_LOG_COLOR_FG_BR_WHITE OV_LOG_COLOR_BG_RED};
-
-		constexpr const char *color_suffix[] = {
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET};
-
 		// Obtain current time in milliseconds
 		auto current	 = std::chrono::system_clock::now();
 		auto mseconds	 = std::chrono::duration_cast<std::chrono::milliseconds>(current.time_since_epoch()).count() % 1000;
@@ -335,16 +426,41 @@ namespace ov
 
 		// Append messages
 		log.AppendVFormat(format, arg_list);
+
+		auto async_writer = _async_writer.load();
+
+		if (async_writer != nullptr)
+		{
+			if (level == OVLogLevelCritical)
+			{
+				// Critical logs are written immediately because the process may be about to terminate,
+				// but after the pending logs so they don't overtake the earlier logs of the same thread
+				async_writer->Flush(show_format, level, std::move(log));
+				return;
+			}
+
+			if (async_writer->IsRunning())
+			{
+				async_writer->Push(show_format, level, std::move(log));
+				return;
+			}
+		}
+
+		WriteLog(show_format, level, log);
+	}
+
+	void LogInternal::WriteLog(bool show_format, OVLogLevel level, const ov::String &log)
+	{
 		if (show_format)
 		{
 			if (level < OVLogLevelWarning)
 			{
-				::fprintf(stdout, "%s%s%s\n", color_prefix[level], log.CStr(), color_suffix[level]);
+				::fprintf(stdout, "%s%s%s\n", LOG_COLOR_PREFIX[level], log.CStr(), LOG_COLOR_SUFFIX[level]);
 				::fflush(stdout);
 			}
 			else
 			{
-				::fprintf(stderr, "%s%s%s\n", color_prefix[level], log.CStr(), color_suffix[level]);
+				::fprintf(stderr, "%s%s%s\n", LOG_COLOR_PREFIX[level], log.CStr(), LOG_COLOR_SUFFIX[level]);
 				::fflush(stderr);
 			}
 		}
@@ -352,6 +468,50 @@ namespace ov
 		_log_file.Write(log.CStr());
 	}
 
+	void LogInternal::WriteLogs(const std::vector<LogAsyncWriter::Entry> &entries)
+	{
+		ov::String file_log;
+		bool stdout_written = false;
+		bool stderr_written = false;
+
+		for (const auto &entry : entries)
+		{
+			if (entry.show_format)
+			{
+				if (entry.level < OVLogLevelWarning)
+				{
+					::fprintf(stdout, "%s%s%s\n", LOG_COLOR_PREFIX[entry.level], entry.log.CStr(), LOG_COLOR_SUFFIX[entry.level]);
+					stdout_written = true;
+				}
+				else
+				{
+					::fprintf(stderr, "%s%s%s\n", LOG_COLOR_PREFIX[entry.level], entry.log.CStr(), LOG_COLOR_SUFFIX[entry.level]);
+					stderr_written = true;
+				}
+			}
+
+			if (file_log.IsEmpty() == false)
+			{
+				file_log.Append('\n');
+			}
+
+			file_log.Append(entry.log);
+		}
+
+		if (stdout_written)
+		{
+			::fflush(stdout);
+		}
+
+		if (stderr_written)
+		{
+			::fflush(stderr);
+		}
+
+		// Write all logs of the batch at once
+		_log_file.Write(file_log.CStr());
+	}
+
 	void LogInternal::SetLogPath(const char *log_path)
 	{
 		if (_released)
@@ -371,4 +531,66 @@ namespace ov
 
 		return _log_file.GetLogPath();
 	}
+
+	void LogInternal::SetAsync(bool enable, size_t queue_size, OVLogOverflowPolicy overflow_policy, int fsync_interval_ms)
+	{
+		if (_released)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(_async_mutex);
+
+		auto old_writer = _async_writer.load();
+
+		if (old_writer != nullptr)
+		{
+			if (enable &&
+				(old_writer->GetQueueSize() == queue_size) &&
+				(old_writer->GetOverflowPolicy() == overflow_policy) &&
+				(old_writer->GetFsyncIntervalMs() == fsync_interval_ms))
+			{
+				// Not changed
+				return;
+			}
+
+			// Logs are written synchronously until the new writer is started
+			_async_writer = nullptr;
+			old_writer->Stop();
+		}
+
+		if (enable == false)
+		{
+			return;
+		}
+
+		auto new_writer = std::make_unique<LogAsyncWriter>(
+			queue_size, overflow_policy, fsync_interval_ms,
+			[this](const std::vector<LogAsyncWriter::Entry> &entries) {
+				WriteLogs(entries);
+			},
+			[this]() {
+				_log_file.Sync();
+			});
+
+		if (new_writer->Start())
+		{
+			_async_writer = new_writer.get();
+			_async_writer_list.push_back(std::move(new_writer));
+		}
+	}
+
+	uint64_t LogInternal::GetDroppedCount()
+	{
+		std::lock_guard<std::mutex> lock(_async_mutex);
+
+		uint64_t dropped_count = 0;
+
+		for (const auto &writer : _async_writer_list)
+		{
+			dropped_count += writer->GetDroppedCount();
+		}
+
+		return dropped_count;
+	}
 }  // namespace ov
@@ -12,15 +12,18 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <atomic>
 #include <chrono>
 #include <cstdio>
 #include <ctime>
+#include <memory>
 #include <mutex>
 #include <regex>
 #include <unordered_map>
 
 #include "./assert.h"
 #include "./log.h"
+#include "./log_async_writer.h"
 #include "./log_write.h"
 #include "./string.h"
 
@@ -46,6 +49,8 @@ namespace ov
 		void SetLogLevel(OVLogLevel level);
 		void ResetEnable();
 		bool IsEnabled(const char *tag, OVLogLevel level);
+		// Returns the address of the enabled mask of the tag, which is updated whenever the filter rules are changed
+		const uint32_t *GetEnabledMaskWord(const char *tag);
 
 		/// @param tag_regex pattern of a tag
 		/// @param level Log level to display for tag
@@ -64,11 +69,30 @@ namespace ov
 		bool SetEnable(const char *tag_regex, OVLogLevel level, bool is_enabled);
 
 		void Log(bool show_format, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, va_list &arg_list);
+		// Same as Log(), but the caller has already checked the level of the tag
+		void Write(bool show_format, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, va_list &arg_list);
 
 		void SetLogPath(const char *log_path);
 		const char *GetLogPath() const;
 
+		void SetAsync(bool enable, size_t queue_size, OVLogOverflowPolicy overflow_policy, int fsync_interval_ms);
+		uint64_t GetDroppedCount();
+
 	protected:
+		struct EnableItem;
+
+		// Must be called while _mutex is locked
+		const EnableItem &FindEnableItem(const char *tag);
+		// Bit N is set if OVLogLevel N of the tag is enabled (Must be called while _mutex is locked)
+		uint32_t GetEnabledMask(const char *tag);
+		// Recalculates all words of _enabled_mask_map (Must be called while _mutex is locked)
+		void UpdateEnabledMasks();
+
+		// Writes the log to the console and the log file on the caller's thread
+		void WriteLog(bool show_format, OVLogLevel level, const ov::String &log);
+		// Called from the writer thread of _async_writer
+		void WriteLogs(const std::vector<LogAsyncWriter::Entry> &entries);
+
 		// This variable is used to avoid the problem of referencing incorrect heap if the log is written after LogInternal instance is released.
 		// This situation occurs when the LogInternal instance declared static is disabled just before the OME is terminated and then logs are written by another module.
 		bool _released = false;
@@ -93,5 +117,16 @@ namespace ov
 		// key: tag
 		// value: is_enabled
 		std::unordered_map<ov::String, EnableItem> _enable_map;
+
+		// Enabled masks cached by the call sites of the logging macros
+		// key: tag
+		// value: enabled mask (never freed, because a call site may read it at any time until the process exits)
+		std::unordered_map<ov::String, uint32_t *> _enabled_mask_map;
+
+		std::mutex _async_mutex;
+		// nullptr if logs are written synchronously
+		std::atomic<LogAsyncWriter *> _async_writer{nullptr};
+		// Stopped writers are kept until the instance is released, because another thread may still be using them
+		std::vector<std::unique_ptr<LogAsyncWriter>> _async_writer_list;
 	};
 }  // namespace ov
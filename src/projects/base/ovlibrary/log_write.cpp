@@ -10,6 +10,7 @@
 #include "log_write.h"
 
 #include <sys/stat.h>
+#include <unistd.h>
 
 #include <iomanip>
 #include <iostream>
@@ -37,6 +38,15 @@ namespace ov
 		_include_date_in_filename = include_date_in_filename;
 	}
 
+	LogWrite::~LogWrite()
+	{
+		if (_log_stream != nullptr)
+		{
+			::fclose(_log_stream);
+			_log_stream = nullptr;
+		}
+	}
+
 	void LogWrite::SetLogPath(const char *log_path)
 	{
 		_log_path = log_path;
@@ -64,8 +74,12 @@ namespace ov
 		}
 
 		std::lock_guard<std::mutex> lock_guard(_log_stream_mutex);
-		_log_stream.close();
-		_log_stream.clear();
+
+		if (_log_stream != nullptr)
+		{
+			::fclose(_log_stream);
+			_log_stream = nullptr;
+		}
 
 		if (_include_date_in_filename == true)
 		{
@@ -73,11 +87,11 @@ namespace ov
 			::localtime_r(&time, &local_time);
 			std::ostringstream logfile;
 			logfile << _log_file << "." << std::put_time(&local_time, "%Y%m%d");
-			_log_stream.open(logfile.str().c_str(), std::ofstream::out | std::ofstream::app);
+			_log_stream = ::fopen(logfile.str().c_str(), "a");
 		}
 		else
 		{
-			_log_stream.open(_log_file, std::ofstream::out | std::ofstream::app);
+			_log_stream = ::fopen(_log_file.c_str(), "a");
 		}
 	}
 
@@ -95,7 +109,7 @@ namespace ov
 		std::tm local_time{};
 		::localtime_r(&time, &local_time);
 
-		if (!_log_stream.is_open() || _log_stream.fail())
+		if ((_log_stream == nullptr) || ::ferror(_log_stream))
 		{
 			OpenNewFile(time);
 		}
@@ -121,7 +135,23 @@ namespace ov
 		}
 
 		std::lock_guard<std::mutex> lock_guard(_log_stream_mutex);
-		_log_stream << log << std::endl;
-		_log_stream.flush();
+
+		if (_log_stream != nullptr)
+		{
+			::fputs(log, _log_stream);
+			::fputc('\n', _log_stream);
+			::fflush(_log_stream);
+		}
+	}
+
+	void LogWrite::Sync()
+	{
+		std::lock_guard<std::mutex> lock_guard(_log_stream_mutex);
+
+		if (_log_stream != nullptr)
+		{
+			::fflush(_log_stream);
+			::fsync(::fileno(_log_stream));
+		}
 	}
 }  // namespace ov
\ No newline at end of file
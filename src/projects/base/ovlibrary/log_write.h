@@ -8,8 +8,10 @@
 //==============================================================================
 #pragma once
 
-#include <fstream>
+#include <cstdio>
+#include <ctime>
 #include <mutex>
+#include <string>
 
 #define OV_LOG_DIR "logs"
 #define OV_LOG_DIR_SVC "/var/log/ovenmediaengine"
@@ -21,8 +23,10 @@ namespace ov
 	{
 	public:
 		LogWrite(std::string log_file_name, bool include_date_in_filename = false);
-		virtual ~LogWrite() = default;
+		virtual ~LogWrite();
 		void Write(const char *log, std::time_t time = 0);
+		// Flushes the written logs to the disk (fsync)
+		void Sync();
 		void SetLogPath(const char *log_path);
 		const char *GetLogPath() const;
 
@@ -32,7 +36,7 @@ namespace ov
 		void OpenNewFile(std::time_t time = 0);
 
 		std::mutex _log_stream_mutex;
-		std::ofstream _log_stream;
+		FILE *_log_stream = nullptr;
 		int _last_day;
 		std::string _log_path;
 		std::string _log_file_name;
@@ -0,0 +1,330 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "memory_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <set>
+#include <vector>
+
+namespace ov
+{
+	namespace
+	{
+		constexpr size_t MIN_BLOCK_SHIFT = 5;  // 32 bytes
+		constexpr size_t MIN_BLOCK_SIZE = (1 << MIN_BLOCK_SHIFT);
+		constexpr size_t SIZE_CLASS_COUNT = 12;	 // 32 ~ 64KB
+		static_assert((MIN_BLOCK_SIZE << (SIZE_CLASS_COUNT - 1)) == OV_MEMORY_POOL_MAX_BLOCK_SIZE, "Size classes must cover OV_MEMORY_POOL_MAX_BLOCK_SIZE");
+
+		inline size_t GetSizeClass(size_t size)
+		{
+			if (size <= MIN_BLOCK_SIZE)
+			{
+				return 0;
+			}
+
+			// ceil(log2(size)) - MIN_BLOCK_SHIFT
+			return (64 - __builtin_clzll(static_cast<unsigned long long>(size - 1))) - MIN_BLOCK_SHIFT;
+		}
+
+		inline size_t GetBlockSize(size_t size_class)
+		{
+			return MIN_BLOCK_SIZE << size_class;
+		}
+
+		// Counters are updated by the owner thread only, and summed up by GetStats()
+		struct ThreadStats
+		{
+			std::atomic<uint64_t> hit_count{0};
+			std::atomic<uint64_t> miss_count{0};
+			std::atomic<uint64_t> bypass_count{0};
+			std::atomic<int64_t> bytes_in_use{0};
+			std::atomic<int64_t> bytes_cached{0};
+
+			void Add(std::atomic<uint64_t> &counter, uint64_t value)
+			{
+				counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+			}
+
+			void Add(std::atomic<int64_t> &counter, int64_t value)
+			{
+				counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+			}
+		};
+
+		struct Depot
+		{
+			std::mutex mutex;
+			std::vector<void *> blocks;
+		};
+
+		class ThreadCache;
+
+		// Shared state. Intentionally leaked so that it outlives thread caches and static objects
+		struct PoolState
+		{
+			Depot depots[SIZE_CLASS_COUNT];
+
+			std::mutex registry_mutex;
+			std::set<ThreadCache *> thread_caches;
+			// Counters of the threads that have already exited
+			MemoryPool::Stats retired_stats;
+		};
+
+		PoolState *GetPoolState()
+		{
+			static auto state = new PoolState();
+			return state;
+		}
+
+		// Set when the cache of the current thread is destroyed. Blocks released after that go to the system allocator
+		thread_local bool thread_cache_destroyed = false;
+
+		class ThreadCache
+		{
+		public:
+			ThreadCache()
+			{
+				auto state = GetPoolState();
+				std::lock_guard lock_guard(state->registry_mutex);
+				state->thread_caches.insert(this);
+			}
+
+			~ThreadCache()
+			{
+				thread_cache_destroyed = true;
+
+				auto state = GetPoolState();
+
+				for (size_t size_class = 0; size_class < SIZE_CLASS_COUNT; size_class++)
+				{
+					auto &blocks = _blocks[size_class];
+					ReleaseToDepot(size_class, blocks.size());
+				}
+
+				std::lock_guard lock_guard(state->registry_mutex);
+				state->thread_caches.erase(this);
+
+				state->retired_stats.hit_count += stats.hit_count;
+				state->retired_stats.miss_count += stats.miss_count;
+				state->retired_stats.bypass_count += stats.bypass_count;
+				state->retired_stats.bytes_in_use += stats.bytes_in_use;
+				state->retired_stats.bytes_cached += stats.bytes_cached;
+			}
+
+			void *Allocate(size_t size_class)
+			{
+				auto &blocks = _blocks[size_class];
+				auto block_size = static_cast<int64_t>(GetBlockSize(size_class));
+
+				if (blocks.empty())
+				{
+					RefillFromDepot(size_class);
+				}
+
+				stats.Add(stats.bytes_in_use, block_size);
+
+				if (blocks.empty() == false)
+				{
+					auto block = blocks.back();
+					blocks.pop_back();
+
+					stats.Add(stats.hit_count, 1);
+					stats.Add(stats.bytes_cached, -block_size);
+
+					return block;
+				}
+
+				stats.Add(stats.miss_count, 1);
+
+				return ::operator new(block_size);
+			}
+
+			void Deallocate(void *pointer, size_t size_class)
+			{
+				auto &blocks = _blocks[size_class];
+				auto block_size = GetBlockSize(size_class);
+
+				blocks.push_back(pointer);
+
+				stats.Add(stats.bytes_in_use, -static_cast<int64_t>(block_size));
+				stats.Add(stats.bytes_cached, block_size);
+
+				auto max_blocks = std::max<size_t>(OV_MEMORY_POOL_THREAD_CACHE_BYTES / block_size, 8);
+				if (blocks.size() > max_blocks)
+				{
+					// Hand over half of the cache so the thread does not bounce at the limit
+					ReleaseToDepot(size_class, blocks.size() / 2);
+				}
+			}
+
+			ThreadStats stats;
+
+		private:
+			void RefillFromDepot(size_t size_class)
+			{
+				auto &depot = GetPoolState()->depots[size_class];
+				auto &blocks = _blocks[size_class];
+				auto block_size = GetBlockSize(size_class);
+				auto refill_count = std::max<size_t>(OV_MEMORY_POOL_THREAD_CACHE_BYTES / block_size / 2, 4);
+
+				std::lock_guard lock_guard(depot.mutex);
+
+				auto count = std::min(refill_count, depot.blocks.size());
+				if (count == 0)
+				{
+					return;
+				}
+
+				blocks.insert(blocks.end(), depot.blocks.end() - count, depot.blocks.end());
+				depot.blocks.resize(depot.blocks.size() - count);
+
+				stats.Add(stats.bytes_cached, static_cast<int64_t>(count * block_size));
+			}
+
+			void ReleaseToDepot(size_t size_class, size_t count)
+			{
+				auto &depot = GetPoolState()->depots[size_class];
+				auto &blocks = _blocks[size_class];
+				auto block_size = GetBlockSize(size_class);
+				auto max_depot_blocks = OV_MEMORY_POOL_DEPOT_BYTES / block_size;
+
+				size_t moved_count = 0;
+
+				{
+					std::lock_guard lock_guard(depot.mutex);
+
+					while ((count > 0) && (blocks.empty() == false))
+					{
+						auto block = blocks.back();
+						blocks.pop_back();
+						count--;
+						moved_count++;
+
+						if (depot.blocks.size() < max_depot_blocks)
+						{
+							depot.blocks.push_back(block);
+						}
+						else
+						{
+							::operator delete(block);
+						}
+					}
+				}
+
+				// Blocks in the depot are accounted by GetStats()
+				stats.Add(stats.bytes_cached, -static_cast<int64_t>(moved_count * block_size));
+			}
+
+			std::vector<void *> _blocks[SIZE_CLASS_COUNT];
+		};
+
+		ThreadCache *GetThreadCache()
+		{
+			if (thread_cache_destroyed)
+			{
+				return nullptr;
+			}
+
+			thread_local ThreadCache thread_cache;
+			return &thread_cache;
+		}
+	}  // namespace
+
+	MemoryPool *MemoryPool::GetInstance()
+	{
+		static auto instance = new MemoryPool();
+		return instance;
+	}
+
+	void *MemoryPool::Allocate(size_t size)
+	{
+		if (size > OV_MEMORY_POOL_MAX_BLOCK_SIZE)
+		{
+			auto thread_cache = GetThreadCache();
+
+			if (thread_cache != nullptr)
+			{
+				thread_cache->stats.Add(thread_cache->stats.bypass_count, 1);
+				thread_cache->stats.Add(thread_cache->stats.bytes_in_use, static_cast<int64_t>(size));
+			}
+
+			return ::operator new(size);
+		}
+
+		auto size_class = GetSizeClass(size);
+		auto thread_cache = GetThreadCache();
+
+		if (thread_cache == nullptr)
+		{
+			return ::operator new(GetBlockSize(size_class));
+		}
+
+		return thread_cache->Allocate(size_class);
+	}
+
+	void MemoryPool::Deallocate(void *pointer, size_t size) noexcept
+	{
+		if (pointer == nullptr)
+		{
+			return;
+		}
+
+		auto thread_cache = GetThreadCache();
+
+		if (size > OV_MEMORY_POOL_MAX_BLOCK_SIZE)
+		{
+			if (thread_cache != nullptr)
+			{
+				thread_cache->stats.Add(thread_cache->stats.bytes_in_use, -static_cast<int64_t>(size));
+			}
+
+			::operator delete(pointer);
+			return;
+		}
+
+		if (thread_cache == nullptr)
+		{
+			::operator delete(pointer);
+			return;
+		}
+
+		thread_cache->Deallocate(pointer, GetSizeClass(size));
+	}
+
+	MemoryPool::Stats MemoryPool::GetStats() const
+	{
+		auto state = GetPoolState();
+		std::lock_guard lock_guard(state->registry_mutex);
+
+		Stats stats = state->retired_stats;
+
+		for (auto thread_cache : state->thread_caches)
+		{
+			auto &thread_stats = thread_cache->stats;
+
+			stats.hit_count += thread_stats.hit_count.load(std::memory_order_relaxed);
+			stats.miss_count += thread_stats.miss_count.load(std::memory_order_relaxed);
+			stats.bypass_count += thread_stats.bypass_count.load(std::memory_order_relaxed);
+			stats.bytes_in_use += thread_stats.bytes_in_use.load(std::memory_order_relaxed);
+			stats.bytes_cached += thread_stats.bytes_cached.load(std::memory_order_relaxed);
+		}
+
+		for (size_t size_class = 0; size_class < SIZE_CLASS_COUNT; size_class++)
+		{
+			auto &depot = state->depots[size_class];
+			std::lock_guard depot_lock_guard(depot.mutex);
+
+			stats.bytes_cached += static_cast<int64_t>(depot.blocks.size() * GetBlockSize(size_class));
+		}
+
+		return stats;
+	}
+}  // namespace ov
@@ -0,0 +1,104 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+// Blocks larger than this are not pooled
+#define OV_MEMORY_POOL_MAX_BLOCK_SIZE (64 * 1024)
+// Each thread keeps at most this many bytes per size class before returning blocks to the shared depot
+#define OV_MEMORY_POOL_THREAD_CACHE_BYTES (256 * 1024)
+// The shared depot keeps at most this many bytes per size class before returning blocks to the system
+#define OV_MEMORY_POOL_DEPOT_BYTES (8 * 1024 * 1024)
+
+namespace ov
+{
+	// Size-classed memory pool with per-thread caches
+	//
+	// Requests are rounded up to a power of two (32 bytes ~ OV_MEMORY_POOL_MAX_BLOCK_SIZE).
+	// Freed blocks are cached in the freeing thread, and the surplus is moved to a shared depot
+	// so that a producer thread can reuse blocks released by a consumer thread.
+	// Every block is obtained from ::operator new, so it is always safe to release a block to the system.
+	class MemoryPool
+	{
+	public:
+		struct Stats
+		{
+			// Allocations served from a thread cache or the depot
+			uint64_t hit_count = 0;
+			// Allocations that had to go to the system allocator
+			uint64_t miss_count = 0;
+			// Allocations larger than OV_MEMORY_POOL_MAX_BLOCK_SIZE
+			uint64_t bypass_count = 0;
+			// Bytes handed out to callers (rounded up to the size class) and not yet returned
+			int64_t bytes_in_use = 0;
+			// Bytes kept in the thread caches and the depot
+			int64_t bytes_cached = 0;
+		};
+
+		// Never destroyed, blocks may be released during static destruction
+		static MemoryPool *GetInstance();
+
+		void *Allocate(size_t size);
+		void Deallocate(void *pointer, size_t size) noexcept;
+
+		Stats GetStats() const;
+
+	private:
+		MemoryPool() = default;
+	};
+
+	// std::allocator compatible wrapper of ov::MemoryPool
+	template <typename T>
+	class PoolAllocator
+	{
+	public:
+		using value_type = T;
+
+		PoolAllocator() noexcept = default;
+
+		template <typename U>
+		PoolAllocator(const PoolAllocator<U> &) noexcept
+		{
+		}
+
+		T *allocate(size_t count)
+		{
+			return static_cast<T *>(MemoryPool::GetInstance()->Allocate(count * sizeof(T)));
+		}
+
+		void deallocate(T *pointer, size_t count) noexcept
+		{
+			MemoryPool::GetInstance()->Deallocate(pointer, count * sizeof(T));
+		}
+
+		template <typename U>
+		bool operator==(const PoolAllocator<U> &) const noexcept
+		{
+			return true;
+		}
+
+		template <typename U>
+		bool operator!=(const PoolAllocator<U> &) const noexcept
+		{
+			return false;
+		}
+	};
+
+	// Same as std::make_shared(), but the object and the control block are allocated from ov::MemoryPool
+	template <typename T, typename... Targs>
+	inline std::shared_ptr<T> MakePooledShared(Targs &&...args)
+	{
+		static_assert(std::is_array_v<T> == false, "Arrays are not supported");
+
+		return std::allocate_shared<T>(PoolAllocator<std::remove_cv_t<T>>(), std::forward<Targs>(args)...);
+	}
+}  // namespace ov
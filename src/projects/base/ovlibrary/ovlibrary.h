@@ -21,10 +21,12 @@
 #include "./delay_queue.h"
 #include "./dump_utilities.h"
 #include "./enable_shared_from_this.h"
+#include "./epoch_reclaimer.h"
 #include "./error.h"
 #include "./json.h"
 #include "./log.h"
 #include "./memory_utilities.h"
+#include "./memory_pool.h"
 #include "./map_utilities.h"
 #include "./ovdata_structure.h"
 #include "./path_manager.h"
@@ -50,6 +52,7 @@
 #include "./uuid.h"
 #include "./precise_timer.h"
 #include "./files.h"
+#include "./file_region.h"
 #include "./sequencial_map.h"
 
 #include "./logger/logger.h"
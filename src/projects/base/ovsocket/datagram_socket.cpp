@@ -81,6 +81,7 @@ namespace ov
 	bool DatagramSocket::CloseInternal(SocketState close_reason)
 	{
 		_callback = nullptr;
+		_datagram_batch_callback = nullptr;
 
 		if (Socket::CloseInternal(close_reason))
 		{
@@ -95,33 +96,64 @@ namespace ov
 	{
 		logtt("Trying to read UDP packets...");
 
-		auto data = std::make_shared<ov::Data>(UdpBufferSize);
+		if (_recv_buffer_list.empty())
+		{
+			_recv_buffer_list.reserve(OV_SOCKET_MAX_RECV_BATCH_MESSAGES);
 
-		SocketAddressPair address_pair;
+			for (int index = 0; index < OV_SOCKET_MAX_RECV_BATCH_MESSAGES; index++)
+			{
+				_recv_buffer_list.push_back(std::make_shared<ov::Data>(UdpBufferSize));
+			}
+
+			_recv_address_pair_list.resize(OV_SOCKET_MAX_RECV_BATCH_MESSAGES);
+		}
+
+		Datagram datagrams[OV_SOCKET_MAX_RECV_BATCH_MESSAGES];
 
 		while (true)
 		{
-			auto error = RecvFrom(data, &address_pair);
+			size_t received_count = 0;
+			auto error = RecvBatchFrom(_recv_buffer_list.data(), _recv_address_pair_list.data(), _recv_buffer_list.size(), &received_count);
 
-			if (error == nullptr)
+			if (error != nullptr)
 			{
-				if (data->GetLength() == 0L)
-				{
-					// Try later
-					break;
-				}
-				else
+				// An error occurred
+				break;
+			}
+
+			if (received_count == 0)
+			{
+				// Try later
+				break;
+			}
+
+			auto self = GetSharedPtrAs<DatagramSocket>();
+
+			for (size_t index = 0; index < received_count; index++)
+			{
+				auto &buffer = _recv_buffer_list[index];
+
+				// Copy the payload into a buffer of the exact size, so the receive buffer is never shared and
+				// recvmmsg() can write into it again without a copy-on-write
+				datagrams[index].address_pair = _recv_address_pair_list[index];
+				datagrams[index].data = ov::MakePooledShared<ov::Data>(buffer->GetData(), buffer->GetLength());
+			}
+
+			if (_datagram_batch_callback != nullptr)
+			{
+				_datagram_batch_callback(self, datagrams, received_count);
+			}
+			else if (_datagram_callback != nullptr)
+			{
+				for (size_t index = 0; index < received_count; index++)
 				{
-					if (_datagram_callback != nullptr)
-					{
-						_datagram_callback(GetSharedPtrAs<DatagramSocket>(), address_pair, data->Clone());
-					}
+					_datagram_callback(self, datagrams[index].address_pair, datagrams[index].data);
 				}
 			}
-			else
+
+			for (size_t index = 0; index < received_count; index++)
 			{
-				// An error occurred
-				break;
+				datagrams[index].data = nullptr;
 			}
 		}
 	}
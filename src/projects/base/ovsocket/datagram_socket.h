@@ -13,6 +13,15 @@
 
 namespace ov
 {
+	struct Datagram
+	{
+		SocketAddressPair address_pair;
+		std::shared_ptr<Data> data;
+	};
+
+	// Called with all datagrams read by a single recvmmsg() (datagrams[0] ~ datagrams[count - 1])
+	typedef std::function<void(const std::shared_ptr<DatagramSocket> &client, const Datagram *datagrams, size_t count)> DatagramBatchCallback;
+
 	class DatagramSocket : public Socket, public SocketAsyncInterface
 	{
 	public:
@@ -32,6 +41,13 @@ namespace ov
 					 SetAdditionalOptionsCallback callback,
 					 DatagramCallback datagram_callback);
 
+		// If the batch callback is set, it is called instead of the datagram callback of Prepare().
+		// Must be called before Prepare()
+		void SetDatagramBatchCallback(DatagramBatchCallback datagram_batch_callback)
+		{
+			_datagram_batch_callback = std::move(datagram_batch_callback);
+		}
+
 		using Socket::Close;
 		using Socket::Connect;
 		using Socket::GetState;
@@ -66,5 +82,10 @@ namespace ov
 		}
 
 		DatagramCallback _datagram_callback = nullptr;
+		DatagramBatchCallback _datagram_batch_callback = nullptr;
+
+		// Receive buffers reused by every OnReadable() (only accessed from the epoll thread)
+		std::vector<std::shared_ptr<Data>> _recv_buffer_list;
+		std::vector<SocketAddressPair> _recv_address_pair_list;
 	};
 }  // namespace ov
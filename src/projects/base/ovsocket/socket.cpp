@@ -10,8 +10,13 @@
 
 #include <arpa/inet.h>
 #include <errno.h>
+#include <netinet/udp.h>
 #include <sys/fcntl.h>
 #include <sys/ioctl.h>
+#if IS_LINUX
+#	include <linux/tls.h>
+#	include <sys/sendfile.h>
+#endif	// IS_LINUX
 #include <unistd.h>
 
 #include <algorithm>
@@ -879,6 +884,30 @@ namespace ov
 				sent_bytes = SendFromToInternal(command.address_pair, data);
 				break;
 
+			case DispatchCommand::Type::SendBatchFromTo:
+				// Datagrams that are completely sent are removed from command.segment_lengths
+				sent_bytes = SendBatchFromToInternal(command.address_pair, data, &command.segment_lengths);
+				break;
+
+			case DispatchCommand::Type::SendFile:
+				sent_bytes = SendFileInternal(command.file_region);
+				break;
+
+			case DispatchCommand::Type::EnableKtlsSend:
+				// The records encrypted in user space are all sent
+				if (EnableKtlsSendInternal(data))
+				{
+					return DispatchResult::Dispatched;
+				}
+
+				// Data queued after this command is plain text, so the connection cannot be continued
+				logae("Could not enable kTLS after sending the pending data");
+				return DispatchResult::Error;
+
+			case DispatchCommand::Type::SendKtlsRecord:
+				sent_bytes = SendKtlsRecordInternal(command.record_type, data);
+				break;
+
 			case DispatchCommand::Type::HalfClose:
 				return HalfClose();
 
@@ -895,7 +924,10 @@ namespace ov
 			}
 		}
 
-		if (sent_bytes == static_cast<ssize_t>(command.data->GetLength()))
+		auto &file_region = command.file_region;
+		const size_t length_to_send = (file_region != nullptr) ? file_region->GetLength() : data->GetLength();
+
+		if (sent_bytes == static_cast<ssize_t>(length_to_send))
 		{
 			return DispatchResult::Dispatched;
 		}
@@ -909,9 +941,17 @@ namespace ov
 		{
 			// Since some data has been sent, the time needs to be updated.
 			command.UpdateTime();
-			data = data->Subdata(sent_bytes);
 
-			logad("Part of the data has been sent: %ld bytes, left: %ld bytes (%s)", sent_bytes, data->GetLength(), command.ToString().CStr());
+			if (file_region != nullptr)
+			{
+				file_region = file_region->Subregion(sent_bytes);
+			}
+			else
+			{
+				data = data->Subdata(sent_bytes);
+			}
+
+			logad("Part of the data has been sent: %ld bytes, left: %zu bytes (%s)", sent_bytes, length_to_send - sent_bytes, command.ToString().CStr());
 		}
 		else
 		{
@@ -1238,6 +1278,248 @@ namespace ov
 		return Send((data == nullptr) ? nullptr : std::make_shared<Data>(data, length));
 	}
 
+	ssize_t Socket::SendFileInternal(const std::shared_ptr<const FileRegion> &file_region)
+	{
+		if (GetType() != SocketType::Tcp)
+		{
+			// Does not support SendFile() for UDP/SRT
+			logac("Could not send file - Invalid socket type: %s", StringFromSocketType(GetType()));
+			OV_ASSERT2(false);
+			return -1L;
+		}
+
+#if IS_LINUX
+		off_t offset = file_region->GetOffset();
+		size_t remaining_bytes = file_region->GetLength();
+		size_t total_sent_bytes = 0L;
+
+		logat("Trying to send file %zu bytes...", remaining_bytes);
+
+		while ((remaining_bytes > 0L) && (_force_stop == false))
+		{
+			// sendfile() advances <offset> by the number of bytes sent
+			const auto sent = ::sendfile(GetNativeHandle(), file_region->GetFd(), &offset, remaining_bytes);
+
+			if (sent < 0L)
+			{
+				return HandleSendError(sent, total_sent_bytes);
+			}
+
+			if (sent == 0L)
+			{
+				// The file is shorter than the region
+				logaw("Could not send file - unexpected end of file: %s", file_region->ToString().CStr());
+				STATS_COUNTER_INCREASE_ERROR();
+				return -1L;
+			}
+
+			OV_ASSERT2(static_cast<ssize_t>(remaining_bytes) >= sent);
+
+			STATS_COUNTER_INCREASE_PPS();
+
+			remaining_bytes -= sent;
+			total_sent_bytes += sent;
+
+			UpdateLastSentTime();
+		}
+
+		logat("%zu bytes sent", total_sent_bytes);
+		return total_sent_bytes;
+#else	// IS_LINUX
+		auto data = file_region->Read();
+
+		if (data == nullptr)
+		{
+			return -1L;
+		}
+
+		return SendData(data);
+#endif	// IS_LINUX
+	}
+
+#if IS_LINUX
+	// Returns the length of the crypto info of the cipher, or 0 if the cipher is not supported
+	static socklen_t GetKtlsCryptoInfoLength(const void *crypto_info)
+	{
+		switch (static_cast<const struct tls_crypto_info *>(crypto_info)->cipher_type)
+		{
+			case TLS_CIPHER_AES_GCM_128:
+				return sizeof(struct tls12_crypto_info_aes_gcm_128);
+
+			case TLS_CIPHER_AES_GCM_256:
+				return sizeof(struct tls12_crypto_info_aes_gcm_256);
+
+#	ifdef TLS_CIPHER_AES_CCM_128
+			case TLS_CIPHER_AES_CCM_128:
+				return sizeof(struct tls12_crypto_info_aes_ccm_128);
+#	endif	// TLS_CIPHER_AES_CCM_128
+
+#	ifdef TLS_CIPHER_CHACHA20_POLY1305
+			case TLS_CIPHER_CHACHA20_POLY1305:
+				return sizeof(struct tls12_crypto_info_chacha20_poly1305);
+#	endif	// TLS_CIPHER_CHACHA20_POLY1305
+		}
+
+		return 0;
+	}
+#endif	// IS_LINUX
+
+	bool Socket::EnableKtlsSend(const void *crypto_info)
+	{
+#if IS_LINUX
+		if ((crypto_info == nullptr) || (GetType() != SocketType::Tcp) || (IsSendable() == false))
+		{
+			return false;
+		}
+
+		auto length = GetKtlsCryptoInfoLength(crypto_info);
+		if (length == 0)
+		{
+			logad("Could not enable kTLS - unsupported cipher: %u", static_cast<const struct tls_crypto_info *>(crypto_info)->cipher_type);
+			return false;
+		}
+
+		// Attach the TLS ULP. Until the key is installed, the socket sends data as it is.
+		if (::setsockopt(GetNativeHandle(), SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0)
+		{
+			logad("Could not enable kTLS - TCP_ULP is not supported: %s", Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		auto crypto_info_data = std::make_shared<Data>(crypto_info, length);
+
+		std::lock_guard lock_guard(_dispatch_queue_lock);
+
+		if ((_blocking_mode == BlockingMode::Blocking) || _dispatch_queue.empty())
+		{
+			// Nothing is pending, so the key can be installed now and the caller can fall back if it fails
+			return EnableKtlsSendInternal(crypto_info_data);
+		}
+
+		// Records encrypted in user space are still in the queue, so the key is installed after they are sent
+		return AppendCommand({DispatchCommand::Type::EnableKtlsSend, crypto_info_data}, true);
+#else	// IS_LINUX
+		return false;
+#endif	// IS_LINUX
+	}
+
+	bool Socket::EnableKtlsSendInternal(const std::shared_ptr<const Data> &crypto_info)
+	{
+#if IS_LINUX
+		if (::setsockopt(GetNativeHandle(), SOL_TLS, TLS_TX, crypto_info->GetData(), static_cast<socklen_t>(crypto_info->GetLength())) != 0)
+		{
+			logaw("Could not install the kTLS transmit key: %s", Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		_ktls_send_enabled = true;
+
+		logad("kTLS is enabled");
+		return true;
+#else	// IS_LINUX
+		return false;
+#endif	// IS_LINUX
+	}
+
+	ssize_t Socket::SendKtlsRecordInternal(uint8_t record_type, const std::shared_ptr<const Data> &data)
+	{
+#if IS_LINUX
+		const size_t length = data->GetLength();
+
+		logat("Trying to send TLS record (type: %u) %zu bytes...", record_type, length);
+
+		// The kernel never leaves a non-data record half written: a record that does not fit in the send buffer is not
+		// queued at all (EAGAIN), and a short count is only returned on a record boundary (a record carries at most
+		// 16KB). So the rest is queued by the dispatcher and sent later as the next record of the same type.
+		char control[CMSG_SPACE(sizeof(uint8_t))] = {};
+
+		struct iovec iov;
+		iov.iov_base = const_cast<uint8_t *>(data->GetDataAs<uint8_t>());
+		iov.iov_len = length;
+
+		struct msghdr message = {};
+		message.msg_iov = &iov;
+		message.msg_iovlen = 1;
+		message.msg_control = control;
+		message.msg_controllen = sizeof(control);
+
+		auto cmsg = CMSG_FIRSTHDR(&message);
+		cmsg->cmsg_level = SOL_TLS;
+		cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+		cmsg->cmsg_len = CMSG_LEN(sizeof(uint8_t));
+		*CMSG_DATA(cmsg) = record_type;
+
+		const auto sent = ::sendmsg(GetNativeHandle(), &message, MSG_NOSIGNAL | ((_blocking_mode == BlockingMode::NonBlocking) ? MSG_DONTWAIT : 0));
+
+		if (sent < 0L)
+		{
+			// Nothing is sent, so the whole record will be sent again by the dispatcher (EAGAIN)
+			return HandleSendError(sent, 0L);
+		}
+
+		STATS_COUNTER_INCREASE_PPS();
+		UpdateLastSentTime();
+
+		logat("%zd bytes sent", sent);
+		return sent;
+#else	// IS_LINUX
+		return -1L;
+#endif	// IS_LINUX
+	}
+
+	bool Socket::SendKtlsRecord(uint8_t record_type, const std::shared_ptr<const Data> &data)
+	{
+		if (data == nullptr)
+		{
+			OV_ASSERT2(data != nullptr);
+			return false;
+		}
+
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking:
+				return (SendKtlsRecordInternal(record_type, data) == static_cast<ssize_t>(data->GetLength()));
+
+			case BlockingMode::NonBlocking:
+				if (IsSendable())
+				{
+					return AppendCommand({DispatchCommand::Type::SendKtlsRecord, data->Clone(), record_type}, true);
+				}
+				break;
+		}
+
+		return false;
+	}
+
+	bool Socket::SendFile(const std::shared_ptr<const FileRegion> &file_region)
+	{
+		if (file_region == nullptr)
+		{
+			OV_ASSERT2(file_region != nullptr);
+			return false;
+		}
+
+		if (file_region->GetLength() == 0)
+		{
+			return true;
+		}
+
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking:
+				return (SendFileInternal(file_region) == static_cast<ssize_t>(file_region->GetLength()));
+
+			case BlockingMode::NonBlocking:
+				if (IsSendable())
+				{
+					return AppendCommand({file_region}, true);
+				}
+				break;
+		}
+
+		return false;
+	}
+
 	ssize_t Socket::SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data)
 	{
 		if (GetType() != SocketType::Udp)
@@ -1483,6 +1765,319 @@ namespace ov
 		return SendFromTo(address_pair, (data == nullptr) ? nullptr : std::make_shared<Data>(data, length));
 	}
 
+#if IS_LINUX
+	// A run of datagrams that is passed to the kernel as a single message
+	struct BatchRun
+	{
+		size_t segment_count = 0;
+		size_t bytes = 0;
+		// Segment size for UDP GSO (0 if the run is a single datagram)
+		uint16_t gso_size = 0;
+	};
+
+	// Groups the datagrams into runs. If use_gso is true, consecutive datagrams with the same length
+	// (the last one may be shorter) are grouped into one run so that the kernel can split it using UDP GSO.
+	static size_t MakeBatchRuns(const std::vector<size_t> &segment_lengths, size_t start_index, bool use_gso, BatchRun *runs, size_t max_run_count)
+	{
+		size_t run_count = 0;
+		size_t segment_size = 0;
+		bool run_closed = true;
+
+		for (size_t index = start_index; index < segment_lengths.size(); index++)
+		{
+			const auto length = segment_lengths[index];
+
+			if ((run_closed == false) &&
+				(length <= segment_size) &&
+				(runs[run_count - 1].segment_count < OV_SOCKET_MAX_GSO_SEGMENTS) &&
+				((runs[run_count - 1].bytes + length) <= OV_SOCKET_MAX_GSO_BYTES))
+			{
+				auto &run = runs[run_count - 1];
+
+				run.segment_count++;
+				run.bytes += length;
+				run.gso_size = static_cast<uint16_t>(segment_size);
+
+				// A shorter datagram must be the last one of the run
+				run_closed = (length < segment_size);
+				continue;
+			}
+
+			if (run_count == max_run_count)
+			{
+				break;
+			}
+
+			auto &run = runs[run_count++];
+			run.segment_count = 1;
+			run.bytes = length;
+			run.gso_size = 0;
+
+			segment_size = length;
+			run_closed = (use_gso == false) || (length > UINT16_MAX);
+		}
+
+		return run_count;
+	}
+
+	template <typename Tpktinfo>
+	int SendBatchFromToInternal(
+		const int socket_handle,
+		const int msg_level, const int msg_type,
+		const SocketAddress &local_address, const SocketAddress &remote_address,
+		const uint8_t *data, const BatchRun *runs, const size_t run_count)
+	{
+		constexpr size_t PKTINFO_SPACE = CMSG_SPACE(sizeof(Tpktinfo));
+		constexpr size_t CONTROL_SIZE = PKTINFO_SPACE + CMSG_SPACE(sizeof(uint16_t));
+
+		mmsghdr messages[OV_SOCKET_MAX_BATCH_MESSAGES]{};
+		iovec iovs[OV_SOCKET_MAX_BATCH_MESSAGES]{};
+		alignas(cmsghdr) uint8_t controls[OV_SOCKET_MAX_BATCH_MESSAGES][CONTROL_SIZE]{};
+
+		Tpktinfo pktinfo{};
+		SetAddr(&pktinfo, local_address);
+
+		auto position = data;
+
+		for (size_t index = 0; index < run_count; index++)
+		{
+			const auto &run = runs[index];
+			auto &iov = iovs[index];
+			auto &msg = messages[index].msg_hdr;
+			auto control = controls[index];
+
+			// This is intentional conversion
+			iov.iov_base = const_cast<uint8_t *>(position);
+			iov.iov_len = run.bytes;
+			position += run.bytes;
+
+			auto cmsg = reinterpret_cast<cmsghdr *>(control);
+			cmsg->cmsg_level = msg_level;
+			cmsg->cmsg_type = msg_type;
+			cmsg->cmsg_len = CMSG_LEN(sizeof(pktinfo));
+			::memcpy(CMSG_DATA(cmsg), &pktinfo, sizeof(pktinfo));
+
+			// This is intentional conversion
+			msg.msg_name = const_cast<sockaddr *>(remote_address.ToSockAddr());
+			msg.msg_namelen = remote_address.GetSockAddrInLength();
+			msg.msg_iov = &iov;
+			msg.msg_iovlen = 1;
+			msg.msg_control = control;
+			msg.msg_controllen = PKTINFO_SPACE;
+
+#	ifdef UDP_SEGMENT
+			if (run.gso_size > 0)
+			{
+				auto gso_cmsg = reinterpret_cast<cmsghdr *>(control + PKTINFO_SPACE);
+				gso_cmsg->cmsg_level = SOL_UDP;
+				gso_cmsg->cmsg_type = UDP_SEGMENT;
+				gso_cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+				::memcpy(CMSG_DATA(gso_cmsg), &(run.gso_size), sizeof(uint16_t));
+
+				msg.msg_controllen = CONTROL_SIZE;
+			}
+#	endif	// UDP_SEGMENT
+		}
+
+		return ::sendmmsg(socket_handle, messages, run_count, MSG_NOSIGNAL | MSG_DONTWAIT);
+	}
+#endif	// IS_LINUX
+
+	ssize_t Socket::SendBatchFromToInternal(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data, std::vector<size_t> *segment_lengths)
+	{
+		if (GetType() != SocketType::Udp)
+		{
+			// Does not support SendBatchFromTo() for TCP/SRT
+			logac("Could not send(batch) data - Invalid socket type: %s", StringFromSocketType(GetType()));
+			OV_ASSERT2(false);
+			return -1L;
+		}
+
+		logat("Trying to send %zu datagrams (%zu bytes) to %s from %s...",
+			  segment_lengths->size(), data->GetLength(),
+			  address_pair.GetRemoteAddress().ToString().CStr(), address_pair.GetLocalAddress().ToString().CStr());
+
+		auto data_to_send = data->GetDataAs<uint8_t>();
+		size_t total_sent_bytes = 0;
+		size_t sent_segment_count = 0;
+		bool succeeded = true;
+
+#if IS_LINUX
+		BatchRun runs[OV_SOCKET_MAX_BATCH_MESSAGES];
+
+		while ((sent_segment_count < segment_lengths->size()) && (_force_stop == false))
+		{
+#	ifdef UDP_SEGMENT
+			const bool use_gso = (_gso_disabled == false);
+#	else	// UDP_SEGMENT
+			const bool use_gso = false;
+#	endif	// UDP_SEGMENT
+			const auto run_count = MakeBatchRuns(*segment_lengths, sent_segment_count, use_gso, runs, OV_SOCKET_MAX_BATCH_MESSAGES);
+
+			int sent_run_count = -1;
+
+			switch (_family)
+			{
+				case SocketFamily::Unknown:
+					OV_ASSERT2(false);
+					return -1L;
+
+				case SocketFamily::Inet:
+					sent_run_count = ov::SendBatchFromToInternal<in_pktinfo>(
+						GetNativeHandle(),
+						IPPROTO_IP, IP_PKTINFO,
+						address_pair.GetLocalAddress(), address_pair.GetRemoteAddress(),
+						data_to_send, runs, run_count);
+					break;
+
+				case SocketFamily::Inet6:
+					sent_run_count = ov::SendBatchFromToInternal<in6_pktinfo>(
+						GetNativeHandle(),
+						IPPROTO_IPV6, IPV6_PKTINFO,
+						address_pair.GetLocalAddress(), address_pair.GetRemoteAddress(),
+						data_to_send, runs, run_count);
+					break;
+			}
+
+			if (sent_run_count < 0)
+			{
+				const auto error_code = errno;
+
+				if (use_gso && ((error_code == EIO) || (error_code == EINVAL) || (error_code == ENOPROTOOPT) || (error_code == EOPNOTSUPP)))
+				{
+					// The kernel or the NIC doesn't accept GSO for this socket - fall back to one datagram per message
+					_gso_disabled = true;
+					logaw("UDP GSO is not available (%s), sending datagrams without GSO", ov::Error::CreateErrorFromErrno()->What());
+					continue;
+				}
+
+				succeeded = false;
+				break;
+			}
+
+			_batch_send_syscall_count++;
+
+			for (int index = 0; index < sent_run_count; index++)
+			{
+				const auto &run = runs[index];
+
+				data_to_send += run.bytes;
+				total_sent_bytes += run.bytes;
+				sent_segment_count += run.segment_count;
+
+				_batch_send_datagram_count += run.segment_count;
+				if (run.gso_size > 0)
+				{
+					_batch_send_gso_datagram_count += run.segment_count;
+				}
+
+				STATS_COUNTER_INCREASE_PPS();
+			}
+		}
+#else	// IS_LINUX
+		// sendmmsg() is not available - send the datagrams one by one
+		for (; (sent_segment_count < segment_lengths->size()) && (_force_stop == false); sent_segment_count++)
+		{
+			const auto length = segment_lengths->at(sent_segment_count);
+			auto sent = SendFromToInternal(address_pair, data->Subdata(total_sent_bytes, length));
+
+			if (sent != static_cast<ssize_t>(length))
+			{
+				succeeded = false;
+				break;
+			}
+
+			total_sent_bytes += length;
+		}
+#endif	// IS_LINUX
+
+		segment_lengths->erase(segment_lengths->begin(), segment_lengths->begin() + sent_segment_count);
+
+		if (total_sent_bytes > 0L)
+		{
+			UpdateLastSentTime();
+		}
+
+		if (succeeded == false)
+		{
+			return HandleSendError(-1L, total_sent_bytes);
+		}
+
+		logat("%zu bytes sent", total_sent_bytes);
+		return total_sent_bytes;
+	}
+
+	bool Socket::SendBatchFromTo(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data, const std::vector<size_t> &segment_lengths)
+	{
+		if (IsSendable() == false)
+		{
+			return false;
+		}
+
+		if (data == nullptr)
+		{
+			OV_ASSERT2(data != nullptr);
+			return false;
+		}
+
+		if (GetType() != SocketType::Udp)
+		{
+			OV_ASSERT2(GetType() == SocketType::Udp);
+			return false;
+		}
+
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking: {
+				auto remaining_segment_lengths = segment_lengths;
+				return (SendBatchFromToInternal(address_pair, data, &remaining_segment_lengths) == static_cast<ssize_t>(data->GetLength()));
+			}
+
+			case BlockingMode::NonBlocking: {
+				std::lock_guard lock_guard(_dispatch_queue_lock);
+
+				if (_dispatch_queue.empty() == false)
+				{
+					// Keep the order of the pending commands
+					return AppendCommand(DispatchCommand(address_pair, data->Clone(), segment_lengths), true);
+				}
+
+				// The iovecs point into the caller's buffer, so nothing is copied unless the socket can't take all the datagrams now
+				auto remaining_segment_lengths = segment_lengths;
+				const auto sent_bytes = SendBatchFromToInternal(address_pair, data, &remaining_segment_lengths);
+
+				if (sent_bytes < 0L)
+				{
+					return false;
+				}
+
+				if (remaining_segment_lengths.empty())
+				{
+					return true;
+				}
+
+				// The rest is sent later - it refers to the caller's buffer, which is copied on write when the caller reuses it
+				_dispatch_queue.emplace_back(address_pair, data->Subdata(sent_bytes), remaining_segment_lengths);
+				_worker->EnqueueToDispatchLater(GetSharedPtr());
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	Socket::BatchSendStats Socket::GetBatchSendStats() const
+	{
+		BatchSendStats stats;
+
+		stats.syscall_count = _batch_send_syscall_count;
+		stats.datagram_count = _batch_send_datagram_count;
+		stats.gso_datagram_count = _batch_send_gso_datagram_count;
+
+		return stats;
+	}
+
 	std::shared_ptr<const SocketError> Socket::Recv(std::shared_ptr<Data> &data, const bool non_block)
 	{
 		OV_ASSERT2(data != nullptr);
@@ -1838,6 +2433,126 @@ namespace ov
 		return socket_error;
 	}
 
+	std::shared_ptr<const SocketError> Socket::RecvBatchFrom(std::shared_ptr<Data> *data_list, SocketAddressPair *address_pair_list, size_t count, size_t *received_count, const bool non_block)
+	{
+		OV_ASSERT2(_socket.IsValid());
+		OV_ASSERT2(data_list != nullptr);
+		OV_ASSERT2(received_count != nullptr);
+		OV_ASSERT2((count > 0) && (count <= OV_SOCKET_MAX_RECV_BATCH_MESSAGES));
+
+		*received_count = 0;
+
+		if (GetType() != SocketType::Udp)
+		{
+			OV_ASSERT2(GetType() == SocketType::Udp);
+			return SocketError::CreateError("RecvBatchFrom() is only supported for UDP");
+		}
+
+#if IS_LINUX
+		count = std::min<size_t>(count, OV_SOCKET_MAX_RECV_BATCH_MESSAGES);
+
+		constexpr size_t CONTROL_BUFFER_SIZE = CMSG_SPACE(std::max(sizeof(in_pktinfo), sizeof(in6_pktinfo)));
+
+		mmsghdr messages[OV_SOCKET_MAX_RECV_BATCH_MESSAGES]{};
+		iovec iovs[OV_SOCKET_MAX_RECV_BATCH_MESSAGES]{};
+		sockaddr_storage remotes[OV_SOCKET_MAX_RECV_BATCH_MESSAGES]{};
+		alignas(cmsghdr) char control_buffers[OV_SOCKET_MAX_RECV_BATCH_MESSAGES][CONTROL_BUFFER_SIZE];
+
+		for (size_t index = 0; index < count; index++)
+		{
+			auto &data = data_list[index];
+			OV_ASSERT2((data != nullptr) && (data->GetCapacity() > 0));
+
+			data->SetLength(data->GetCapacity());
+
+			iovs[index].iov_base = data->GetWritableData();
+			iovs[index].iov_len = data->GetLength();
+
+			auto &msg = messages[index].msg_hdr;
+			msg.msg_name = &remotes[index];
+			msg.msg_namelen = sizeof(remotes[index]);
+			msg.msg_control = control_buffers[index];
+			msg.msg_controllen = CONTROL_BUFFER_SIZE;
+			msg.msg_iov = &iovs[index];
+			msg.msg_iovlen = 1;
+		}
+
+		logad("Trying to read %zu datagrams from the socket...", count);
+
+		const int message_count = ::recvmmsg(
+			GetNativeHandle(),
+			messages, count,
+			((_blocking_mode == BlockingMode::NonBlocking) || non_block) ? MSG_DONTWAIT : 0,
+			nullptr);
+
+		if (message_count < 0)
+		{
+			auto error = Error::CreateErrorFromErrno();
+
+			for (size_t index = 0; index < count; index++)
+			{
+				data_list[index]->SetLength(0L);
+			}
+
+			if (error->GetCode() == EAGAIN)
+			{
+				// Timed out
+				return nullptr;
+			}
+
+			auto socket_error = SocketError::CreateError(error);
+
+			logae("An error occurred while read data: %s\nStack trace: %s",
+				  socket_error->What(),
+				  StackTrace::GetStackTrace().CStr());
+
+			CloseWithState(SocketState::Error);
+
+			return socket_error;
+		}
+
+		const auto port = (address_pair_list != nullptr) ? GetLocalAddress()->Port() : 0;
+
+		for (size_t index = 0; index < count; index++)
+		{
+			if (index >= static_cast<size_t>(message_count))
+			{
+				data_list[index]->SetLength(0L);
+				continue;
+			}
+
+			data_list[index]->SetLength(messages[index].msg_len);
+
+			if (address_pair_list != nullptr)
+			{
+				address_pair_list[index].SetLocalAddress(QueryLocalAddress(_family, port, remotes[index], &(messages[index].msg_hdr)));
+				address_pair_list[index].SetRemoteAddress(SocketAddress("", remotes[index]));
+			}
+		}
+
+		logad("%d datagrams read", message_count);
+
+		*received_count = static_cast<size_t>(message_count);
+
+		if (message_count > 0)
+		{
+			UpdateLastRecvTime();
+		}
+
+		return nullptr;
+#else	// IS_LINUX
+		// recvmmsg() is not available - read a datagram at a time
+		auto error = RecvFrom(data_list[0], (address_pair_list != nullptr) ? &address_pair_list[0] : nullptr, non_block);
+
+		if ((error == nullptr) && (data_list[0]->GetLength() > 0))
+		{
+			*received_count = 1;
+		}
+
+		return error;
+#endif	// IS_LINUX
+	}
+
 	std::chrono::system_clock::time_point Socket::GetLastRecvTime() const
 	{
 		return _last_recv_time;
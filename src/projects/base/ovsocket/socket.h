@@ -26,11 +26,21 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 // Failure to send data for the specified time period will be considered an error.
 // For example, it can occur when EAGAIN continues to occur for a period of time, or when the peer's TCP window is full and no longer receives data.
 #define OV_SOCKET_EXPIRE_TIMEOUT (10 * 1000)
 
+// Maximum number of messages passed to a single sendmmsg() call
+#define OV_SOCKET_MAX_BATCH_MESSAGES 64
+// Maximum number of messages received by a single recvmmsg() call
+#define OV_SOCKET_MAX_RECV_BATCH_MESSAGES 32
+// Maximum number of segments the kernel accepts in a single UDP GSO send (UDP_MAX_SEGMENTS)
+#define OV_SOCKET_MAX_GSO_SEGMENTS 64
+// Maximum payload size of a single UDP GSO send
+#define OV_SOCKET_MAX_GSO_BYTES 65000
+
 namespace ov
 {
 	// Forward declaration
@@ -185,6 +195,44 @@ namespace ov
 		bool SendFromTo(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data);
 		bool SendFromTo(const SocketAddressPair &address_pair, const void *data, size_t length);
 
+		// Sends several datagrams to the same peer with as few syscalls as possible (UDP only).
+		// <data> contains the datagrams back-to-back, and each item of <segment_lengths> is the length of one datagram.
+		// Runs of equally sized datagrams are sent using UDP GSO (UDP_SEGMENT) if available, and all of them are passed to a single sendmmsg().
+		bool SendBatchFromTo(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data, const std::vector<size_t> &segment_lengths);
+
+		struct BatchSendStats
+		{
+			// Number of sendmmsg() calls
+			uint64_t syscall_count = 0;
+			// Number of datagrams sent by sendmmsg()
+			uint64_t datagram_count = 0;
+			// Number of datagrams sent using UDP GSO
+			uint64_t gso_datagram_count = 0;
+
+			double GetDatagramsPerSyscall() const
+			{
+				return (syscall_count == 0) ? 0.0 : (static_cast<double>(datagram_count) / static_cast<double>(syscall_count));
+			}
+		};
+
+		BatchSendStats GetBatchSendStats() const;
+
+		// Sends the contents of <file_region> using sendfile() without copying them to user space (TCP only).
+		// The region is sent in order with the data of Send(), and the file is kept open until it is sent.
+		bool SendFile(const std::shared_ptr<const FileRegion> &file_region);
+
+		// Moves the encryption of outgoing TLS records to the kernel (kTLS, Linux/TCP only).
+		// <crypto_info> is a struct tls_crypto_info followed by the key material of the cipher (linux/tls.h).
+		// Data queued before this call has already been encrypted and is sent as it is, data queued after is encrypted by the kernel.
+		// Returns false if the kernel does not support kTLS or the cipher. In this case the socket keeps sending data as it is.
+		bool EnableKtlsSend(const void *crypto_info);
+		// Sends a TLS record other than application data (alert, handshake, ...) after EnableKtlsSend()
+		bool SendKtlsRecord(uint8_t record_type, const std::shared_ptr<const Data> &data);
+		bool IsKtlsSendEnabled() const
+		{
+			return _ktls_send_enabled;
+		}
+
 		// When Recv is called in non-blocking mode,
 		//
 		// 1. return != nullptr: An error occurred (Include disconnecting the client)
@@ -200,6 +248,13 @@ namespace ov
 		// If MakeNonBlocking() is called, non_block is ignored
 		std::shared_ptr<const SocketError> RecvFrom(std::shared_ptr<Data> &data, SocketAddressPair *address_pair, const bool non_block = false);
 
+		// Receives up to <count> datagrams with a single recvmmsg() (UDP only, count <= OV_SOCKET_MAX_RECV_BATCH_MESSAGES).
+		// The length of data_list[i] is set to the length of the i-th datagram, and *received_count is set to the number of datagrams.
+		// Like RecvFrom(), *received_count == 0 means "retry later" (EAGAIN).
+		//
+		// If MakeNonBlocking() is called, non_block is ignored
+		std::shared_ptr<const SocketError> RecvBatchFrom(std::shared_ptr<Data> *data_list, SocketAddressPair *address_pair_list, size_t count, size_t *received_count, const bool non_block = false);
+
 		std::chrono::system_clock::time_point GetLastRecvTime() const;
 		std::chrono::system_clock::time_point GetLastSentTime() const;
 
@@ -266,6 +321,14 @@ namespace ov
 				SendTo = 0x02,
 				// Need to send data using sendmsg()
 				SendFromTo = 0x03,
+				// Need to send multiple datagrams using sendmmsg()
+				SendBatchFromTo = 0x04,
+				// Need to send a region of a file using sendfile()
+				SendFile = 0x05,
+				// Need to install the transmit key of kTLS using setsockopt()
+				EnableKtlsSend = 0x06,
+				// Need to send a TLS record of <record_type> using sendmsg()
+				SendKtlsRecord = 0x07,
 
 				// Need to call shutdown(SHUT_WR) (TCP only)
 				HalfClose = CLOSE_TYPE_MASK | 0x01,
@@ -291,6 +354,18 @@ namespace ov
 					case Type::SendFromTo:
 						return "SendFromTo";
 
+					case Type::SendBatchFromTo:
+						return "SendBatchFromTo";
+
+					case Type::SendFile:
+						return "SendFile";
+
+					case Type::EnableKtlsSend:
+						return "EnableKtlsSend";
+
+					case Type::SendKtlsRecord:
+						return "SendKtlsRecord";
+
 					case Type::HalfClose:
 						return "HalfClose";
 
@@ -327,6 +402,30 @@ namespace ov
 			{
 			}
 
+			DispatchCommand(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data, const std::vector<size_t> &segment_lengths)
+				: type(Type::SendBatchFromTo),
+				  address_pair(address_pair),
+				  data(data),
+				  segment_lengths(segment_lengths),
+				  enqueued_time(std::chrono::system_clock::now())
+			{
+			}
+
+			DispatchCommand(const std::shared_ptr<const FileRegion> &file_region)
+				: type(Type::SendFile),
+				  file_region(file_region),
+				  enqueued_time(std::chrono::system_clock::now())
+			{
+			}
+
+			DispatchCommand(Type type, const std::shared_ptr<const Data> &data, uint8_t record_type = 0)
+				: type(type),
+				  data(data),
+				  record_type(record_type),
+				  enqueued_time(std::chrono::system_clock::now())
+			{
+			}
+
 			DispatchCommand(Type type)
 				: type(type),
 				  enqueued_time(std::chrono::system_clock::now())
@@ -347,6 +446,9 @@ namespace ov
 				  address(another_command.address),
 				  address_pair(another_command.address_pair),
 				  data(another_command.data),
+				  segment_lengths(another_command.segment_lengths),
+				  file_region(another_command.file_region),
+				  record_type(another_command.record_type),
 				  enqueued_time(another_command.enqueued_time)
 			{
 			}
@@ -359,6 +461,9 @@ namespace ov
 				std::swap(address, another_command.address);
 				std::swap(address_pair, another_command.address_pair);
 				std::swap(data, another_command.data);
+				std::swap(segment_lengths, another_command.segment_lengths);
+				std::swap(file_region, another_command.file_region);
+				std::swap(record_type, another_command.record_type);
 				std::swap(enqueued_time, another_command.enqueued_time);
 			}
 
@@ -392,16 +497,31 @@ namespace ov
 					description.AppendFormat(", address: %s", address.ToString(false).CStr());
 				}
 
-				if (type == DispatchCommand::Type::SendFromTo)
+				if ((type == DispatchCommand::Type::SendFromTo) || (type == DispatchCommand::Type::SendBatchFromTo))
 				{
 					description.AppendFormat(", address_pair: %s", address_pair.ToString().CStr());
 				}
 
+				if (type == DispatchCommand::Type::SendBatchFromTo)
+				{
+					description.AppendFormat(", segments: %zu", segment_lengths.size());
+				}
+
 				if (data != nullptr)
 				{
 					description.AppendFormat(", data: %zu bytes", data->GetLength());
 				}
 
+				if (file_region != nullptr)
+				{
+					description.AppendFormat(", file: %zu bytes", file_region->GetLength());
+				}
+
+				if (type == DispatchCommand::Type::SendKtlsRecord)
+				{
+					description.AppendFormat(", record_type: %u", record_type);
+				}
+
 				description.Append('>');
 
 				return description;
@@ -412,6 +532,12 @@ namespace ov
 			SocketAddress address;
 			SocketAddressPair address_pair;
 			std::shared_ptr<const Data> data;
+			// Length of each datagram in data (used by SendBatchFromTo)
+			std::vector<size_t> segment_lengths;
+			// Region of a file to send (used by SendFile)
+			std::shared_ptr<const FileRegion> file_region;
+			// TLS record type (used by SendKtlsRecord)
+			uint8_t record_type = 0;
 			std::chrono::time_point<std::chrono::system_clock> enqueued_time;
 		};
 
@@ -446,6 +572,11 @@ namespace ov
 		ssize_t SendInternal(const std::shared_ptr<const Data> &data);
 		ssize_t SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 		ssize_t SendFromToInternal(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data);
+		// Returns the number of bytes of the datagrams that are completely sent, and removes them from <segment_lengths>
+		ssize_t SendBatchFromToInternal(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data, std::vector<size_t> *segment_lengths);
+		ssize_t SendFileInternal(const std::shared_ptr<const FileRegion> &file_region);
+		bool EnableKtlsSendInternal(const std::shared_ptr<const Data> &crypto_info);
+		ssize_t SendKtlsRecordInternal(uint8_t record_type, const std::shared_ptr<const Data> &data);
 
 		std::shared_ptr<SocketError> RecvInternal(void *data, size_t length, size_t *received_length);
 
@@ -543,6 +674,16 @@ namespace ov
 
 		String _stream_id;	// only available for SRT socket
 
+		// UDP GSO is disabled when the kernel/NIC refuses it
+		std::atomic<bool> _gso_disabled{false};
+
+		std::atomic<uint64_t> _batch_send_syscall_count{0};
+		std::atomic<uint64_t> _batch_send_datagram_count{0};
+		std::atomic<uint64_t> _batch_send_gso_datagram_count{0};
+
+		// Outgoing records are encrypted by the kernel (kTLS)
+		std::atomic<bool> _ktls_send_enabled{false};
+
 	private:
 		void UpdateLastRecvTime();
 		void UpdateLastSentTime();
@@ -85,6 +85,14 @@ namespace ov
 			return false;
 		}
 
+		std::size_t Hash() const
+		{
+			auto hash = _remote_address.Hash();
+			// hash_combine
+			hash ^= _local_address.Hash() + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+			return hash;
+		}
+
 		String ToString() const
 		{
 			return String::FormatString(
@@ -99,3 +107,15 @@ namespace ov
 		SocketAddress _remote_address;
 	};
 }  // namespace ov
+
+namespace std
+{
+	template <>
+	struct hash<ov::SocketAddressPair>
+	{
+		std::size_t operator()(ov::SocketAddressPair const &pair) const
+		{
+			return pair.Hash();
+		}
+	};
+}  // namespace std
@@ -18,6 +18,12 @@
 
 namespace ov
 {
+	namespace
+	{
+		// The CPU to pin the first worker of the next pool, so the pools don't all start from CPU #0
+		std::atomic<int> g_next_cpu_index{0};
+	}  // namespace
+
 	SocketPool::SocketPool(PrivateToken token, const char *name, SocketType type, bool thread_per_socket)
 		: _name(name),
 		  _type(type),
@@ -174,6 +180,33 @@ namespace ov
 		return UninitializeWorkers(worker_list);
 	}
 
+	bool SocketPool::SetCpuAffinity()
+	{
+		auto cpu_count = static_cast<int>(std::thread::hardware_concurrency());
+
+		if (cpu_count <= 0)
+		{
+			logaw("Could not obtain the number of CPUs");
+			return false;
+		}
+
+		std::lock_guard lock_guard(_worker_list_mutex);
+
+		// Reserve the CPUs for the workers of this pool
+		auto first_cpu_index = g_next_cpu_index.fetch_add(static_cast<int>(_worker_list.size())) % cpu_count;
+
+		bool result = true;
+		int index = 0;
+
+		for (auto &worker : _worker_list)
+		{
+			result = worker->SetCpuAffinity((first_cpu_index + index) % cpu_count) && result;
+			index++;
+		}
+
+		return result;
+	}
+
 	String SocketPool::ToString() const
 	{
 		String description;
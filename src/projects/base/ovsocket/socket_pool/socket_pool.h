@@ -114,6 +114,32 @@ namespace ov
 			return nullptr;
 		}
 
+		// Allocate a socket on the worker at worker_index instead of the least busy one
+		// (Used to spread SO_REUSEPORT listeners over all workers)
+		template <typename Tsocket = ov::Socket, typename... Targuments>
+		std::shared_ptr<Tsocket> AllocSocketOnWorker(int worker_index, const SocketFamily family, Targuments... args)
+		{
+			std::shared_ptr<SocketPoolWorker> worker = GetWorkerAt(worker_index);
+			if (worker != nullptr)
+			{
+				auto socket = worker->AllocSocket<Tsocket>(family, args...);
+
+				if (socket == nullptr)
+				{
+					// Rollback
+					worker->DecreaseSocketCount();
+				}
+
+				return socket;
+			}
+
+			return nullptr;
+		}
+
+		// Pin the workers to consecutive CPUs, starting after the CPUs used by the previously pinned pools
+		// (wraps around when there are more workers than CPUs)
+		bool SetCpuAffinity();
+
 		bool ReleaseSocket(const std::shared_ptr<Socket> &socket)
 		{
 			return socket->GetSocketPoolWorker()->ReleaseSocket(socket);
@@ -160,6 +186,23 @@ namespace ov
 			return worker;
 		}
 
+		// This method will increase the number of sockets for that worker by 1
+		std::shared_ptr<SocketPoolWorker> GetWorkerAt(int worker_index)
+		{
+			std::lock_guard lock_guard(_worker_list_mutex);
+
+			if (_thread_per_socket || (worker_index < 0) || (static_cast<size_t>(worker_index) >= _worker_list.size()))
+			{
+				return nullptr;
+			}
+
+			auto worker = _worker_list[worker_index];
+
+			worker->IncreaseSocketCount();
+
+			return worker;
+		}
+
 		std::shared_ptr<SocketPoolWorker> CreateWorker(const std::shared_ptr<ov::SocketPool> &pool)
 		{
 			OV_ASSERT2(pool != nullptr);
@@ -62,6 +62,30 @@ namespace ov
 		return true;
 	}
 
+	bool SocketPoolWorker::SetCpuAffinity(int cpu_index)
+	{
+		if (_epoll_thread.joinable() == false)
+		{
+			return false;
+		}
+
+		cpu_set_t cpu_set;
+		CPU_ZERO(&cpu_set);
+		CPU_SET(cpu_index, &cpu_set);
+
+		auto result = ::pthread_setaffinity_np(_epoll_thread.native_handle(), sizeof(cpu_set), &cpu_set);
+
+		if (result != 0)
+		{
+			logaw("Could not set CPU affinity of %s to CPU %d: %s", ToString().CStr(), cpu_index, ::strerror(result));
+			return false;
+		}
+
+		logad("%s is pinned to CPU %d", ToString().CStr(), cpu_index);
+
+		return true;
+	}
+
 	bool SocketPoolWorker::Uninitialize()
 	{
 		if (GetNativeHandle() == InvalidSocket)
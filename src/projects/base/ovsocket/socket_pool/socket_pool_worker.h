@@ -48,6 +48,9 @@ namespace ov
 
 		bool ReleaseSocket(const std::shared_ptr<Socket> &socket);
 
+		// Pin the epoll thread to the CPU
+		bool SetCpuAffinity(int cpu_index);
+
 		String ToString() const;
 
 	protected:
@@ -169,7 +169,7 @@ namespace pvd
 			}
 		}
 
-		auto event_message = std::make_shared<MediaPacket>(GetMsid(),
+		auto event_message = ov::MakePooledShared<MediaPacket>(GetMsid(),
 															cmn::MediaType::Data,
 															data_track->GetId(),
 															frame, 
@@ -220,7 +220,7 @@ namespace pvd
 		auto timestamp_in_tb = static_cast<int64_t>(timestamp_in_ms * subtitle_track->GetTimeBase().GetTimescale() / 1000.0);
 		auto duration_in_tb = static_cast<int64_t>(duration_ms * subtitle_track->GetTimeBase().GetTimescale() / 1000.0);
 
-		auto subtitle_message = std::make_shared<MediaPacket>(GetMsid(),
+		auto subtitle_message = ov::MakePooledShared<MediaPacket>(GetMsid(),
 															cmn::MediaType::Subtitle,
 															subtitle_track->GetId(),
 															frame, 
@@ -1,6 +1,7 @@
 #include "application.h"
 
 #include <algorithm>
+#include <cinttypes>
 
 #include "publisher.h"
 #include "publisher_private.h"
@@ -9,7 +10,8 @@
 namespace pub
 {
 	ApplicationWorker::ApplicationWorker(uint32_t worker_id, ov::String vhost_app_name, ov::String worker_name)
-		: _stream_data_queue(nullptr, 500)
+		: _stream_data_queue(nullptr, 500),
+		  _frame_reader_queue(nullptr, 500)
 	{
 		_worker_id = worker_id;
 		_vhost_app_name = vhost_app_name;
@@ -32,6 +34,11 @@ namespace pub
 			name.LowerCaseString());
 
 		_stream_data_queue.SetUrn(urn);
+		_frame_reader_queue.SetUrn(std::make_shared<info::ManagedQueue::URN>(
+			_vhost_app_name,
+			nullptr,
+			"pub",
+			ov::String::FormatString("%s_ring", name.LowerCaseString().CStr())));
 
 		logtd("%s ApplicationWorker has been created", _worker_name.CStr());
 
@@ -46,6 +53,12 @@ namespace pub
 		}
 
 		_stream_data_queue.Clear();
+		_frame_reader_queue.Clear();
+
+		{
+			std::lock_guard<std::mutex> lock(_frame_reader_map_lock);
+			_frame_reader_map.clear();
+		}
 
 		_stop_thread_flag = true;
 
@@ -74,6 +87,9 @@ namespace pub
 	{
 		logti("Stream(%s/%u) deleted on AppWorker (%s / %d)", info->GetName().CStr(), info->GetId(), _worker_name.CStr(), _worker_id);
 		_stream_count--;
+
+		std::lock_guard<std::mutex> lock(_frame_reader_map_lock);
+		_frame_reader_map.erase(info->GetId());
 	}
 
 	uint32_t ApplicationWorker::GetStreamCount() const
@@ -91,6 +107,110 @@ namespace pub
 		return true;
 	}
 
+	bool ApplicationWorker::OnFramePushed(const std::shared_ptr<Stream> &stream, const std::shared_ptr<MediaFrameRing> &frame_ring)
+	{
+		std::shared_ptr<FrameReader> reader;
+
+		{
+			std::lock_guard<std::mutex> lock(_frame_reader_map_lock);
+
+			auto it = _frame_reader_map.find(stream->GetId());
+			if ((it != _frame_reader_map.end()) && (it->second->_stream == stream) && (it->second->_frame_ring == frame_ring))
+			{
+				reader = it->second;
+			}
+			else
+			{
+				// Start reading from the frame that has just been pushed
+				reader = std::make_shared<FrameReader>(stream, frame_ring);
+				_frame_reader_map[stream->GetId()] = reader;
+			}
+		}
+
+		ScheduleFrameReader(reader);
+
+		return true;
+	}
+
+	void ApplicationWorker::ScheduleFrameReader(const std::shared_ptr<FrameReader> &reader)
+	{
+		// A reader is queued only once no matter how many frames are pushed
+		if (reader->_scheduled.exchange(true) == false)
+		{
+			_frame_reader_queue.Enqueue(reader);
+			_queue_event.Notify();
+		}
+	}
+
+	std::shared_ptr<ApplicationWorker::FrameReader> ApplicationWorker::PopFrameReader()
+	{
+		if (_frame_reader_queue.IsEmpty())
+		{
+			return nullptr;
+		}
+
+		auto reader = _frame_reader_queue.Dequeue(0);
+		if (reader.has_value())
+		{
+			return reader.value();
+		}
+
+		return nullptr;
+	}
+
+	void ApplicationWorker::ReadFrames(const std::shared_ptr<FrameReader> &reader)
+	{
+		auto &stream = reader->_stream;
+
+		// Frames pushed after this point will schedule the reader again
+		reader->_scheduled = false;
+
+		std::vector<std::shared_ptr<MediaPacket>> frames;
+		uint64_t lagged_count = 0;
+
+		if (reader->_frame_ring->Read(*reader->_cursor, frames, APPLICATION_WORKER_MAX_FRAMES_PER_READ, &lagged_count) == MediaFrameRing::ReadResult::Lagging)
+		{
+			reader->_lagged_frame_count += lagged_count;
+			reader->_lagging = true;
+			reader->_recovered_track_ids.clear();
+
+			logtw("%s/%s(%u) publisher is lagging behind the frame ring. %" PRIu64 " frames were skipped (total: %" PRIu64 "), video will resume from the next key frame",
+				  stream->GetApplicationName(), stream->GetName().CStr(), stream->GetId(), lagged_count, reader->_lagged_frame_count);
+		}
+
+		for (auto &media_packet : frames)
+		{
+			if (media_packet == nullptr)
+			{
+				continue;
+			}
+
+			if (reader->_lagging && (media_packet->GetMediaType() == cmn::MediaType::Video))
+			{
+				auto track_id = media_packet->GetTrackId();
+
+				if (reader->_recovered_track_ids.find(track_id) == reader->_recovered_track_ids.end())
+				{
+					if (media_packet->IsKeyFrame() == false)
+					{
+						// Dependent frames cannot be decoded without the skipped frames
+						continue;
+					}
+
+					reader->_recovered_track_ids.insert(track_id);
+				}
+			}
+
+			SendFrame(stream, media_packet);
+		}
+
+		if (reader->_frame_ring->HasFrames(*reader->_cursor))
+		{
+			// Let other streams of this worker go first
+			ScheduleFrameReader(reader);
+		}
+	}
+
 	std::shared_ptr<ApplicationWorker::StreamData> ApplicationWorker::PopStreamData()
 	{
 		if (_stream_data_queue.IsEmpty())
@@ -115,59 +235,69 @@ namespace pub
 		{
 			_queue_event.Wait();
 
-			// Check media data is available
-			auto stream_data = PopStreamData();
-			if (stream_data == nullptr)
-			{
-				continue;
-			}
-			
-			auto stream = stream_data->_stream;
-			auto media_packet = stream_data->_media_packet;
-			if (stream == nullptr || media_packet == nullptr)
+			auto reader = PopFrameReader();
+			if (reader != nullptr)
 			{
+				ReadFrames(reader);
 				continue;
 			}
 
-			// State::CREATED could be needed for some cases
-			if (stream->GetState() == Stream::State::ERROR || stream->GetState() == Stream::State::STOPPED)
+			// Check media data is available
+			auto stream_data = PopStreamData();
+			if (stream_data == nullptr)
 			{
 				continue;
 			}
 
-			if (media_packet->GetMediaType() == cmn::MediaType::Video)
-			{
-				stream->SendVideoFrame(stream_data->_media_packet);
-			}
-			else if (media_packet->GetMediaType() == cmn::MediaType::Audio)
-			{
-				stream->SendAudioFrame(stream_data->_media_packet);
-			}
-			else if (media_packet->GetMediaType() == cmn::MediaType::Data || 
-						media_packet->GetMediaType() == cmn::MediaType::Subtitle)
-			{
-				if (media_packet->GetBitstreamFormat() == cmn::BitstreamFormat::OVEN_EVENT)
-				{
-					auto event = std::dynamic_pointer_cast<MediaEvent>(media_packet);
-					if (event == nullptr)
-					{
-						logtw("MediaPacket is not MediaEvent. Cannot process event. %s/%s(%u)", stream->GetApplicationName(), stream->GetName().CStr(), stream->GetId());
-						continue;
-					}
+			SendFrame(stream_data->_stream, stream_data->_media_packet);
+		}
+	}
 
-					stream->ProcessEvent(event);
-					stream->OnEvent(event);
-				}
-				else
+	void ApplicationWorker::SendFrame(const std::shared_ptr<Stream> &stream, const std::shared_ptr<MediaPacket> &media_packet)
+	{
+		if (stream == nullptr || media_packet == nullptr)
+		{
+			return;
+		}
+
+		// State::CREATED could be needed for some cases
+		if (stream->GetState() == Stream::State::ERROR || stream->GetState() == Stream::State::STOPPED)
+		{
+			return;
+		}
+
+		if (media_packet->GetMediaType() == cmn::MediaType::Video)
+		{
+			stream->SendVideoFrame(media_packet);
+		}
+		else if (media_packet->GetMediaType() == cmn::MediaType::Audio)
+		{
+			stream->SendAudioFrame(media_packet);
+		}
+		else if (media_packet->GetMediaType() == cmn::MediaType::Data || 
+					media_packet->GetMediaType() == cmn::MediaType::Subtitle)
+		{
+			if (media_packet->GetBitstreamFormat() == cmn::BitstreamFormat::OVEN_EVENT)
+			{
+				auto event = std::dynamic_pointer_cast<MediaEvent>(media_packet);
+				if (event == nullptr)
 				{
-					stream->SendDataFrame(stream_data->_media_packet);
+					logtw("MediaPacket is not MediaEvent. Cannot process event. %s/%s(%u)", stream->GetApplicationName(), stream->GetName().CStr(), stream->GetId());
+					return;
 				}
+
+				stream->ProcessEvent(event);
+				stream->OnEvent(event);
 			}
 			else
 			{
-				// Nothing can do
+				stream->SendDataFrame(media_packet);
 			}
 		}
+		else
+		{
+			// Nothing can do
+		}
 	}
 
 	Application::Application(const std::shared_ptr<Publisher> &publisher, const info::Application &application_info)
@@ -468,6 +598,21 @@ namespace pub
 		return application_worker->PushMediaPacket(GetStream(stream->GetId()), media_packet);
 	}
 
+	bool Application::OnFramePushed(const std::shared_ptr<info::Stream> &stream,
+								   const std::shared_ptr<MediaFrameRing> &frame_ring)
+	{
+		auto application_worker = GetWorkerByStreamID(stream->GetId());
+		auto publisher_stream = GetStream(stream->GetId());
+
+		if ((application_worker == nullptr) || (publisher_stream == nullptr))
+		{
+			// The stream is not ready (or is being deleted), the frame is dropped
+			return true;
+		}
+
+		return application_worker->OnFramePushed(publisher_stream, frame_ring);
+	}
+
 	uint32_t Application::GetStreamCount()
 	{
 		return _streams.size();
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <map>
+#include <set>
 #include <utility>
 #include <shared_mutex>
 #include "base/common_types.h"
@@ -16,6 +19,9 @@
 #define MIN_APPLICATION_WORKER_COUNT		1
 #define MAX_APPLICATION_WORKER_COUNT		72
 
+// Maximum number of frames read from a MediaFrameRing at once (for fairness between streams)
+#define APPLICATION_WORKER_MAX_FRAMES_PER_READ	64
+
 namespace pub
 {
 	enum ApplicationState
@@ -36,6 +42,8 @@ namespace pub
 		bool Start();
 		bool Stop();
 		bool PushMediaPacket(const std::shared_ptr<Stream> &stream, const std::shared_ptr<MediaPacket> &media_packet);
+		// Schedules reading the frame ring of the stream
+		bool OnFramePushed(const std::shared_ptr<Stream> &stream, const std::shared_ptr<MediaFrameRing> &frame_ring);
 
 		uint32_t GetWorkerId() const;
 		void OnStreamCreated(const std::shared_ptr<info::Stream> &info);
@@ -64,12 +72,47 @@ namespace pub
 		};
 		std::shared_ptr<ApplicationWorker::StreamData> PopStreamData();
 
+		// Reads frames of a stream from the MediaFrameRing of the stream
+		class FrameReader
+		{
+		public:
+			FrameReader(const std::shared_ptr<Stream> &stream, const std::shared_ptr<MediaFrameRing> &frame_ring)
+				: _stream(stream),
+				  _frame_ring(frame_ring),
+				  _cursor(frame_ring->CreateCursor())
+			{
+			}
+
+			std::shared_ptr<Stream> _stream;
+			std::shared_ptr<MediaFrameRing> _frame_ring;
+
+			// Position of the next frame to read (Only read by the worker thread)
+			std::shared_ptr<MediaFrameRing::Cursor> _cursor;
+			// true while the reader is in _frame_reader_queue
+			std::atomic<bool> _scheduled{false};
+
+			// After lagging, video frames of a track are dropped until a key frame of the track arrives
+			bool _lagging = false;
+			std::set<uint32_t> _recovered_track_ids;
+			uint64_t _lagged_frame_count = 0;
+		};
+		void ScheduleFrameReader(const std::shared_ptr<FrameReader> &reader);
+		std::shared_ptr<FrameReader> PopFrameReader();
+		void ReadFrames(const std::shared_ptr<FrameReader> &reader);
+
+		void SendFrame(const std::shared_ptr<Stream> &stream, const std::shared_ptr<MediaPacket> &media_packet);
+
 		std::atomic<bool> _stop_thread_flag;
 		std::thread _worker_thread;
 		ov::Semaphore _queue_event;
 
 		ov::ManagedQueue<std::shared_ptr<StreamData>> _stream_data_queue;
 
+		std::mutex _frame_reader_map_lock;
+		std::map<info::stream_id_t, std::shared_ptr<FrameReader>> _frame_reader_map;
+		// Readers that have frames to read
+		ov::ManagedQueue<std::shared_ptr<FrameReader>> _frame_reader_queue;
+
 		[[maybe_unused]] int64_t _last_video_ts_ms = 0;
 		[[maybe_unused]] int64_t _last_audio_ts_ms = 0;
 
@@ -91,6 +134,9 @@ namespace pub
 		// Put data in ApplicationWorker's queue.
 		bool OnSendFrame(const std::shared_ptr<info::Stream> &stream,
 							  const std::shared_ptr<MediaPacket> &media_packet) override;
+		// Read the frame from the frame ring of the stream in ApplicationWorker
+		bool OnFramePushed(const std::shared_ptr<info::Stream> &stream,
+						   const std::shared_ptr<MediaFrameRing> &frame_ring) override;
 
 		uint32_t GetStreamCount();
 		std::shared_ptr<Stream> GetStream(uint32_t stream_id);
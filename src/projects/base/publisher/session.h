@@ -58,7 +58,8 @@ namespace pub
 	private:
 		std::shared_ptr<Application> _application;
 		std::shared_ptr<Stream> _stream;
-		SessionState _state;
+		// Read by the threads sending packets to the session
+		std::atomic<SessionState> _state;
 		ov::String _error_reason;
 	};
 
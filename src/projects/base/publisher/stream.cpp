@@ -6,7 +6,8 @@
 namespace pub
 {
 	StreamWorker::StreamWorker(const std::shared_ptr<Stream> &parent_stream)
-		: _packet_queue(nullptr, 500)
+		: _session_snapshot(std::make_shared<const SessionSnapshot>()),
+		  _packet_queue(nullptr, 500)
 	{
 		_stop_thread_flag = true;
 		_parent = parent_stream;
@@ -62,6 +63,9 @@ namespace pub
 
 		logtd("StreamWorker thread of %s has been stopped successfully", worker_name.CStr());
 
+		// Sessions removed after the thread has stopped
+		StopRemovedSessions();
+
 		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
 
 		logtd("Try to stop all sessions of %s", worker_name.CStr());
@@ -70,8 +74,9 @@ namespace pub
 			auto session = std::static_pointer_cast<Session>(x.second);
 			session->Stop();
 		}
+		logtd("All sessions(%zu) of %s has been stopped successfully", _sessions.size(), worker_name.CStr());
 		_sessions.clear();
-		logtd("All sessions(%d) of %s has been stopped successfully", _sessions.size(), worker_name.CStr());
+		UpdateSessionSnapshot();
 
 		return true;
 	}
@@ -86,6 +91,7 @@ namespace pub
 
 		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
 		_sessions[session->GetId()] = session;
+		UpdateSessionSnapshot();
 
 		return true;
 	}
@@ -107,13 +113,45 @@ namespace pub
 
 		auto session = _sessions[id];
 		_sessions.erase(id);
+		UpdateSessionSnapshot();
 		lock.unlock();
 
-		session->Stop();
+		if (std::this_thread::get_id() == _worker_thread.get_id())
+		{
+			// Called by the session itself (e.g. OnMessageReceived()), no packet is being sent
+			session->Stop();
+			return true;
+		}
+
+		// WorkerThread() may be sending a packet to the session with the previous snapshot
+		{
+			std::lock_guard<std::mutex> removed_sessions_lock(_removed_sessions_mutex);
+			_removed_sessions.push_back(session);
+		}
+		_queue_event.Notify();
 
 		return true;
 	}
 
+	void StreamWorker::StopRemovedSessions()
+	{
+		std::vector<std::shared_ptr<Session>> removed_sessions;
+		{
+			std::lock_guard<std::mutex> lock(_removed_sessions_mutex);
+			if (_removed_sessions.empty())
+			{
+				return;
+			}
+
+			removed_sessions.swap(_removed_sessions);
+		}
+
+		for (const auto &session : removed_sessions)
+		{
+			session->Stop();
+		}
+	}
+
 	std::shared_ptr<Session> StreamWorker::GetSession(session_id_t id)
 	{
 		std::shared_lock<std::shared_mutex> lock(_session_map_mutex);
@@ -126,7 +164,31 @@ namespace pub
 		return _sessions[id];
 	}
 
-	void StreamWorker::SendPacket(const std::any &packet)
+	void StreamWorker::UpdateSessionSnapshot()
+	{
+		auto snapshot = std::make_shared<SessionSnapshot>();
+		snapshot->reserve(_sessions.size());
+
+		for (const auto &x : _sessions)
+		{
+			snapshot->push_back(x.second);
+		}
+
+		std::shared_ptr<const SessionSnapshot> old_snapshot(std::move(snapshot));
+		{
+			std::lock_guard<std::mutex> lock(_session_snapshot_lock);
+			_session_snapshot.swap(old_snapshot);
+		}
+		// The previous snapshot is released outside of the lock
+	}
+
+	std::shared_ptr<const SessionSnapshot> StreamWorker::GetSessionSnapshot()
+	{
+		std::lock_guard<std::mutex> lock(_session_snapshot_lock);
+		return _session_snapshot;
+	}
+
+	void StreamWorker::SendPacket(const std::shared_ptr<const std::any> &packet)
 	{
 		_packet_queue.Enqueue(packet);
 		_queue_event.Notify();
@@ -139,7 +201,7 @@ namespace pub
 		_queue_event.Notify();
 	}
 
-	std::optional<std::any> StreamWorker::PopStreamPacket()
+	std::optional<std::shared_ptr<const std::any>> StreamWorker::PopStreamPacket()
 	{
 		if (_packet_queue.IsEmpty())
 		{
@@ -169,12 +231,12 @@ namespace pub
 	{
 		ov::logger::ThreadHelper thread_helper;
 
-		std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex, std::defer_lock);
-
 		while (!_stop_thread_flag)
 		{
 			_queue_event.Wait();
 
+			StopRemovedSessions();
+
 			auto session_message = PopSessionMessage();
 			if (session_message != nullptr && session_message->_session != nullptr && session_message->_message.has_value())
 			{
@@ -182,21 +244,29 @@ namespace pub
 			}
 
 			auto packet = PopStreamPacket();
-			if (packet.has_value())
-			{		
-				session_lock.lock();
-				for (auto const &x : _sessions)
+			if (packet.has_value() && packet.value() != nullptr)
+			{
+				// Sessions added/removed while sending take effect from the next packet
+				auto sessions = GetSessionSnapshot();
+				const auto &data = *(packet.value());
+
+				for (const auto &session : *sessions)
 				{
-					auto session = x.second;
-					session->SendOutgoingData(packet.value());
+					// Stopped by the publisher after the snapshot was taken
+					if (session->GetState() == Session::SessionState::Stopped)
+					{
+						continue;
+					}
+
+					session->SendOutgoingData(data);
 				}
-				session_lock.unlock();
 			}
 		}
 	}
 
 	Stream::Stream(const std::shared_ptr<Application> application, const info::Stream &info)
-		: info::Stream(info)
+		: info::Stream(info),
+		  _session_snapshot(std::make_shared<const SessionSnapshot>())
 	{
 		_application = application;
 		_last_issued_session_id = 100;
@@ -289,7 +359,12 @@ namespace pub
 			return false;
 		}
 
-		_state = State::STOPPED;
+		auto stopped_snapshot = std::make_shared<const SessionSnapshot>();
+		{
+			std::lock_guard<std::mutex> snapshot_lock(_session_snapshot_lock);
+			_state = State::STOPPED;
+			_session_snapshot.swap(stopped_snapshot);
+		}
 
 		for(const auto &worker : _stream_workers)
 		{
@@ -302,6 +377,8 @@ namespace pub
 
 		worker_lock.unlock();
 
+		// BroadcastPacket() may still be sending to the sessions of the old snapshot
+		std::lock_guard<std::shared_mutex> broadcast_lock(_broadcast_lock);
 		std::lock_guard<std::shared_mutex> session_lock(_session_map_mutex);
 
 		logti("[%s(%u)] %s - Try to stop all sessions (%d)", GetName().CStr(), GetId(), GetApplicationTypeName(), _sessions.size());
@@ -312,6 +389,7 @@ namespace pub
 			session->Stop();
 		}
 		_sessions.clear();
+		UpdateSessionSnapshot();
 
 		logti("[%s(%u)] %s stream has been stopped", GetName().CStr(), GetId(), GetApplicationTypeName());
 
@@ -375,6 +453,7 @@ namespace pub
 		std::lock_guard<std::shared_mutex> session_lock(_session_map_mutex);
 		// For getting session, all sessions
 		_sessions[session->GetId()] = session;
+		UpdateSessionSnapshot();
 
 		if(_worker_count > 0)
 		{
@@ -402,6 +481,7 @@ namespace pub
 				return false;
 			}
 			_sessions.erase(session_iterator);
+			UpdateSessionSnapshot();
 		}
 
 		if(_worker_count > 0)
@@ -442,22 +522,61 @@ namespace pub
 		return _sessions.size();
 	}
 
+	void Stream::UpdateSessionSnapshot()
+	{
+		auto snapshot = std::make_shared<SessionSnapshot>();
+		snapshot->reserve(_sessions.size());
+
+		for (const auto &x : _sessions)
+		{
+			snapshot->push_back(x.second);
+		}
+
+		std::shared_ptr<const SessionSnapshot> old_snapshot(std::move(snapshot));
+		{
+			std::lock_guard<std::mutex> lock(_session_snapshot_lock);
+			_session_snapshot.swap(old_snapshot);
+		}
+	}
+
 	bool Stream::BroadcastPacket(const std::any &packet)
 	{
 		if(_worker_count > 0)
 		{
+			// Wrap the packet once, every worker holds a reference to the same instance
+			auto shared_packet = std::make_shared<const std::any>(packet);
+
 			std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
 			for (uint32_t i = 0; i < _stream_workers.size(); i++)
 			{
-				_stream_workers[i]->SendPacket(packet);
+				_stream_workers[i]->SendPacket(shared_packet);
 			}
 		}
 		else
 		{
-			std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
-			for (auto const &x : _sessions)
+			std::shared_lock<std::shared_mutex> broadcast_lock(_broadcast_lock);
+
+			std::shared_ptr<const SessionSnapshot> sessions;
 			{
-				auto session = std::static_pointer_cast<Session>(x.second);
+				// Stop() changes the state and clears the snapshot under the same lock,
+				// so a stopped stream never hands out its sessions
+				std::lock_guard<std::mutex> lock(_session_snapshot_lock);
+				if (_state == State::STOPPED)
+				{
+					return false;
+				}
+
+				sessions = _session_snapshot;
+			}
+
+			for (const auto &session : *sessions)
+			{
+				// The session may have been removed and stopped after the snapshot was taken
+				if (session->GetState() == Session::SessionState::Stopped)
+				{
+					continue;
+				}
+
 				session->SendOutgoingData(packet);
 			}
 		}
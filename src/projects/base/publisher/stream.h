@@ -13,6 +13,9 @@
 
 namespace pub
 {
+	// Immutable list of sessions. Readers take a snapshot without a lock, and writers replace it as a whole (copy-on-write)
+	using SessionSnapshot = std::vector<std::shared_ptr<Session>>;
+
 	class StreamWorker
 	{
 	public:
@@ -30,18 +33,27 @@ namespace pub
 		void SendMessage(const std::shared_ptr<Session> &session, const std::any &message);
 
 		// Send to all sessions
-		void SendPacket(const std::any &packet);
+		// The packet is shared by all workers, so it is never copied
+		void SendPacket(const std::shared_ptr<const std::any> &packet);
 
 	private:
 		void WorkerThread();
 
+		// Must be called with _session_map_mutex held exclusively
+		void UpdateSessionSnapshot();
+		std::shared_ptr<const SessionSnapshot> GetSessionSnapshot();
+
 		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
 		std::shared_mutex _session_map_mutex;
+		// Used by WorkerThread() to fan out packets without taking _session_map_mutex
+		// _session_snapshot_lock is only held to copy/replace the pointer
+		std::shared_ptr<const SessionSnapshot> _session_snapshot;
+		std::mutex _session_snapshot_lock;
 		
 		ov::Semaphore _queue_event;
 
-		std::optional<std::any> PopStreamPacket();
-		ov::ManagedQueue<std::any> _packet_queue;
+		std::optional<std::shared_ptr<const std::any>> PopStreamPacket();
+		ov::ManagedQueue<std::shared_ptr<const std::any>> _packet_queue;
 
 		struct SessionMessage
 		{
@@ -58,6 +70,11 @@ namespace pub
 		std::shared_ptr<SessionMessage> PopSessionMessage();
 		ov::Queue<std::shared_ptr<SessionMessage>> _session_message_queue;
 
+		// Removed sessions are stopped by WorkerThread() between packets, so Stop() never runs while a packet is being sent to the session
+		void StopRemovedSessions();
+		std::vector<std::shared_ptr<Session>> _removed_sessions;
+		std::mutex _removed_sessions_mutex;
+
 		std::atomic<bool> _stop_thread_flag;
 		std::thread _worker_thread;
 
@@ -169,8 +186,19 @@ namespace pub
 
 	private:
 		std::shared_ptr<StreamWorker> GetWorkerBySessionID(session_id_t session_id);
+
+		// Must be called with _session_map_mutex held exclusively
+		void UpdateSessionSnapshot();
+
 		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
 		std::shared_mutex _session_map_mutex;
+		// Used by BroadcastPacket() when there is no StreamWorker
+		// _session_snapshot_lock is only held to copy/replace the pointer, and Stop() changes _state under it
+		std::shared_ptr<const SessionSnapshot> _session_snapshot;
+		std::mutex _session_snapshot_lock;
+		// Held (shared) by BroadcastPacket() while it sends to the snapshot without a StreamWorker,
+		// Stop() takes it exclusively to wait for the broadcasts in flight before stopping the sessions
+		std::shared_mutex _broadcast_lock;
 
 		uint32_t _worker_count;
 		
@@ -0,0 +1,106 @@
+LOCAL_PATH := $(call get_local_path)
+include $(DEFAULT_VARIABLES)
+
+# Same libraries as OvenMediaEngine, so the benchmarks measure the code that is shipped
+LOCAL_STATIC_LIBRARIES := \
+	webrtc_publisher \
+	llhls_publisher \
+	hls_publisher \
+	ovt_publisher \
+	file_publisher \
+	push_publisher \
+	thumbnail_publisher \
+	srt_publisher \
+	ovt_provider \
+	rtmp_provider \
+	srt_provider \
+	mpegts_provider \
+	rtspc_provider \
+	webrtc_provider \
+	scheduled_provider \
+	multiplex_provider \
+	transcoder \
+	rtc_signalling \
+	whip \
+	address_utilities \
+	ice \
+	api_server \
+	json_serdes \
+	bitstream \
+	http \
+	dtls_srtp \
+	rtp_rtcp \
+	sdp \
+	id3v2 \
+	cue_event \
+	amf_event \
+	scte35_event \
+	webvtt_format \
+	segment_writer \
+	web_console \
+	mediarouter \
+	rtsp_module \
+	jitter_buffer \
+	ovt_packetizer \
+	orchestrator \
+	origin_map_client \
+	publisher \
+	application \
+	access_controller \
+	physical_port \
+	socket \
+	ovcrypto \
+	config \
+	ovlibrary \
+	monitoring \
+	json_serdes \
+	jsoncpp \
+	dump \
+	srt \
+	file_provider \
+	managed_queue \
+	ffmpeg_wrapper \
+	event \
+
+LOCAL_PREBUILT_LIBRARIES := \
+	libpugixml.a
+
+LOCAL_LDFLAGS := -lpthread -luuid
+
+$(call add_pkg_config,srt)
+$(call add_pkg_config,libavformat)
+$(call add_pkg_config,libavfilter)
+$(call add_pkg_config,libavcodec)
+$(call add_pkg_config,libswresample)
+$(call add_pkg_config,libswscale)
+$(call add_pkg_config,libavutil)
+$(call add_pkg_config,openssl)
+$(call add_pkg_config,vpx)
+$(call add_pkg_config,opus)
+$(call add_pkg_config,libsrtp2)
+$(call add_pkg_config,libpcre2-8)
+$(call add_pkg_config,hiredis)
+$(call add_pkg_config,spdlog)
+$(call add_pkg_config,whisper)
+
+ifeq ($(call chk_pkg_exist,ffnvcodec),0)
+$(call add_pkg_config,ffnvcodec)
+endif
+
+ifeq ($(shell echo $${OSTYPE}),linux-musl) 
+# For alpine linux
+LOCAL_LDFLAGS += -lexecinfo
+endif
+
+# Setup flags for spdlog
+LOCAL_CFLAGS += -DSPDLOG_COMPILED_LIB -Iprojects/third_party/spdlog-1.15.1/include
+LOCAL_CXXFLAGS += -DSPDLOG_COMPILED_LIB -Iprojects/third_party/spdlog-1.15.1/include
+
+LOCAL_TARGET := OvenMediaEngineBench
+
+include $(BUILD_EXECUTABLE)
+
+# The benchmarks are built by "make bench" only
+BUILD_TARGET_LIST := $(filter-out $(BUILD_TARGET_WITH_PATH),$(BUILD_TARGET_LIST))
+BENCHMARK_TARGET_WITH_PATH := $(BUILD_TARGET_WITH_PATH)
+BUILD_FILES_TO_CLEAN += $(BUILD_TARGET_WITH_PATH)
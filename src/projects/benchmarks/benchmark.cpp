@@ -0,0 +1,676 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "benchmark.h"
+
+#include <main/main.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <thread>
+
+#include "benchmark_private.h"
+
+namespace bench
+{
+	namespace
+	{
+		struct Options
+		{
+			ov::String filter = ".";
+			double min_time = BENCHMARK_DEFAULT_MIN_TIME;
+			ov::String format = "console";
+			ov::String out;
+			ov::String out_format = "json";
+			bool list_tests = false;
+
+			// --<name>=<value> options used by the benchmarks
+			std::map<ov::String, ov::String> extra;
+		};
+
+		struct Result
+		{
+			ov::String name;
+			ov::String run_name;
+			int64_t iterations = 0;
+			double real_time_ns = 0.0;
+			double cpu_time_ns = 0.0;
+			double bytes_per_second = 0.0;
+			double items_per_second = 0.0;
+			ov::String label;
+			bool error_occurred = false;
+			ov::String error_message;
+		};
+
+		Options &GetOptions()
+		{
+			static Options options;
+			return options;
+		}
+
+		int64_t GetThreadCpuTimeNs()
+		{
+			struct timespec ts;
+
+			if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+			{
+				return 0;
+			}
+
+			return (static_cast<int64_t>(ts.tv_sec) * 1000000000LL) + ts.tv_nsec;
+		}
+
+		void PrintUsage(const char *program)
+		{
+			::printf(
+				"Usage: %s [options]\n"
+				"  --benchmark_filter=<regex>      Runs only the benchmarks matching the regex\n"
+				"  --benchmark_min_time=<seconds>  Minimum time to measure a benchmark (default: %.1f)\n"
+				"  --benchmark_format=<console|json>\n"
+				"  --benchmark_out=<file>          Writes the results to the file as JSON\n"
+				"  --benchmark_list_tests          Lists the benchmarks without running them\n"
+				"  --<input>=<file>                Input of a benchmark (e.g. --annexb_1080p=<file>)\n",
+				program, BENCHMARK_DEFAULT_MIN_TIME);
+		}
+
+		bool ParseOptions(int argc, char *argv[])
+		{
+			auto &options = GetOptions();
+
+			for (int index = 1; index < argc; index++)
+			{
+				ov::String argument = argv[index];
+
+				if ((argument == "--help") || (argument == "-h"))
+				{
+					PrintUsage(argv[0]);
+					return false;
+				}
+
+				if (argument == "--benchmark_list_tests")
+				{
+					options.list_tests = true;
+					continue;
+				}
+
+				if ((argument.HasPrefix("--") == false) || (argument.IndexOf('=') < 0))
+				{
+					::fprintf(stderr, "Invalid option: %s\n", argument.CStr());
+					PrintUsage(argv[0]);
+					return false;
+				}
+
+				auto position = argument.IndexOf('=');
+				auto name = argument.Substring(2, position - 2);
+				auto value = argument.Substring(position + 1);
+
+				if (name == "benchmark_filter")
+				{
+					options.filter = value;
+				}
+				else if (name == "benchmark_min_time")
+				{
+					options.min_time = ov::Converter::ToDouble(value.CStr());
+				}
+				else if (name == "benchmark_format")
+				{
+					options.format = value;
+				}
+				else if (name == "benchmark_out")
+				{
+					options.out = value;
+				}
+				else if (name == "benchmark_out_format")
+				{
+					options.out_format = value;
+				}
+				else
+				{
+					options.extra[name] = value;
+				}
+			}
+
+			if (options.min_time <= 0.0)
+			{
+				::fprintf(stderr, "Invalid --benchmark_min_time\n");
+				return false;
+			}
+
+			if ((options.format != "console") && (options.format != "json"))
+			{
+				::fprintf(stderr, "Unsupported --benchmark_format: %s\n", options.format.CStr());
+				return false;
+			}
+
+			if (options.out_format != "json")
+			{
+				::fprintf(stderr, "Unsupported --benchmark_out_format: %s\n", options.out_format.CStr());
+				return false;
+			}
+
+			return true;
+		}
+
+		Result MakeResult(const ov::String &name, const State &state)
+		{
+			Result result;
+
+			result.name = name;
+			result.run_name = name;
+			result.iterations = state.GetIterations();
+			result.label = state.GetLabel();
+			result.error_occurred = state.IsErrorOccurred();
+			result.error_message = state.GetErrorMessage();
+
+			if (result.iterations > 0)
+			{
+				result.real_time_ns = static_cast<double>(state.GetRealTime().count()) / result.iterations;
+				result.cpu_time_ns = static_cast<double>(state.GetCpuTime().count()) / result.iterations;
+			}
+
+			auto seconds = static_cast<double>(state.GetRealTime().count()) / 1000000000.0;
+			if (seconds > 0.0)
+			{
+				result.bytes_per_second = state.GetBytesProcessed() / seconds;
+				result.items_per_second = state.GetItemsProcessed() / seconds;
+			}
+
+			return result;
+		}
+
+		// Increases the iterations until the run takes the minimum time
+		Result RunBenchmark(const Benchmark &benchmark, const ov::String &name, const std::vector<int64_t> &arguments)
+		{
+			const auto min_time = GetOptions().min_time;
+			int64_t iterations = 1;
+
+			while (true)
+			{
+				State state(iterations, arguments);
+
+				benchmark.Run(state);
+
+				if (state.IsErrorOccurred())
+				{
+					return MakeResult(name, state);
+				}
+
+				auto seconds = static_cast<double>(state.GetRealTime().count()) / 1000000000.0;
+
+				if ((seconds >= min_time) || (iterations >= BENCHMARK_MAX_ITERATIONS))
+				{
+					return MakeResult(name, state);
+				}
+
+				// Same as Google Benchmark: aim at 1.4x of the minimum time, grow 10x while the run is too short to predict
+				auto multiplier = min_time * 1.4 / std::max(seconds, 1e-9);
+				if ((seconds / min_time) <= 0.1)
+				{
+					multiplier = std::min(multiplier, 10.0);
+				}
+
+				auto next_iterations = static_cast<int64_t>(multiplier * static_cast<double>(iterations));
+				iterations = std::min(std::max(next_iterations, iterations + 1), BENCHMARK_MAX_ITERATIONS);
+			}
+		}
+
+		ov::String HumanReadable(double value, const char *unit)
+		{
+			static const char *prefixes[] = {"", "k", "M", "G", "T"};
+			size_t index = 0;
+
+			while ((value >= 1000.0) && (index < (OV_COUNTOF(prefixes) - 1)))
+			{
+				value /= 1000.0;
+				index++;
+			}
+
+			return ov::String::FormatString("%.3g%s%s", value, prefixes[index], unit);
+		}
+
+		void PrintConsoleHeader()
+		{
+			::printf("%-56s %15s %15s %12s\n", "Benchmark", "Time", "CPU", "Iterations");
+			::printf("%s\n", ov::String().PadRightString(101, '-').CStr());
+		}
+
+		void PrintConsoleResult(const Result &result)
+		{
+			if (result.error_occurred)
+			{
+				::printf("%-56s ERROR: %s\n", result.name.CStr(), result.error_message.CStr());
+				return;
+			}
+
+			ov::String counters;
+
+			if (result.bytes_per_second > 0.0)
+			{
+				counters.AppendFormat(" bytes_per_second=%s", HumanReadable(result.bytes_per_second, "B/s").CStr());
+			}
+
+			if (result.items_per_second > 0.0)
+			{
+				counters.AppendFormat(" items_per_second=%s", HumanReadable(result.items_per_second, "/s").CStr());
+			}
+
+			if (result.label.IsEmpty() == false)
+			{
+				counters.AppendFormat(" %s", result.label.CStr());
+			}
+
+			::printf("%-56s %12.0f ns %12.0f ns %12" PRId64 "%s\n",
+					 result.name.CStr(), result.real_time_ns, result.cpu_time_ns, result.iterations, counters.CStr());
+			::fflush(stdout);
+		}
+
+		::Json::Value MakeContext(const char *program)
+		{
+			::Json::Value context;
+
+			char date[64]{};
+			auto now = ::time(nullptr);
+			struct tm local_time;
+			::localtime_r(&now, &local_time);
+			::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", &local_time);
+
+			char host_name[256]{};
+			::gethostname(host_name, sizeof(host_name) - 1);
+
+			context["date"] = date;
+			context["host_name"] = host_name;
+			context["executable"] = program;
+			context["num_cpus"] = std::thread::hardware_concurrency();
+#if DEBUG
+			context["library_build_type"] = "debug";
+#else	// DEBUG
+			context["library_build_type"] = "release";
+#endif	// DEBUG
+			context["ome_version"] = OME_VERSION;
+			context["ome_git_version"] = OME_GIT_VERSION;
+
+			return context;
+		}
+
+		::Json::Value MakeJson(const char *program, const std::vector<Result> &results)
+		{
+			::Json::Value root;
+			::Json::Value benchmarks(::Json::arrayValue);
+
+			root["context"] = MakeContext(program);
+
+			for (const auto &result : results)
+			{
+				::Json::Value item;
+
+				item["name"] = result.name.CStr();
+				item["run_name"] = result.run_name.CStr();
+				item["run_type"] = "iteration";
+				item["iterations"] = static_cast<::Json::Int64>(result.iterations);
+
+				if (result.error_occurred)
+				{
+					item["error_occurred"] = true;
+					item["error_message"] = result.error_message.CStr();
+				}
+				else
+				{
+					item["real_time"] = result.real_time_ns;
+					item["cpu_time"] = result.cpu_time_ns;
+					item["time_unit"] = "ns";
+
+					if (result.bytes_per_second > 0.0)
+					{
+						item["bytes_per_second"] = result.bytes_per_second;
+					}
+
+					if (result.items_per_second > 0.0)
+					{
+						item["items_per_second"] = result.items_per_second;
+					}
+
+					if (result.label.IsEmpty() == false)
+					{
+						item["label"] = result.label.CStr();
+					}
+				}
+
+				benchmarks.append(item);
+			}
+
+			root["benchmarks"] = benchmarks;
+
+			return root;
+		}
+	}  // namespace
+
+	//--------------------------------------------------------------------
+	// State
+	//--------------------------------------------------------------------
+	State::State(int64_t max_iterations, const std::vector<int64_t> &arguments)
+		: _max_iterations(max_iterations),
+		  _arguments(arguments)
+	{
+	}
+
+	bool State::KeepRunning()
+	{
+		if (_started == false)
+		{
+			_started = true;
+			StartTimer();
+		}
+
+		if ((_error_occurred == false) && (_iterations < _max_iterations))
+		{
+			_iterations++;
+			return true;
+		}
+
+		if (_running)
+		{
+			StopTimer();
+		}
+
+		return false;
+	}
+
+	int64_t State::GetArgument(size_t index) const
+	{
+		OV_ASSERT(index < _arguments.size(), "Argument %zu is not given", index);
+
+		return (index < _arguments.size()) ? _arguments[index] : 0;
+	}
+
+	void State::PauseTiming()
+	{
+		if (_running)
+		{
+			StopTimer();
+		}
+	}
+
+	void State::ResumeTiming()
+	{
+		if ((_running == false) && _started)
+		{
+			StartTimer();
+		}
+	}
+
+	void State::SetBytesProcessed(int64_t bytes)
+	{
+		_bytes_processed = bytes;
+	}
+
+	void State::SetItemsProcessed(int64_t items)
+	{
+		_items_processed = items;
+	}
+
+	void State::SetLabel(const ov::String &label)
+	{
+		_label = label;
+	}
+
+	void State::SkipWithError(const ov::String &message)
+	{
+		_error_occurred = true;
+		_error_message = message;
+
+		if (_running)
+		{
+			StopTimer();
+		}
+	}
+
+	int64_t State::GetIterations() const
+	{
+		return _iterations;
+	}
+
+	int64_t State::GetMaxIterations() const
+	{
+		return _max_iterations;
+	}
+
+	std::chrono::nanoseconds State::GetRealTime() const
+	{
+		return _real_time;
+	}
+
+	std::chrono::nanoseconds State::GetCpuTime() const
+	{
+		return _cpu_time;
+	}
+
+	int64_t State::GetBytesProcessed() const
+	{
+		return _bytes_processed;
+	}
+
+	int64_t State::GetItemsProcessed() const
+	{
+		return _items_processed;
+	}
+
+	const ov::String &State::GetLabel() const
+	{
+		return _label;
+	}
+
+	bool State::IsErrorOccurred() const
+	{
+		return _error_occurred;
+	}
+
+	const ov::String &State::GetErrorMessage() const
+	{
+		return _error_message;
+	}
+
+	void State::StartTimer()
+	{
+		_running = true;
+		_real_start = std::chrono::steady_clock::now();
+		_cpu_start_ns = GetThreadCpuTimeNs();
+	}
+
+	void State::StopTimer()
+	{
+		_real_time += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _real_start);
+		_cpu_time += std::chrono::nanoseconds(GetThreadCpuTimeNs() - _cpu_start_ns);
+		_running = false;
+	}
+
+	//--------------------------------------------------------------------
+	// Benchmark
+	//--------------------------------------------------------------------
+	namespace
+	{
+		std::vector<std::shared_ptr<Benchmark>> &GetRegistry()
+		{
+			static std::vector<std::shared_ptr<Benchmark>> registry;
+			return registry;
+		}
+	}  // namespace
+
+	Benchmark::Benchmark(const ov::String &name, Function function)
+		: _name(name),
+		  _function(std::move(function))
+	{
+	}
+
+	Benchmark *Benchmark::Register(const char *name, Function function)
+	{
+		auto benchmark = std::make_shared<Benchmark>(name, std::move(function));
+
+		GetRegistry().push_back(benchmark);
+
+		return benchmark.get();
+	}
+
+	const std::vector<std::shared_ptr<Benchmark>> &Benchmark::GetBenchmarks()
+	{
+		return GetRegistry();
+	}
+
+	Benchmark *Benchmark::Arg(int64_t argument)
+	{
+		_arguments_list.push_back({argument});
+		return this;
+	}
+
+	Benchmark *Benchmark::Args(const std::vector<int64_t> &arguments)
+	{
+		_arguments_list.push_back(arguments);
+		return this;
+	}
+
+	const ov::String &Benchmark::GetName() const
+	{
+		return _name;
+	}
+
+	std::vector<std::tuple<ov::String, std::vector<int64_t>>> Benchmark::GetRuns() const
+	{
+		std::vector<std::tuple<ov::String, std::vector<int64_t>>> runs;
+
+		if (_arguments_list.empty())
+		{
+			runs.emplace_back(_name, std::vector<int64_t>());
+			return runs;
+		}
+
+		for (const auto &arguments : _arguments_list)
+		{
+			auto name = _name;
+
+			for (const auto &argument : arguments)
+			{
+				name.AppendFormat("/%" PRId64, argument);
+			}
+
+			runs.emplace_back(name, arguments);
+		}
+
+		return runs;
+	}
+
+	void Benchmark::Run(State &state) const
+	{
+		_function(state);
+	}
+
+	//--------------------------------------------------------------------
+	// Runner
+	//--------------------------------------------------------------------
+	ov::String GetOption(const ov::String &name)
+	{
+		auto &extra = GetOptions().extra;
+		auto item = extra.find(name);
+
+		return (item != extra.end()) ? item->second : "";
+	}
+
+	int RunBenchmarks(int argc, char *argv[])
+	{
+		if (ParseOptions(argc, argv) == false)
+		{
+			return 1;
+		}
+
+		auto &options = GetOptions();
+
+		ov::Regex filter(options.filter.CStr());
+		auto error = filter.Compile();
+		if (error != nullptr)
+		{
+			::fprintf(stderr, "Invalid --benchmark_filter: %s (%s)\n", options.filter.CStr(), error->What());
+			return 1;
+		}
+
+		std::vector<std::tuple<std::shared_ptr<Benchmark>, ov::String, std::vector<int64_t>>> runs;
+
+		for (const auto &benchmark : Benchmark::GetBenchmarks())
+		{
+			for (const auto &[name, arguments] : benchmark->GetRuns())
+			{
+				if (filter.Matches(name.CStr()).IsMatched())
+				{
+					runs.emplace_back(benchmark, name, arguments);
+				}
+			}
+		}
+
+		if (options.list_tests)
+		{
+			for (const auto &run : runs)
+			{
+				::printf("%s\n", std::get<1>(run).CStr());
+			}
+
+			return 0;
+		}
+
+		if (runs.empty())
+		{
+			::fprintf(stderr, "No benchmark matches the filter: %s\n", options.filter.CStr());
+			return 1;
+		}
+
+		bool console = (options.format == "console");
+		std::vector<Result> results;
+		bool error_occurred = false;
+
+		if (console)
+		{
+			PrintConsoleHeader();
+		}
+
+		for (const auto &[benchmark, name, arguments] : runs)
+		{
+			auto result = RunBenchmark(*benchmark, name, arguments);
+
+			if (console)
+			{
+				PrintConsoleResult(result);
+			}
+
+			error_occurred = error_occurred || result.error_occurred;
+			results.push_back(std::move(result));
+		}
+
+		auto json = MakeJson(argv[0], results);
+
+		if (console == false)
+		{
+			::printf("%s\n", ov::Json::Stringify(json, true).CStr());
+		}
+
+		if (options.out.IsEmpty() == false)
+		{
+			std::ofstream file(options.out.CStr(), std::ios::out | std::ios::trunc);
+
+			if (file.is_open() == false)
+			{
+				::fprintf(stderr, "Could not open %s\n", options.out.CStr());
+				return 1;
+			}
+
+			file << ov::Json::Stringify(json, true).CStr() << std::endl;
+
+			if (console)
+			{
+				::printf("\nResults have been written to %s\n", options.out.CStr());
+			}
+		}
+
+		return error_occurred ? 1 : 0;
+	}
+}  // namespace bench
@@ -0,0 +1,146 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+// Default minimum time to measure a benchmark (seconds)
+#define BENCHMARK_DEFAULT_MIN_TIME 0.5
+// Upper bound of the iterations of a run
+#define BENCHMARK_MAX_ITERATIONS static_cast<int64_t>(1000000000)
+
+#define BENCHMARK_CONCAT_INTERNAL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_INTERNAL(a, b)
+
+// Registers a benchmark function: void Function(bench::State &state)
+//
+// BENCHMARK(BM_Something)->Arg(1024)->Arg(4096);
+#define BENCHMARK(function) \
+	static ::bench::Benchmark *BENCHMARK_CONCAT(_benchmark_, __LINE__) [[maybe_unused]] = ::bench::Benchmark::Register(#function, function)
+
+// A small Google Benchmark style harness, so the suite has no third-party dependency.
+//
+// Each benchmark is run with an increasing number of iterations until it takes --benchmark_min_time,
+// and the time per iteration of the last run is reported. The results can be written as JSON
+// in the format of Google Benchmark (--benchmark_out), so existing tools can compare the results.
+namespace bench
+{
+	class State
+	{
+	public:
+		State(int64_t max_iterations, const std::vector<int64_t> &arguments);
+
+		// while (state.KeepRunning()) { ... }
+		bool KeepRunning();
+
+		int64_t GetArgument(size_t index) const;
+
+		// Excludes the setup of an iteration from the measurement
+		void PauseTiming();
+		void ResumeTiming();
+
+		// Total bytes/items processed by all iterations
+		void SetBytesProcessed(int64_t bytes);
+		void SetItemsProcessed(int64_t items);
+
+		void SetLabel(const ov::String &label);
+
+		// Stops the benchmark, the result is reported as an error
+		void SkipWithError(const ov::String &message);
+
+		int64_t GetIterations() const;
+		int64_t GetMaxIterations() const;
+
+		std::chrono::nanoseconds GetRealTime() const;
+		std::chrono::nanoseconds GetCpuTime() const;
+		int64_t GetBytesProcessed() const;
+		int64_t GetItemsProcessed() const;
+		const ov::String &GetLabel() const;
+		bool IsErrorOccurred() const;
+		const ov::String &GetErrorMessage() const;
+
+	private:
+		void StartTimer();
+		void StopTimer();
+
+		int64_t _max_iterations = 0;
+		int64_t _iterations = 0;
+		std::vector<int64_t> _arguments;
+
+		bool _started = false;
+		bool _running = false;
+
+		std::chrono::steady_clock::time_point _real_start;
+		int64_t _cpu_start_ns = 0;
+
+		std::chrono::nanoseconds _real_time{0};
+		std::chrono::nanoseconds _cpu_time{0};
+
+		int64_t _bytes_processed = 0;
+		int64_t _items_processed = 0;
+		ov::String _label;
+
+		bool _error_occurred = false;
+		ov::String _error_message;
+	};
+
+	class Benchmark
+	{
+	public:
+		using Function = std::function<void(State &state)>;
+
+		Benchmark(const ov::String &name, Function function);
+
+		static Benchmark *Register(const char *name, Function function);
+		static const std::vector<std::shared_ptr<Benchmark>> &GetBenchmarks();
+
+		// Adds a run with the argument(s), the run is named <name>/<arg1>/<arg2>/...
+		Benchmark *Arg(int64_t argument);
+		Benchmark *Args(const std::vector<int64_t> &arguments);
+
+		const ov::String &GetName() const;
+		// Returns the name of the runs (one run without arguments if no argument is added)
+		std::vector<std::tuple<ov::String, std::vector<int64_t>>> GetRuns() const;
+
+		void Run(State &state) const;
+
+	private:
+		ov::String _name;
+		Function _function;
+		std::vector<std::vector<int64_t>> _arguments_list;
+	};
+
+	// Returns the value of --<name>=<value> given in the command line (e.g. an input file), or an empty string
+	ov::String GetOption(const ov::String &name);
+
+	// Prevents the compiler from optimizing away a value computed by the benchmark
+	template <typename T>
+	inline void DoNotOptimize(T const &value)
+	{
+		asm volatile(""
+					 :
+					 : "r,m"(value)
+					 : "memory");
+	}
+
+	inline void ClobberMemory()
+	{
+		asm volatile(""
+					 :
+					 :
+					 : "memory");
+	}
+
+	// Parses the command line, runs the benchmarks and reports the results
+	// Returns the exit code of the process
+	int RunBenchmarks(int argc, char *argv[]);
+}  // namespace bench
@@ -0,0 +1,104 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "benchmark.h"
+#include "sample_media.h"
+
+// The appended data is cleared when it reaches this size, so the benchmark measures appends rather than reallocations of a huge buffer
+#define DATA_BENCH_MAX_LENGTH (4 * 1024 * 1024)
+
+namespace
+{
+	// Appends <size> bytes at a time (e.g. RTP payloads, TS packets, fMP4 fragments)
+	void BM_DataAppend(bench::State &state)
+	{
+		auto size = static_cast<size_t>(state.GetArgument(0));
+		auto chunk = bench::CreateRandomData(size, 1);
+		ov::Data data;
+
+		while (state.KeepRunning())
+		{
+			if ((data.GetLength() + size) > DATA_BENCH_MAX_LENGTH)
+			{
+				data.Clear();
+			}
+
+			data.Append(chunk->GetData(), size);
+		}
+
+		bench::DoNotOptimize(data.GetData());
+		state.SetBytesProcessed(state.GetIterations() * size);
+	}
+	BENCHMARK(BM_DataAppend)->Arg(12)->Arg(188)->Arg(1200)->Arg(16 * 1024);
+
+	// Appends to a shared_ptr<ov::Data> that is also referenced elsewhere, as the packagers do with cloned frames
+	void BM_DataCloneAndAppend(bench::State &state)
+	{
+		auto size = static_cast<size_t>(state.GetArgument(0));
+		auto source = bench::CreateRandomData(size, 2);
+		auto chunk = bench::CreateRandomData(188, 3);
+
+		while (state.KeepRunning())
+		{
+			auto data = source->Clone();
+			data->Append(chunk);
+			bench::DoNotOptimize(data);
+		}
+
+		state.SetBytesProcessed(state.GetIterations() * (size + chunk->GetLength()));
+	}
+	BENCHMARK(BM_DataCloneAndAppend)->Arg(1200)->Arg(64 * 1024);
+
+	// Subdata shares the buffer, so it must not depend on the length of the subdata
+	void BM_DataSubdata(bench::State &state)
+	{
+		auto size = static_cast<size_t>(state.GetArgument(0));
+		std::shared_ptr<const ov::Data> source = bench::CreateRandomData(DATA_BENCH_MAX_LENGTH, 4);
+		size_t offset = 0;
+
+		while (state.KeepRunning())
+		{
+			if ((offset + size) > source->GetLength())
+			{
+				offset = 0;
+			}
+
+			auto subdata = source->Subdata(offset, size);
+			bench::DoNotOptimize(subdata);
+
+			offset += size;
+		}
+
+		state.SetItemsProcessed(state.GetIterations());
+	}
+	BENCHMARK(BM_DataSubdata)->Arg(188)->Arg(1200)->Arg(64 * 1024);
+
+	// Copy-on-write of a subdata (GetWritableData detaches the shared buffer)
+	void BM_DataSubdataWrite(bench::State &state)
+	{
+		auto size = static_cast<size_t>(state.GetArgument(0));
+		auto source = bench::CreateRandomData(DATA_BENCH_MAX_LENGTH, 5);
+		size_t offset = 0;
+
+		while (state.KeepRunning())
+		{
+			if ((offset + size) > source->GetLength())
+			{
+				offset = 0;
+			}
+
+			auto subdata = source->Subdata(offset, size);
+			subdata->GetWritableDataAs<uint8_t>()[0] = 0x00;
+			bench::DoNotOptimize(subdata);
+
+			offset += size;
+		}
+
+		state.SetBytesProcessed(state.GetIterations() * size);
+	}
+	BENCHMARK(BM_DataSubdataWrite)->Arg(188)->Arg(1200);
+}  // namespace
@@ -0,0 +1,102 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/containers/bmff/fmp4_packager/fmp4_packager.h>
+
+#include "benchmark.h"
+#include "sample_media.h"
+
+namespace
+{
+	class StorageObserver : public bmff::FMp4StorageObserver
+	{
+	public:
+		void OnFMp4StorageInitialized(const int32_t &track_id) override {}
+		void OnMediaSegmentCreated(const int32_t &track_id, const uint32_t &segment_number) override {}
+		void OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number, bool last_chunk) override
+		{
+			_chunk_count++;
+		}
+		void OnMediaFragmentAppended(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number) override {}
+		void OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t &segment_number) override {}
+
+		uint64_t GetChunkCount() const
+		{
+			return _chunk_count;
+		}
+
+	private:
+		uint64_t _chunk_count = 0;
+	};
+
+	// Builds the fMP4 fragments (moof+mdat) of LL-HLS from H.264 frames: AnnexB to AVCC conversion, sample buffering,
+	// fragment writing and storing the parts/segments (500ms parts, 6s segments)
+	//
+	// Arguments: height (1080 or 2160), progressive part (0 or 1)
+	void BM_FMP4PackagerAppendSample(bench::State &state)
+	{
+		auto height = static_cast<int32_t>(state.GetArgument(0));
+		auto progressive_part = (state.GetArgument(1) != 0);
+
+		auto stream = (height > 1080)
+						  ? bench::GetH264Stream("annexb_4k", 3840, 2160, 20000, 4)
+						  : bench::GetH264Stream("annexb_1080p", 1920, 1080, 6000, 1);
+		if (stream == nullptr)
+		{
+			state.SkipWithError("Could not load the input");
+			return;
+		}
+
+		auto track = bench::CreateH264Track(*stream, 0);
+		if (track == nullptr)
+		{
+			state.SkipWithError("Invalid SPS/PPS");
+			return;
+		}
+
+		bmff::FMP4Storage::Config storage_config;
+		storage_config.max_segments = 10;
+		storage_config.segment_duration_ms = 6000;
+
+		bmff::FMP4Packager::Config packager_config;
+		packager_config.chunk_duration_ms = 500;
+		packager_config.segment_duration_ms = 6000;
+		packager_config.progressive_part = progressive_part;
+
+		auto observer = std::make_shared<StorageObserver>();
+		auto storage = std::make_shared<bmff::FMP4Storage>(observer, track, storage_config, "bench");
+		auto packager = std::make_shared<bmff::FMP4Packager>(storage, track, nullptr, packager_config);
+
+		if (packager->CreateInitializationSegment() == false)
+		{
+			state.SkipWithError("Could not create the initialization segment");
+			return;
+		}
+
+		const auto &frames = stream->frames;
+		const int64_t frame_duration = 90000 / SAMPLE_MEDIA_FRAME_RATE;
+		int64_t bytes = 0;
+		size_t index = 0;
+		int64_t pts = 0;
+
+		while (state.KeepRunning())
+		{
+			const auto &frame = frames[index];
+
+			packager->AppendSample(bench::CreateH264Packet(frame, track->GetId(), pts));
+
+			bytes += frame.data->GetLength();
+			pts += frame_duration;
+			index = (index + 1) % frames.size();
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+		state.SetLabel(ov::String::FormatString("%s, %" PRIu64 " parts", stream->source.CStr(), observer->GetChunkCount()));
+	}
+	BENCHMARK(BM_FMP4PackagerAppendSample)->Args({1080, 0})->Args({1080, 1})->Args({2160, 0})->Args({2160, 1});
+}  // namespace
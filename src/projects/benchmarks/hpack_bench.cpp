@@ -0,0 +1,233 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/http/hpack/decoder.h>
+#include <modules/http/hpack/encoder.h>
+#include <modules/http/hpack/huffman_codec.h>
+
+#include "benchmark.h"
+
+namespace
+{
+	// Index of content-length in the header block, which changes on every response
+	constexpr size_t CONTENT_LENGTH_INDEX = 8;
+
+	// Header fields of an LL-HLS chunklist response sent by Http2Response::SendHeader()
+	std::vector<http::hpack::HeaderField> GetChunklistResponseHeaderFields()
+	{
+		return {
+			{":status", "200"},
+			{"server", "OvenMediaEngine"},
+			{"content-type", "application/vnd.apple.mpegurl"},
+			{"cache-control", "no-cache, no-store, must-revalidate"},
+			{"access-control-allow-origin", "*"},
+			{"access-control-allow-credentials", "true"},
+			{"access-control-allow-headers", "*"},
+			{"content-encoding", "gzip"},
+			{"content-length", "1842"},
+			{"date", "Fri, 16 Oct 2026 12:00:00 GMT"},
+		};
+	}
+
+	// Encodes the response header block of a chunklist on a connection (the dynamic table is kept between responses)
+	void BM_HpackEncodeHeaderBlock(bench::State &state)
+	{
+		http::hpack::Encoder encoder;
+		auto header_fields = GetChunklistResponseHeaderFields();
+		int64_t bytes = 0;
+		int64_t index = 0;
+
+		while (state.KeepRunning())
+		{
+			header_fields[CONTENT_LENGTH_INDEX].SetNameValue("content-length", ov::Converter::ToString(1800 + (index++ % 100)));
+
+			auto encoded_data = encoder.EncodeHeaderBlock(header_fields);
+			if (encoded_data == nullptr)
+			{
+				state.SkipWithError("Could not encode the header block");
+				break;
+			}
+
+			bytes += encoded_data->GetLength();
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+	}
+	BENCHMARK(BM_HpackEncodeHeaderBlock);
+
+	// Encodes the same header fields one by one with indexing, as Http2Response::SendHeader() did
+	// before the header blocks were cached. Compared with BM_HpackEncodeHeaderBlock, this is the gain of the cache.
+	void BM_HpackEncodeFieldByField(bench::State &state)
+	{
+		http::hpack::Encoder encoder;
+		auto header_fields = GetChunklistResponseHeaderFields();
+		int64_t bytes = 0;
+		int64_t index = 0;
+
+		while (state.KeepRunning())
+		{
+			header_fields[CONTENT_LENGTH_INDEX].SetNameValue("content-length", ov::Converter::ToString(1800 + (index++ % 100)));
+
+			auto header_block = std::make_shared<ov::Data>(1024);
+
+			for (const auto &header_field : header_fields)
+			{
+				auto encoded_data = encoder.Encode(header_field, http::hpack::Encoder::EncodingType::LiteralWithIndexing);
+				if (encoded_data == nullptr)
+				{
+					state.SkipWithError("Could not encode the header field");
+					break;
+				}
+
+				header_block->Append(encoded_data);
+			}
+
+			bytes += header_block->GetLength();
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+	}
+	BENCHMARK(BM_HpackEncodeFieldByField);
+
+	// Encodes the header block of the first response of a connection (the cache and the dynamic table are empty)
+	void BM_HpackEncodeHeaderBlockFirstResponse(bench::State &state)
+	{
+		auto header_fields = GetChunklistResponseHeaderFields();
+		int64_t bytes = 0;
+
+		while (state.KeepRunning())
+		{
+			http::hpack::Encoder encoder;
+
+			auto encoded_data = encoder.EncodeHeaderBlock(header_fields);
+			if (encoded_data == nullptr)
+			{
+				state.SkipWithError("Could not encode the header block");
+				break;
+			}
+
+			bytes += encoded_data->GetLength();
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+	}
+	BENCHMARK(BM_HpackEncodeHeaderBlockFirstResponse);
+
+	// A header value that is not indexed (e.g. the URL of a part in a PUSH_PROMISE)
+	ov::String GetHuffmanSample(size_t length)
+	{
+		ov::String sample = "/app/stream/part_0_1234_5_video_a2b4c6d8_llhls.m4s?session=1a2b3c4d5e6f&policy=eyJ1cmxfZXhwaXJlIjoxNzkyMTUyMDAwMDAwfQ&signature=Zm9vYmFyYmF6";
+
+		while (sample.GetLength() < length)
+		{
+			sample.Append(sample);
+		}
+
+		return sample.Left(length);
+	}
+
+	// Arguments: length of the string
+	void BM_HpackHuffmanEncode(bench::State &state)
+	{
+		auto sample = GetHuffmanSample(static_cast<size_t>(state.GetArgument(0)));
+		auto &codec = *http::hpack::HuffmanCodec::GetInstance();
+		int64_t bytes = 0;
+
+		while (state.KeepRunning())
+		{
+			auto encoded_data = codec.Encode(sample);
+			if (encoded_data == nullptr)
+			{
+				state.SkipWithError("Could not encode the string");
+				break;
+			}
+
+			bytes += sample.GetLength();
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+	}
+	BENCHMARK(BM_HpackHuffmanEncode)->Arg(16)->Arg(130)->Arg(1024);
+
+	// Arguments: length of the string
+	void BM_HpackHuffmanDecode(bench::State &state)
+	{
+		auto sample = GetHuffmanSample(static_cast<size_t>(state.GetArgument(0)));
+		auto &codec = *http::hpack::HuffmanCodec::GetInstance();
+
+		auto encoded_data = codec.Encode(sample);
+		if (encoded_data == nullptr)
+		{
+			state.SkipWithError("Could not encode the string");
+			return;
+		}
+
+		int64_t bytes = 0;
+		ov::String decoded;
+
+		while (state.KeepRunning())
+		{
+			// Decode() appends to the string
+			decoded.SetLength(0);
+
+			if (codec.Decode(encoded_data, decoded) == false)
+			{
+				state.SkipWithError("Could not decode the string");
+				break;
+			}
+
+			bytes += decoded.GetLength();
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+	}
+	BENCHMARK(BM_HpackHuffmanDecode)->Arg(16)->Arg(130)->Arg(1024);
+
+	// Decodes the response header block of a chunklist in the steady state
+	// (the fields were added to the dynamic table by the first response)
+	void BM_HpackDecodeHeaderBlock(bench::State &state)
+	{
+		http::hpack::Encoder encoder;
+		http::hpack::Decoder decoder;
+		auto header_fields = GetChunklistResponseHeaderFields();
+
+		auto first_block = encoder.EncodeHeaderBlock(header_fields);
+		auto block = encoder.EncodeHeaderBlock(header_fields);
+
+		std::vector<http::hpack::HeaderField> decoded_fields;
+		if ((first_block == nullptr) || (block == nullptr) || (decoder.Decode(first_block, decoded_fields) == false))
+		{
+			state.SkipWithError("Could not prepare the header block");
+			return;
+		}
+
+		int64_t bytes = 0;
+
+		while (state.KeepRunning())
+		{
+			decoded_fields.clear();
+
+			if (decoder.Decode(block, decoded_fields) == false)
+			{
+				state.SkipWithError("Could not decode the header block");
+				break;
+			}
+
+			bytes += block->GetLength();
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+		state.SetLabel(ov::String::FormatString("%zu bytes/block", block->GetLength()));
+	}
+	BENCHMARK(BM_HpackDecodeHeaderBlock);
+}  // namespace
@@ -0,0 +1,151 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/ice/ice_session.h>
+#include <modules/ice/ice_session_table.h>
+
+#include <random>
+#include <thread>
+
+#include "benchmark.h"
+
+#define ICE_BENCH_SESSION_COUNT 50000
+
+namespace
+{
+	// IcePort kept the sessions in a std::map guarded by one std::shared_mutex before IceSessionTable
+	class SingleLockTable
+	{
+	public:
+		std::shared_ptr<IceSession> Find(const session_id_t &key) const
+		{
+			std::shared_lock<std::shared_mutex> lock(_lock);
+
+			auto item = _map.find(key);
+			if (item == _map.end())
+			{
+				return nullptr;
+			}
+
+			return item->second;
+		}
+
+		bool Add(const session_id_t &key, const std::shared_ptr<IceSession> &ice_session)
+		{
+			std::lock_guard<std::shared_mutex> lock(_lock);
+			return _map.emplace(key, ice_session).second;
+		}
+
+		bool Remove(const session_id_t &key)
+		{
+			std::lock_guard<std::shared_mutex> lock(_lock);
+			return _map.erase(key) > 0;
+		}
+
+	private:
+		std::map<session_id_t, std::shared_ptr<IceSession>> _map;
+		mutable std::shared_mutex _lock;
+	};
+
+	const std::vector<std::shared_ptr<IceSession>> &GetSessions()
+	{
+		static std::vector<std::shared_ptr<IceSession>> sessions = []() {
+			std::vector<std::shared_ptr<IceSession>> sessions;
+
+			for (session_id_t session_id = 0; session_id < ICE_BENCH_SESSION_COUNT; session_id++)
+			{
+				sessions.push_back(std::make_shared<IceSession>(session_id, IceSession::Role::CONTROLLED, nullptr, nullptr, 30000, 0, std::any(), nullptr));
+			}
+
+			return sessions;
+		}();
+
+		return sessions;
+	}
+
+	// Looks up 50k sessions in a random order (a packet to/from each session) while the other threads
+	// look them up as well, and a session is added/removed every <churn_interval> lookups
+	//
+	// Arguments: threads looking up the sessions, churn interval (0: no churn)
+	template <typename Ttable>
+	void RunFindBenchmark(bench::State &state)
+	{
+		auto thread_count = static_cast<int>(state.GetArgument(0));
+		auto churn_interval = state.GetArgument(1);
+
+		const auto &sessions = GetSessions();
+		Ttable table;
+
+		for (const auto &session : sessions)
+		{
+			table.Add(session->GetSessionID(), session);
+		}
+
+		std::vector<session_id_t> keys;
+		std::mt19937 random(1);
+		for (size_t index = 0; index < 65536; index++)
+		{
+			keys.push_back(random() % ICE_BENCH_SESSION_COUNT);
+		}
+
+		std::atomic<bool> stop{false};
+		std::vector<std::thread> threads;
+
+		for (int thread_index = 1; thread_index < thread_count; thread_index++)
+		{
+			threads.emplace_back([&table, &keys, &stop, thread_index]() {
+				size_t index = thread_index * 4099;
+
+				while (stop.load(std::memory_order_relaxed) == false)
+				{
+					bench::DoNotOptimize(table.Find(keys[index++ & 0xFFFF]));
+				}
+			});
+		}
+
+		size_t index = 0;
+		int64_t found_count = 0;
+
+		while (state.KeepRunning())
+		{
+			if ((churn_interval > 0) && ((state.GetIterations() % churn_interval) == 0))
+			{
+				// A session is removed and added again, as sessions come and go
+				const auto &session = sessions[keys[(index * 7) & 0xFFFF]];
+				table.Remove(session->GetSessionID());
+				table.Add(session->GetSessionID(), session);
+			}
+
+			if (table.Find(keys[index++ & 0xFFFF]) != nullptr)
+			{
+				found_count++;
+			}
+		}
+
+		stop = true;
+
+		for (auto &thread : threads)
+		{
+			thread.join();
+		}
+
+		state.SetItemsProcessed(state.GetIterations());
+		state.SetLabel(ov::String::FormatString("%d threads, %" PRId64 " found", thread_count, found_count));
+	}
+
+	void BM_IceSessionTableFind(bench::State &state)
+	{
+		RunFindBenchmark<IceSessionTable<session_id_t>>(state);
+	}
+	BENCHMARK(BM_IceSessionTableFind)->Args({1, 0})->Args({4, 0})->Args({8, 0})->Args({8, 1000});
+
+	void BM_IceSessionSingleLockMapFind(bench::State &state)
+	{
+		RunFindBenchmark<SingleLockTable>(state);
+	}
+	BENCHMARK(BM_IceSessionSingleLockMapFind)->Args({1, 0})->Args({4, 0})->Args({8, 0})->Args({8, 1000});
+}  // namespace
@@ -0,0 +1,192 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <publishers/llhls/llhls_chunklist.h>
+
+#include "benchmark.h"
+#include "sample_media.h"
+
+// Same as the default configuration of the LL-HLS publisher
+#define CHUNKLIST_BENCH_SEGMENT_COUNT 10
+#define CHUNKLIST_BENCH_SEGMENT_DURATION 6
+#define CHUNKLIST_BENCH_PART_DURATION 0.5
+#define CHUNKLIST_BENCH_STREAM_KEY "a2b4c6d8"
+
+namespace
+{
+	std::shared_ptr<LLHlsChunklist> CreateChunklist(const std::shared_ptr<const MediaTrack> &track)
+	{
+		auto track_id = track->GetId();
+		auto chunklist = std::make_shared<LLHlsChunklist>(ov::String::FormatString("chunklist_%d_video_%s_llhls.m3u8", track_id, CHUNKLIST_BENCH_STREAM_KEY),
+														  track,
+														  CHUNKLIST_BENCH_SEGMENT_COUNT,
+														  CHUNKLIST_BENCH_SEGMENT_DURATION,
+														  CHUNKLIST_BENCH_PART_DURATION,
+														  ov::String::FormatString("init_%d_video_%s_llhls.m4s", track_id, CHUNKLIST_BENCH_STREAM_KEY),
+														  true);
+
+		chunklist->SetPartHoldBack(CHUNKLIST_BENCH_PART_DURATION * 3);
+
+		// Full segments and the half of the last one, as LLHlsStream::OnMediaChunkUpdated() appends them
+		auto parts_per_segment = static_cast<int64_t>(CHUNKLIST_BENCH_SEGMENT_DURATION / CHUNKLIST_BENCH_PART_DURATION);
+		int64_t start_time = 1792152000000;
+
+		for (int64_t segment_number = 0; segment_number <= CHUNKLIST_BENCH_SEGMENT_COUNT; segment_number++)
+		{
+			chunklist->CreateSegmentInfo(LLHlsChunklist::SegmentInfo(segment_number, ov::String::FormatString("seg_%d_%" PRId64 "_video_%s_llhls.m4s", track_id, segment_number, CHUNKLIST_BENCH_STREAM_KEY)));
+
+			auto part_count = (segment_number == CHUNKLIST_BENCH_SEGMENT_COUNT) ? (parts_per_segment / 2) : parts_per_segment;
+
+			for (int64_t part_number = 0; part_number < part_count; part_number++)
+			{
+				auto last_part = (part_number == (parts_per_segment - 1));
+				auto next_segment_number = last_part ? (segment_number + 1) : segment_number;
+				auto next_part_number = last_part ? 0 : (part_number + 1);
+
+				chunklist->AppendPartialSegmentInfo(segment_number,
+													LLHlsChunklist::SegmentInfo(part_number, start_time, CHUNKLIST_BENCH_PART_DURATION, 180000,
+																				ov::String::FormatString("part_%d_%" PRId64 "_%" PRId64 "_video_%s_llhls.m4s", track_id, segment_number, part_number, CHUNKLIST_BENCH_STREAM_KEY),
+																				ov::String::FormatString("part_%d_%" PRId64 "_%" PRId64 "_video_%s_llhls.m4s", track_id, next_segment_number, next_part_number, CHUNKLIST_BENCH_STREAM_KEY),
+																				part_number == 0, last_part));
+
+				start_time += static_cast<int64_t>(CHUNKLIST_BENCH_PART_DURATION * 1000);
+			}
+		}
+
+		return chunklist;
+	}
+
+	// A chunklist of the 1080p rendition with the 720p rendition for the rendition reports
+	std::shared_ptr<LLHlsChunklist> CreateAbrChunklist(std::map<int32_t, std::shared_ptr<LLHlsChunklist>> &renditions)
+	{
+		auto stream_1080p = bench::GetH264Stream("annexb_1080p", 1920, 1080, 6000, 1);
+		auto stream_720p = bench::GetH264Stream("annexb_720p", 1280, 720, 3000, 1);
+		if ((stream_1080p == nullptr) || (stream_720p == nullptr))
+		{
+			return nullptr;
+		}
+
+		auto track_1080p = bench::CreateH264Track(*stream_1080p, 0);
+		auto track_720p = bench::CreateH264Track(*stream_720p, 1);
+		if ((track_1080p == nullptr) || (track_720p == nullptr))
+		{
+			return nullptr;
+		}
+
+		renditions[0] = CreateChunklist(track_1080p);
+		renditions[1] = CreateChunklist(track_720p);
+
+		for (const auto &[track_id, rendition] : renditions)
+		{
+			rendition->SetRenditions(renditions);
+		}
+
+		return renditions[0];
+	}
+
+	void ReleaseRenditions(std::map<int32_t, std::shared_ptr<LLHlsChunklist>> &renditions)
+	{
+		for (const auto &[track_id, rendition] : renditions)
+		{
+			rendition->Release();
+		}
+	}
+
+	// Renders a chunklist that is not cached (e.g. the first request of each session after an update,
+	// since the query string contains the session ID)
+	//
+	// Arguments: skip (0 or 1)
+	void BM_LLHlsChunklistMakeChunklist(bench::State &state)
+	{
+		auto skip = (state.GetArgument(0) != 0);
+
+		std::map<int32_t, std::shared_ptr<LLHlsChunklist>> renditions;
+		auto chunklist = CreateAbrChunklist(renditions);
+		if (chunklist == nullptr)
+		{
+			state.SkipWithError("Could not create the chunklist");
+			return;
+		}
+
+		int64_t bytes = 0;
+		uint64_t session_id = 0;
+
+		while (state.KeepRunning())
+		{
+			auto text = chunklist->ToString(ov::String::FormatString("session=%" PRIu64, session_id++), skip, false, true);
+
+			bytes += text.GetLength();
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+
+		ReleaseRenditions(renditions);
+	}
+	BENCHMARK(BM_LLHlsChunklistMakeChunklist)->Arg(0)->Arg(1);
+
+	// Renders and compresses a chunklist that is not cached
+	void BM_LLHlsChunklistMakeGzipChunklist(bench::State &state)
+	{
+		std::map<int32_t, std::shared_ptr<LLHlsChunklist>> renditions;
+		auto chunklist = CreateAbrChunklist(renditions);
+		if (chunklist == nullptr)
+		{
+			state.SkipWithError("Could not create the chunklist");
+			return;
+		}
+
+		int64_t bytes = 0;
+		uint64_t session_id = 0;
+
+		while (state.KeepRunning())
+		{
+			auto gzip = chunklist->ToGzipData(ov::String::FormatString("session=%" PRIu64, session_id++), false, false, true);
+
+			bytes += gzip->GetLength();
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+
+		ReleaseRenditions(renditions);
+	}
+	BENCHMARK(BM_LLHlsChunklistMakeGzipChunklist);
+
+	// Returns the chunklist rendered for the same variant by another session
+	//
+	// Arguments: gzip (0 or 1)
+	void BM_LLHlsChunklistCachedChunklist(bench::State &state)
+	{
+		auto gzip = (state.GetArgument(0) != 0);
+
+		std::map<int32_t, std::shared_ptr<LLHlsChunklist>> renditions;
+		auto chunklist = CreateAbrChunklist(renditions);
+		if (chunklist == nullptr)
+		{
+			state.SkipWithError("Could not create the chunklist");
+			return;
+		}
+
+		while (state.KeepRunning())
+		{
+			if (gzip)
+			{
+				bench::DoNotOptimize(chunklist->ToGzipData("", false, false, true));
+			}
+			else
+			{
+				bench::DoNotOptimize(chunklist->ToString("", false, false, true));
+			}
+		}
+
+		state.SetItemsProcessed(state.GetIterations());
+
+		ReleaseRenditions(renditions);
+	}
+	BENCHMARK(BM_LLHlsChunklistCachedChunklist)->Arg(0)->Arg(1);
+}  // namespace
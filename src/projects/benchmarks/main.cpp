@@ -0,0 +1,30 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <srtp2/srtp.h>
+
+#include "benchmark.h"
+#include "benchmark_private.h"
+
+int main(int argc, char *argv[])
+{
+	// Logs of the modules must not be measured
+	::ov_log_set_level(OVLogLevelWarning);
+
+	auto err = ::srtp_init();
+	if (err != srtp_err_status_ok)
+	{
+		logte("Could not initialize SRTP: %d", err);
+		return 1;
+	}
+
+	auto exit_code = bench::RunBenchmarks(argc, argv);
+
+	::srtp_shutdown();
+
+	return exit_code;
+}
@@ -0,0 +1,127 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/managed_queue/managed_queue.h>
+
+#include <thread>
+
+#include "benchmark.h"
+#include "sample_media.h"
+
+namespace
+{
+	std::shared_ptr<info::ManagedQueue::URN> CreateUrn(const char *name)
+	{
+		return std::make_shared<info::ManagedQueue::URN>("#benchmark#app", "stream", "bench", name);
+	}
+
+	// Enqueue + Dequeue on the same thread (the cost of a queue hop without contention)
+	void BM_ManagedQueueEnqueueDequeue(bench::State &state)
+	{
+		ov::ManagedQueue<std::shared_ptr<ov::Data>> queue(CreateUrn("enqueue_dequeue"));
+		auto item = bench::CreateRandomData(1200, 1);
+
+		while (state.KeepRunning())
+		{
+			queue.Enqueue(item);
+
+			auto dequeued = queue.Dequeue(0);
+			bench::DoNotOptimize(dequeued);
+		}
+
+		state.SetItemsProcessed(state.GetIterations());
+	}
+	BENCHMARK(BM_ManagedQueueEnqueueDequeue);
+
+	// Items are enqueued in bursts of <burst> (e.g. the RTP packets of a frame) and dequeued afterwards
+	void BM_ManagedQueueBurst(bench::State &state)
+	{
+		auto burst = state.GetArgument(0);
+		ov::ManagedQueue<std::shared_ptr<ov::Data>> queue(CreateUrn("burst"));
+		auto item = bench::CreateRandomData(1200, 2);
+
+		while (state.KeepRunning())
+		{
+			for (int64_t index = 0; index < burst; index++)
+			{
+				queue.Enqueue(item);
+			}
+
+			for (int64_t index = 0; index < burst; index++)
+			{
+				auto dequeued = queue.Dequeue(0);
+				bench::DoNotOptimize(dequeued);
+			}
+		}
+
+		state.SetItemsProcessed(state.GetIterations() * burst);
+	}
+	BENCHMARK(BM_ManagedQueueBurst)->Arg(16)->Arg(256);
+
+	// A producer thread and the benchmark thread as the consumer, the time per item is measured
+	void BM_ManagedQueueProducerConsumer(bench::State &state)
+	{
+		ov::ManagedQueue<std::shared_ptr<ov::Data>> queue(CreateUrn("producer_consumer"));
+		auto item = bench::CreateRandomData(1200, 3);
+		auto count = state.GetMaxIterations();
+
+		std::thread producer([&]() {
+			for (int64_t index = 0; index < count; index++)
+			{
+				queue.Enqueue(item);
+			}
+		});
+
+		while (state.KeepRunning())
+		{
+			auto dequeued = queue.Dequeue();
+			bench::DoNotOptimize(dequeued);
+		}
+
+		producer.join();
+
+		state.SetItemsProcessed(state.GetIterations());
+	}
+	BENCHMARK(BM_ManagedQueueProducerConsumer);
+
+	// The ring used by ManagedQueue when <Modules><LockFreeQueue> matches the queue
+	void BM_LockFreeRingProducerConsumer(bench::State &state)
+	{
+		ov::LockFreeRing<std::shared_ptr<ov::Data>> ring(static_cast<size_t>(state.GetArgument(0)));
+		auto item = bench::CreateRandomData(1200, 4);
+		auto count = state.GetMaxIterations();
+
+		std::thread producer([&]() {
+			for (int64_t index = 0; index < count; index++)
+			{
+				auto pushed = item;
+
+				while (ring.TryPush(pushed) == false)
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		while (state.KeepRunning())
+		{
+			std::shared_ptr<ov::Data> popped;
+
+			while (ring.TryPop(popped) == false)
+			{
+				std::this_thread::yield();
+			}
+
+			bench::DoNotOptimize(popped);
+		}
+
+		producer.join();
+
+		state.SetItemsProcessed(state.GetIterations());
+	}
+	BENCHMARK(BM_LockFreeRingProducerConsumer)->Arg(1024);
+}  // namespace
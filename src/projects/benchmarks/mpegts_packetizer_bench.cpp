@@ -0,0 +1,94 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/containers/mpegts/mpegts_packetizer.h>
+
+#include "benchmark.h"
+#include "sample_media.h"
+
+namespace
+{
+	class PacketizerSink : public mpegts::PacketizerSink
+	{
+	public:
+		void OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::vector<std::shared_ptr<mpegts::Packet>> &psi_packets) override
+		{
+		}
+
+		void OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::vector<std::shared_ptr<mpegts::Packet>> &pes_packets) override
+		{
+			_packet_count += pes_packets.size();
+		}
+
+		uint64_t GetPacketCount() const
+		{
+			return _packet_count;
+		}
+
+	private:
+		uint64_t _packet_count = 0;
+	};
+
+	// Builds the PES and the 188 bytes TS packets of H.264 frames
+	//
+	// Arguments: height (1080 or 2160)
+	void BM_MpegTsPacketizerAppendFrame(bench::State &state)
+	{
+		auto height = static_cast<int32_t>(state.GetArgument(0));
+
+		auto stream = (height > 1080)
+						  ? bench::GetH264Stream("annexb_4k", 3840, 2160, 20000, 4)
+						  : bench::GetH264Stream("annexb_1080p", 1920, 1080, 6000, 1);
+		if (stream == nullptr)
+		{
+			state.SkipWithError("Could not load the input");
+			return;
+		}
+
+		auto track = bench::CreateH264Track(*stream, 0);
+		if (track == nullptr)
+		{
+			state.SkipWithError("Invalid SPS/PPS");
+			return;
+		}
+
+		auto sink = std::make_shared<PacketizerSink>();
+		mpegts::Packetizer packetizer;
+
+		packetizer.AddSink(sink);
+
+		if ((packetizer.AddTrack(track) == false) || (packetizer.Start() == false))
+		{
+			state.SkipWithError("Could not start the packetizer");
+			return;
+		}
+
+		const auto &frames = stream->frames;
+		const int64_t frame_duration = 90000 / SAMPLE_MEDIA_FRAME_RATE;
+		int64_t bytes = 0;
+		size_t index = 0;
+		int64_t pts = 0;
+
+		while (state.KeepRunning())
+		{
+			const auto &frame = frames[index];
+
+			packetizer.AppendFrame(bench::CreateH264Packet(frame, track->GetId(), pts));
+
+			bytes += frame.data->GetLength();
+			pts += frame_duration;
+			index = (index + 1) % frames.size();
+		}
+
+		packetizer.Stop();
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+		state.SetLabel(ov::String::FormatString("%s, %" PRIu64 " TS packets", stream->source.CStr(), sink->GetPacketCount()));
+	}
+	BENCHMARK(BM_MpegTsPacketizerAppendFrame)->Arg(1080)->Arg(2160);
+}  // namespace
@@ -0,0 +1,195 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/bitstream/nalu/nal_unit_scanner.h>
+#include <modules/bitstream/nalu/nal_unit_splitter.h>
+
+#include "benchmark.h"
+#include "sample_media.h"
+
+namespace
+{
+	// Argument of the benchmarks : name of NalUnitScanner implementation
+	const char *IMPLEMENTATION_NAMES[] = {"scalar", "sse2", "avx2"};
+
+	std::shared_ptr<const bench::H264Stream> GetStream(int64_t height)
+	{
+		// 4K streams are usually encoded with multiple slices
+		return (height > 1080)
+				   ? bench::GetH264Stream("annexb_4k", 3840, 2160, 20000, 4)
+				   : bench::GetH264Stream("annexb_1080p", 1920, 1080, 6000, 1);
+	}
+
+	bool PrepareImplementation(bench::State &state)
+	{
+		auto index = state.GetArgument(0);
+
+		if ((index < 0) || (index >= static_cast<int64_t>(OV_COUNTOF(IMPLEMENTATION_NAMES))))
+		{
+			state.SkipWithError("Unknown implementation");
+			return false;
+		}
+
+		if (NalUnitScanner::SetImplementation(IMPLEMENTATION_NAMES[index]) == false)
+		{
+			state.SkipWithError(ov::String::FormatString("%s is not supported by the CPU", IMPLEMENTATION_NAMES[index]));
+			return false;
+		}
+
+		return true;
+	}
+
+	// Finds all start codes of the bitstream, as the parsers of the providers do for every frame
+	//
+	// Arguments: implementation (0: scalar, 1: sse2, 2: avx2), height (1080 or 2160)
+	void BM_NalUnitScannerFindAnnexBStartCode(bench::State &state)
+	{
+		if (PrepareImplementation(state) == false)
+		{
+			return;
+		}
+
+		auto stream = GetStream(state.GetArgument(1));
+		if (stream == nullptr)
+		{
+			NalUnitScanner::ResetImplementation();
+			state.SkipWithError("Could not load the input");
+			return;
+		}
+
+		const auto &frames = stream->frames;
+		int64_t bytes = 0;
+		int64_t start_codes = 0;
+		size_t index = 0;
+
+		while (state.KeepRunning())
+		{
+			auto data = frames[index].data->GetDataAs<uint8_t>();
+			auto length = frames[index].data->GetLength();
+			size_t offset = 0;
+			size_t start_code_size = 0;
+
+			while (offset < length)
+			{
+				auto position = NalUnitScanner::FindAnnexBStartCode(data + offset, length - offset, start_code_size);
+				if (position < 0)
+				{
+					break;
+				}
+
+				start_codes++;
+				offset += position + start_code_size;
+			}
+
+			bytes += length;
+			index = (index + 1) % frames.size();
+		}
+
+		NalUnitScanner::ResetImplementation();
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+		state.SetLabel(ov::String::FormatString("%s, %.1f NALs/frame", stream->source.CStr(),
+												static_cast<double>(start_codes) / std::max<int64_t>(state.GetIterations(), 1)));
+	}
+	BENCHMARK(BM_NalUnitScannerFindAnnexBStartCode)
+		->Args({0, 1080})
+		->Args({1, 1080})
+		->Args({2, 1080})
+		->Args({0, 2160})
+		->Args({1, 2160})
+		->Args({2, 2160});
+
+	// Finds all 00 00 0x (x <= 3) sequences of the frames, as NalUnitInsertor does before escaping a NAL unit
+	//
+	// Arguments: implementation (0: scalar, 1: sse2, 2: avx2), height (1080 or 2160)
+	void BM_NalUnitScannerFindEmulationPreventionCandidate(bench::State &state)
+	{
+		if (PrepareImplementation(state) == false)
+		{
+			return;
+		}
+
+		auto stream = GetStream(state.GetArgument(1));
+		if (stream == nullptr)
+		{
+			NalUnitScanner::ResetImplementation();
+			state.SkipWithError("Could not load the input");
+			return;
+		}
+
+		const auto &frames = stream->frames;
+		int64_t bytes = 0;
+		size_t index = 0;
+
+		while (state.KeepRunning())
+		{
+			auto data = frames[index].data->GetDataAs<uint8_t>();
+			auto length = frames[index].data->GetLength();
+			size_t offset = 0;
+
+			while (offset < length)
+			{
+				auto position = NalUnitScanner::FindEmulationPreventionCandidate(data + offset, length - offset);
+				if (position < 0)
+				{
+					break;
+				}
+
+				offset += position + 3;
+			}
+
+			bytes += length;
+			index = (index + 1) % frames.size();
+		}
+
+		NalUnitScanner::ResetImplementation();
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+		state.SetLabel(stream->source);
+	}
+	BENCHMARK(BM_NalUnitScannerFindEmulationPreventionCandidate)
+		->Args({0, 1080})
+		->Args({1, 1080})
+		->Args({2, 1080})
+		->Args({0, 2160})
+		->Args({1, 2160})
+		->Args({2, 2160});
+
+	// Splits frames into NAL units with the implementation chosen at runtime
+	//
+	// Arguments: height (1080 or 2160)
+	void BM_NalUnitSplitterParse(bench::State &state)
+	{
+		auto stream = GetStream(state.GetArgument(0));
+		if (stream == nullptr)
+		{
+			state.SkipWithError("Could not load the input");
+			return;
+		}
+
+		const auto &frames = stream->frames;
+		int64_t bytes = 0;
+		size_t index = 0;
+
+		while (state.KeepRunning())
+		{
+			const auto &data = frames[index].data;
+
+			bench::DoNotOptimize(NalUnitSplitter::Parse(data->GetDataAs<uint8_t>(), data->GetLength()));
+
+			bytes += data->GetLength();
+			index = (index + 1) % frames.size();
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+		state.SetLabel(ov::String::FormatString("%s, %s", stream->source.CStr(), NalUnitScanner::GetImplementationName()));
+	}
+	BENCHMARK(BM_NalUnitSplitterParse)->Arg(1080)->Arg(2160);
+}  // namespace
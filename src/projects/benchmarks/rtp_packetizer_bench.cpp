@@ -0,0 +1,167 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/rtp_rtcp/rtp_packetizer.h>
+
+#include "benchmark.h"
+#include "sample_media.h"
+
+#define RTP_BENCH_SSRC 0x12345678
+#define RTP_BENCH_H264_PAYLOAD_TYPE 98
+#define RTP_BENCH_VP8_PAYLOAD_TYPE 97
+#define RTP_BENCH_RED_PAYLOAD_TYPE 120
+#define RTP_BENCH_ULPFEC_PAYLOAD_TYPE 121
+
+namespace
+{
+	class PacketizerSink : public RtpPacketizerInterface
+	{
+	public:
+		bool OnRtpPacketized(std::shared_ptr<RtpPacket> packet) override
+		{
+			_packet_count++;
+			bench::DoNotOptimize(packet);
+			return true;
+		}
+
+		uint64_t GetPacketCount() const
+		{
+			return _packet_count;
+		}
+
+	private:
+		uint64_t _packet_count = 0;
+	};
+
+	std::shared_ptr<RtpPacketizer> CreatePacketizer(const std::shared_ptr<PacketizerSink> &sink, cmn::MediaCodecId codec_id, uint8_t payload_type, bool ulpfec)
+	{
+		auto packetizer = std::make_shared<RtpPacketizer>(sink);
+
+		packetizer->SetCodec(codec_id);
+		packetizer->SetPayloadType(payload_type);
+		packetizer->SetTrackId(0);
+		packetizer->SetSSRC(RTP_BENCH_SSRC);
+		// Same as the defaults of the WebRTC publisher
+		packetizer->EnableTransportCc(0);
+
+		if (ulpfec)
+		{
+			packetizer->SetUlpfec(RTP_BENCH_RED_PAYLOAD_TYPE, RTP_BENCH_ULPFEC_PAYLOAD_TYPE);
+		}
+
+		return packetizer;
+	}
+
+	// Splits H.264 frames into RTP packets (single NAL/FU-A), as RtcStream::PacketizeVideoFrame() does
+	//
+	// Arguments: height (1080 or 2160), ULPFEC (0 or 1)
+	void BM_RtpPacketizerH264(bench::State &state)
+	{
+		auto height = static_cast<int32_t>(state.GetArgument(0));
+		auto ulpfec = (state.GetArgument(1) != 0);
+
+		auto stream = (height > 1080)
+						  ? bench::GetH264Stream("annexb_4k", 3840, 2160, 20000, 4)
+						  : bench::GetH264Stream("annexb_1080p", 1920, 1080, 6000, 1);
+		if (stream == nullptr)
+		{
+			state.SkipWithError("Could not load the input");
+			return;
+		}
+
+		auto sink = std::make_shared<PacketizerSink>();
+		auto packetizer = CreatePacketizer(sink, cmn::MediaCodecId::H264, RTP_BENCH_H264_PAYLOAD_TYPE, ulpfec);
+
+		RTPVideoHeader rtp_video_header;
+		::memset(&rtp_video_header, 0, sizeof(rtp_video_header));
+		rtp_video_header.codec = cmn::MediaCodecId::H264;
+		rtp_video_header.codec_header.h26X.packetization_mode = H26XPacketizationMode::NonInterleaved;
+
+		const auto &frames = stream->frames;
+		int64_t bytes = 0;
+		size_t index = 0;
+		uint32_t timestamp = 0;
+
+		while (state.KeepRunning())
+		{
+			const auto &frame = frames[index];
+
+			packetizer->Packetize(frame.key_frame ? FrameType::VideoFrameKey : FrameType::VideoFrameDelta,
+								  timestamp, 0,
+								  frame.data->GetDataAs<uint8_t>(), frame.data->GetLength(),
+								  &frame.fragment_header, &rtp_video_header);
+
+			bytes += frame.data->GetLength();
+			timestamp += 90000 / SAMPLE_MEDIA_FRAME_RATE;
+			index = (index + 1) % frames.size();
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+		state.SetLabel(ov::String::FormatString("%s, %" PRIu64 " RTP packets", stream->source.CStr(), sink->GetPacketCount()));
+	}
+	BENCHMARK(BM_RtpPacketizerH264)->Args({1080, 0})->Args({1080, 1})->Args({2160, 0});
+
+	// Splits VP8 frames of the same sizes as the H.264 stream into RTP packets
+	//
+	// Arguments: height (1080 or 2160), ULPFEC (0 or 1)
+	void BM_RtpPacketizerVP8(bench::State &state)
+	{
+		auto height = static_cast<int32_t>(state.GetArgument(0));
+		auto ulpfec = (state.GetArgument(1) != 0);
+
+		auto stream = (height > 1080)
+						  ? bench::GetH264Stream("annexb_4k", 3840, 2160, 20000, 4)
+						  : bench::GetH264Stream("annexb_1080p", 1920, 1080, 6000, 1);
+		if (stream == nullptr)
+		{
+			state.SkipWithError("Could not load the input");
+			return;
+		}
+
+		std::vector<std::tuple<std::shared_ptr<ov::Data>, bool>> frames;
+		for (const auto &frame : stream->frames)
+		{
+			frames.emplace_back(bench::CreateRandomData(frame.data->GetLength(), frames.size()), frame.key_frame);
+		}
+
+		auto sink = std::make_shared<PacketizerSink>();
+		auto packetizer = CreatePacketizer(sink, cmn::MediaCodecId::Vp8, RTP_BENCH_VP8_PAYLOAD_TYPE, ulpfec);
+
+		RTPVideoHeader rtp_video_header;
+		::memset(&rtp_video_header, 0, sizeof(rtp_video_header));
+		rtp_video_header.codec = cmn::MediaCodecId::Vp8;
+		rtp_video_header.codec_header.vp8.InitRTPVideoHeaderVP8();
+
+		int64_t bytes = 0;
+		size_t index = 0;
+		uint32_t timestamp = 0;
+		uint16_t picture_id = 0x8000;
+
+		while (state.KeepRunning())
+		{
+			const auto &[data, key_frame] = frames[index];
+
+			rtp_video_header.codec_header.vp8.picture_id = picture_id;
+
+			packetizer->Packetize(key_frame ? FrameType::VideoFrameKey : FrameType::VideoFrameDelta,
+								  timestamp, 0,
+								  data->GetDataAs<uint8_t>(), data->GetLength(),
+								  nullptr, &rtp_video_header);
+
+			bytes += data->GetLength();
+			timestamp += 90000 / SAMPLE_MEDIA_FRAME_RATE;
+			index = (index + 1) % frames.size();
+			picture_id = (picture_id == 0xFFFF) ? 0x8000 : (picture_id + 1);
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+		state.SetLabel(ov::String::FormatString("%" PRIu64 " RTP packets", sink->GetPacketCount()));
+	}
+	BENCHMARK(BM_RtpPacketizerVP8)->Args({1080, 0})->Args({1080, 1});
+}  // namespace
@@ -0,0 +1,430 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "sample_media.h"
+
+#include <modules/bitstream/h264/h264_decoder_configuration_record.h>
+#include <modules/bitstream/h264/h264_parser.h>
+#include <modules/bitstream/nalu/nal_unit_fragment_header.h>
+#include <modules/bitstream/nalu/nal_unit_scanner.h>
+
+#include <random>
+
+#include "benchmark.h"
+#include "benchmark_private.h"
+
+namespace bench
+{
+	namespace
+	{
+		class RbspWriter
+		{
+		public:
+			RbspWriter()
+				: _writer(64)
+			{
+			}
+
+			void WriteBits(uint32_t bit_count, uint64_t value)
+			{
+				_writer.WriteBits(bit_count, value);
+			}
+
+			// ue(v)
+			void WriteUE(uint32_t value)
+			{
+				uint64_t code = static_cast<uint64_t>(value) + 1;
+				uint32_t bit_count = 0;
+
+				while ((code >> bit_count) > 1)
+				{
+					bit_count++;
+				}
+
+				_writer.WriteBits(bit_count, 0);
+				_writer.WriteBits(bit_count + 1, code);
+			}
+
+			// rbsp_trailing_bits()
+			std::shared_ptr<ov::Data> Finish()
+			{
+				_writer.WriteBits(1, 1);
+
+				auto remainder = _writer.GetBitCount() % 8;
+				if (remainder != 0)
+				{
+					_writer.WriteBits(8 - remainder, 0);
+				}
+
+				return std::make_shared<ov::Data>(_writer.GetData(), _writer.GetDataSize());
+			}
+
+		private:
+			ov::BitWriter _writer;
+		};
+
+		// Inserts emulation prevention bytes, so the NAL unit contains no start code
+		void AppendNalUnit(ov::Data &output, uint8_t nal_header, const uint8_t *rbsp, size_t length)
+		{
+			static const uint8_t start_code[] = {0x00, 0x00, 0x00, 0x01};
+
+			output.Append(start_code, sizeof(start_code));
+			output.Append(&nal_header, 1);
+
+			int zero_count = 0;
+
+			for (size_t index = 0; index < length; index++)
+			{
+				auto byte = rbsp[index];
+
+				if ((zero_count >= 2) && (byte <= 0x03))
+				{
+					uint8_t emulation_prevention = 0x03;
+					output.Append(&emulation_prevention, 1);
+					zero_count = 0;
+				}
+
+				output.Append(&byte, 1);
+				zero_count = (byte == 0x00) ? (zero_count + 1) : 0;
+			}
+
+			// A NAL unit must not end with 00
+			if (zero_count > 0)
+			{
+				uint8_t emulation_prevention = 0x03;
+				output.Append(&emulation_prevention, 1);
+			}
+		}
+
+		// Baseline profile, frame_mbs_only, POC type 2
+		std::shared_ptr<ov::Data> CreateSps(int32_t width, int32_t height)
+		{
+			RbspWriter writer;
+
+			auto width_in_mbs = (width + 15) / 16;
+			auto height_in_mbs = (height + 15) / 16;
+			auto crop_right = (width_in_mbs * 16 - width) / 2;
+			auto crop_bottom = (height_in_mbs * 16 - height) / 2;
+
+			writer.WriteBits(8, 66);								 // profile_idc
+			writer.WriteBits(8, 0xC0);								 // constraint_set0_flag, constraint_set1_flag
+			writer.WriteBits(8, (width * height > 1920 * 1088) ? 51 : 40);  // level_idc
+			writer.WriteUE(0);										 // seq_parameter_set_id
+			writer.WriteUE(0);										 // log2_max_frame_num_minus4
+			writer.WriteUE(2);										 // pic_order_cnt_type
+			writer.WriteUE(1);										 // max_num_ref_frames
+			writer.WriteBits(1, 0);									 // gaps_in_frame_num_value_allowed_flag
+			writer.WriteUE(width_in_mbs - 1);						 // pic_width_in_mbs_minus1
+			writer.WriteUE(height_in_mbs - 1);						 // pic_height_in_map_units_minus1
+			writer.WriteBits(1, 1);									 // frame_mbs_only_flag
+			writer.WriteBits(1, 1);									 // direct_8x8_inference_flag
+
+			if ((crop_right > 0) || (crop_bottom > 0))
+			{
+				writer.WriteBits(1, 1);	 // frame_cropping_flag
+				writer.WriteUE(0);
+				writer.WriteUE(crop_right);
+				writer.WriteUE(0);
+				writer.WriteUE(crop_bottom);
+			}
+			else
+			{
+				writer.WriteBits(1, 0);
+			}
+
+			writer.WriteBits(1, 0);	 // vui_parameters_present_flag
+
+			auto rbsp = writer.Finish();
+
+			ov::Data nal_unit;
+			AppendNalUnit(nal_unit, 0x67, rbsp->GetDataAs<uint8_t>(), rbsp->GetLength());
+
+			// Without the start code
+			return nal_unit.Subdata(4)->Clone();
+		}
+
+		std::shared_ptr<ov::Data> CreatePps()
+		{
+			RbspWriter writer;
+
+			writer.WriteUE(0);		 // pic_parameter_set_id
+			writer.WriteUE(0);		 // seq_parameter_set_id
+			writer.WriteBits(1, 0);	 // entropy_coding_mode_flag
+			writer.WriteBits(1, 0);	 // bottom_field_pic_order_in_frame_present_flag
+			writer.WriteUE(0);		 // num_slice_groups_minus1
+			writer.WriteUE(0);		 // num_ref_idx_l0_default_active_minus1
+			writer.WriteUE(0);		 // num_ref_idx_l1_default_active_minus1
+			writer.WriteBits(1, 0);	 // weighted_pred_flag
+			writer.WriteBits(2, 0);	 // weighted_bipred_idc
+			writer.WriteUE(0);		 // pic_init_qp_minus26 (se)
+			writer.WriteUE(0);		 // pic_init_qs_minus26 (se)
+			writer.WriteUE(0);		 // chroma_qp_index_offset (se)
+			writer.WriteBits(1, 1);	 // deblocking_filter_control_present_flag
+			writer.WriteBits(1, 0);	 // constrained_intra_pred_flag
+			writer.WriteBits(1, 0);	 // redundant_pic_cnt_present_flag
+
+			auto rbsp = writer.Finish();
+
+			ov::Data nal_unit;
+			AppendNalUnit(nal_unit, 0x68, rbsp->GetDataAs<uint8_t>(), rbsp->GetLength());
+
+			return nal_unit.Subdata(4)->Clone();
+		}
+
+		void AppendFrame(H264Stream &stream, std::shared_ptr<ov::Data> data, bool key_frame)
+		{
+			H264Frame frame;
+
+			NalUnitFragmentHeader fragment_header;
+			NalUnitFragmentHeader::Parse(data, fragment_header);
+
+			frame.data = std::move(data);
+			frame.fragment_header = fragment_header._fragment_header;
+			frame.key_frame = key_frame;
+
+			stream.bitstream->Append(frame.data);
+			stream.frames.push_back(std::move(frame));
+		}
+
+		std::shared_ptr<H264Stream> SynthesizeH264Stream(int32_t width, int32_t height, int32_t bitrate_kbps, int32_t slices_per_frame)
+		{
+			auto stream = std::make_shared<H264Stream>();
+
+			stream->source = "synthetic";
+			stream->width = width;
+			stream->height = height;
+			stream->sps = CreateSps(width, height);
+			stream->pps = CreatePps();
+			stream->bitstream = std::make_shared<ov::Data>();
+
+			// An IDR frame is about 6 times larger than a P frame
+			size_t average_frame_size = static_cast<size_t>(bitrate_kbps) * 1000 / 8 / SAMPLE_MEDIA_FRAME_RATE;
+			size_t idr_frame_size = average_frame_size * 6;
+			size_t p_frame_size = (average_frame_size * SAMPLE_MEDIA_GOP_SIZE - idr_frame_size) / (SAMPLE_MEDIA_GOP_SIZE - 1);
+
+			std::mt19937 random(0x0E0E0E0E);
+			std::uniform_int_distribution<int> byte_distribution(0, 255);
+			std::vector<uint8_t> rbsp;
+
+			for (int index = 0; index < SAMPLE_MEDIA_GOP_SIZE; index++)
+			{
+				bool key_frame = (index == 0);
+				auto frame_size = key_frame ? idr_frame_size : p_frame_size;
+				auto slice_size = std::max<size_t>(frame_size / slices_per_frame, 16);
+				auto data = std::make_shared<ov::Data>(frame_size + 1024);
+
+				if (key_frame)
+				{
+					// SPS/PPS are already escaped
+					static const uint8_t start_code[] = {0x00, 0x00, 0x00, 0x01};
+
+					data->Append(start_code, sizeof(start_code));
+					data->Append(stream->sps);
+					data->Append(start_code, sizeof(start_code));
+					data->Append(stream->pps);
+				}
+
+				for (int slice = 0; slice < slices_per_frame; slice++)
+				{
+					rbsp.resize(slice_size);
+
+					for (auto &byte : rbsp)
+					{
+						byte = static_cast<uint8_t>(byte_distribution(random));
+					}
+
+					// first_mb_in_slice is ue(0) ("1") only for the first slice of the picture
+					rbsp[0] = (slice == 0) ? (rbsp[0] | 0x80) : ((rbsp[0] & 0x7F) | 0x01);
+
+					AppendNalUnit(*data, key_frame ? 0x65 : 0x41, rbsp.data(), rbsp.size());
+				}
+
+				AppendFrame(*stream, data, key_frame);
+			}
+
+			return stream;
+		}
+
+		bool IsVcl(uint8_t nal_unit_type)
+		{
+			return (nal_unit_type >= 1) && (nal_unit_type <= 5);
+		}
+
+		std::shared_ptr<H264Stream> LoadH264Stream(const ov::String &path)
+		{
+			auto file = ov::LoadFromFile(path.CStr());
+			if (file == nullptr)
+			{
+				logte("Could not load %s", path.CStr());
+				return nullptr;
+			}
+
+			auto stream = std::make_shared<H264Stream>();
+
+			stream->source = path;
+			stream->bitstream = std::make_shared<ov::Data>();
+
+			auto bitstream = file->GetDataAs<uint8_t>();
+			auto length = file->GetLength();
+
+			size_t start_code_size = 0;
+			auto offset = NalUnitScanner::FindAnnexBStartCode(bitstream, length, start_code_size);
+
+			std::shared_ptr<ov::Data> access_unit;
+			bool key_frame = false;
+			bool has_vcl = false;
+
+			while ((offset >= 0) && (stream->frames.size() < SAMPLE_MEDIA_MAX_FRAMES))
+			{
+				size_t nal_offset = offset + start_code_size;
+				size_t next_start_code_size = 0;
+				auto next = NalUnitScanner::FindAnnexBStartCode(bitstream + nal_offset, length - nal_offset, next_start_code_size);
+				size_t nal_end = (next >= 0) ? (nal_offset + next) : length;
+
+				if (nal_end > nal_offset)
+				{
+					auto nal_unit_type = bitstream[nal_offset] & 0x1F;
+					bool first_slice = IsVcl(nal_unit_type) && ((nal_end - nal_offset) > 1) && ((bitstream[nal_offset + 1] & 0x80) != 0);
+
+					// A new access unit starts with AUD/SPS/PPS/SEI or the first slice of a picture after the previous picture
+					if (has_vcl && ((IsVcl(nal_unit_type) == false) || first_slice))
+					{
+						AppendFrame(*stream, access_unit, key_frame);
+						access_unit = nullptr;
+						key_frame = false;
+						has_vcl = false;
+					}
+
+					if (access_unit == nullptr)
+					{
+						access_unit = std::make_shared<ov::Data>();
+					}
+
+					access_unit->Append(bitstream + offset, nal_end - offset);
+
+					if ((nal_unit_type == 7) && (stream->sps == nullptr))
+					{
+						stream->sps = std::make_shared<ov::Data>(bitstream + nal_offset, nal_end - nal_offset);
+					}
+					else if ((nal_unit_type == 8) && (stream->pps == nullptr))
+					{
+						stream->pps = std::make_shared<ov::Data>(bitstream + nal_offset, nal_end - nal_offset);
+					}
+
+					key_frame = key_frame || (nal_unit_type == 5);
+					has_vcl = has_vcl || IsVcl(nal_unit_type);
+				}
+
+				offset = (next >= 0) ? static_cast<int>(nal_offset + next) : -1;
+				start_code_size = next_start_code_size;
+			}
+
+			if (has_vcl && (stream->frames.size() < SAMPLE_MEDIA_MAX_FRAMES))
+			{
+				AppendFrame(*stream, access_unit, key_frame);
+			}
+
+			H264SPS sps;
+			if ((stream->sps == nullptr) || (stream->pps == nullptr) ||
+				(H264Parser::ParseSPS(stream->sps->GetDataAs<uint8_t>(), stream->sps->GetLength(), sps) == false))
+			{
+				logte("%s has no valid SPS/PPS", path.CStr());
+				return nullptr;
+			}
+
+			if (stream->frames.empty() || (stream->frames[0].key_frame == false))
+			{
+				logte("%s must start with an IDR frame", path.CStr());
+				return nullptr;
+			}
+
+			stream->width = sps.GetWidth();
+			stream->height = sps.GetHeight();
+
+			return stream;
+		}
+	}  // namespace
+
+	std::shared_ptr<const H264Stream> GetH264Stream(const ov::String &option, int32_t width, int32_t height, int32_t bitrate_kbps, int32_t slices_per_frame)
+	{
+		static std::mutex mutex;
+		static std::map<ov::String, std::shared_ptr<const H264Stream>> streams;
+
+		auto path = GetOption(option);
+		auto key = path.IsEmpty() ? ov::String::FormatString("%dx%d/%d/%d", width, height, bitrate_kbps, slices_per_frame) : path;
+
+		std::lock_guard<std::mutex> lock_guard(mutex);
+
+		auto item = streams.find(key);
+		if (item != streams.end())
+		{
+			return item->second;
+		}
+
+		std::shared_ptr<const H264Stream> stream = path.IsEmpty()
+													   ? SynthesizeH264Stream(width, height, bitrate_kbps, slices_per_frame)
+													   : LoadH264Stream(path);
+
+		streams.emplace(key, stream);
+
+		return stream;
+	}
+
+	std::shared_ptr<ov::Data> CreateRandomData(size_t length, uint32_t seed)
+	{
+		std::mt19937 random(seed);
+		std::uniform_int_distribution<int> byte_distribution(0, 255);
+
+		auto data = std::make_shared<ov::Data>(length);
+		data->SetLength(length);
+
+		auto bytes = data->GetWritableDataAs<uint8_t>();
+		for (size_t index = 0; index < length; index++)
+		{
+			bytes[index] = static_cast<uint8_t>(byte_distribution(random));
+		}
+
+		return data;
+	}
+
+	std::shared_ptr<MediaTrack> CreateH264Track(const H264Stream &stream, uint32_t track_id)
+	{
+		auto avc_config = std::make_shared<AVCDecoderConfigurationRecord>();
+
+		if ((avc_config->AddSPS(stream.sps) == false) || (avc_config->AddPPS(stream.pps) == false))
+		{
+			return nullptr;
+		}
+
+		auto track = std::make_shared<MediaTrack>();
+
+		track->SetId(track_id);
+		track->SetMediaType(cmn::MediaType::Video);
+		track->SetCodecId(cmn::MediaCodecId::H264);
+		track->SetOriginBitstream(cmn::BitstreamFormat::H264_ANNEXB);
+		track->SetTimeBase(1, 90000);
+		track->SetVideoTimestampScale(1.0);
+		track->SetWidth(stream.width);
+		track->SetHeight(stream.height);
+		track->SetFrameRateByConfig(SAMPLE_MEDIA_FRAME_RATE);
+		track->SetDecoderConfigurationRecord(avc_config);
+
+		return track;
+	}
+
+	std::shared_ptr<MediaPacket> CreateH264Packet(const H264Frame &frame, uint32_t track_id, int64_t pts)
+	{
+		auto packet = std::make_shared<MediaPacket>(0, cmn::MediaType::Video, track_id,
+													frame.data, pts, pts, 90000 / SAMPLE_MEDIA_FRAME_RATE,
+													frame.key_frame ? MediaPacketFlag::Key : MediaPacketFlag::NoFlag,
+													cmn::BitstreamFormat::H264_ANNEXB, cmn::PacketType::NALU);
+
+		packet->SetFragHeader(&frame.fragment_header);
+
+		return packet;
+	}
+}  // namespace bench
@@ -0,0 +1,60 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/media_track.h>
+#include <base/mediarouter/media_buffer.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+// Frame rate and GOP of the synthesized streams
+#define SAMPLE_MEDIA_FRAME_RATE 30
+#define SAMPLE_MEDIA_GOP_SIZE 60
+// Maximum number of frames loaded from an input file
+#define SAMPLE_MEDIA_MAX_FRAMES 600
+
+namespace bench
+{
+	struct H264Frame
+	{
+		// Annex-B
+		std::shared_ptr<ov::Data> data;
+		FragmentationHeader fragment_header;
+		bool key_frame = false;
+	};
+
+	struct H264Stream
+	{
+		// "synthetic" or the path of the input file
+		ov::String source;
+
+		int32_t width = 0;
+		int32_t height = 0;
+
+		// NAL units without the start code
+		std::shared_ptr<ov::Data> sps;
+		std::shared_ptr<ov::Data> pps;
+
+		std::vector<H264Frame> frames;
+
+		// All frames in a row
+		std::shared_ptr<ov::Data> bitstream;
+	};
+
+	// Returns the H.264 Annex-B stream given by --<option>=<file>, so the benchmarks can run over real bitstreams.
+	// If the option is not given, a stream of <width>x<height> at <bitrate_kbps> with <slices_per_frame> slices is synthesized:
+	// the slice data is random (as CABAC output is), with emulation prevention bytes inserted.
+	//
+	// The streams are cached, nullptr if the file could not be loaded.
+	std::shared_ptr<const H264Stream> GetH264Stream(const ov::String &option, int32_t width, int32_t height, int32_t bitrate_kbps, int32_t slices_per_frame);
+
+	// Random data of a VP8 frame (the packetizer does not parse the payload)
+	std::shared_ptr<ov::Data> CreateRandomData(size_t length, uint32_t seed);
+
+	std::shared_ptr<MediaTrack> CreateH264Track(const H264Stream &stream, uint32_t track_id);
+	std::shared_ptr<MediaPacket> CreateH264Packet(const H264Frame &frame, uint32_t track_id, int64_t pts);
+}  // namespace bench
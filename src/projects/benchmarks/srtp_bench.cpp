@@ -0,0 +1,81 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/ovlibrary/byte_io.h>
+#include <modules/dtls_srtp/srtp_adapter.h>
+#include <openssl/srtp.h>
+
+#include "benchmark.h"
+#include "sample_media.h"
+
+#define SRTP_BENCH_RTP_HEADER_SIZE 12
+#define SRTP_BENCH_MTU 1500
+
+namespace
+{
+	// Protects an RTP packet in place, as SrtpTransport::SendData() does for every packet sent to a WebRTC player
+	//
+	// Arguments: crypto suite (0: AES_CM_128_HMAC_SHA1_80, 1: AEAD_AES_128_GCM), payload size
+	void BM_SrtpProtectRtp(bench::State &state)
+	{
+		auto suite = state.GetArgument(0);
+		auto payload_size = static_cast<size_t>(state.GetArgument(1));
+
+		// master key + master salt
+		uint64_t crypto_suite = (suite == 0) ? SRTP_AES128_CM_SHA1_80 : SRTP_AEAD_AES_128_GCM;
+		size_t key_length = (suite == 0) ? (16 + 14) : (16 + 12);
+
+		SrtpAdapter adapter;
+		if (adapter.SetKey(ssrc_any_outbound, crypto_suite, bench::CreateRandomData(key_length, 1)->Clone()) == false)
+		{
+			state.SkipWithError("Could not set the key");
+			return;
+		}
+
+		auto payload = bench::CreateRandomData(payload_size, 2);
+
+		// The packet is written into the same buffer every time, the tailroom keeps the auth tag
+		auto packet = std::make_shared<ov::Data>(SRTP_BENCH_MTU);
+		packet->SetLength(SRTP_BENCH_RTP_HEADER_SIZE + payload_size);
+
+		auto buffer = packet->GetWritableDataAs<uint8_t>();
+		::memset(buffer, 0, SRTP_BENCH_RTP_HEADER_SIZE);
+		// V=2, PT=98
+		buffer[0] = 0x80;
+		buffer[1] = 98;
+		ByteWriter<uint32_t>::WriteBigEndian(buffer + 8, 0x12345678);
+		::memcpy(buffer + SRTP_BENCH_RTP_HEADER_SIZE, payload->GetData(), payload_size);
+
+		uint16_t sequence_number = 0;
+		uint32_t timestamp = 0;
+		int64_t bytes = 0;
+
+		while (state.KeepRunning())
+		{
+			// ProtectRtp() encrypts the payload and appends the auth tag, so the packet is restored every time
+			packet->SetLength(SRTP_BENCH_RTP_HEADER_SIZE + payload_size);
+			buffer = packet->GetWritableDataAs<uint8_t>();
+
+			ByteWriter<uint16_t>::WriteBigEndian(buffer + 2, sequence_number++);
+			ByteWriter<uint32_t>::WriteBigEndian(buffer + 4, timestamp);
+
+			if (adapter.ProtectRtp(packet) == false)
+			{
+				state.SkipWithError("Could not protect the packet");
+				break;
+			}
+
+			bytes += payload_size;
+			timestamp += 3000;
+		}
+
+		state.SetBytesProcessed(bytes);
+		state.SetItemsProcessed(state.GetIterations());
+		state.SetLabel((suite == 0) ? "AES_CM_128_HMAC_SHA1_80" : "AEAD_AES_128_GCM");
+	}
+	BENCHMARK(BM_SrtpProtectRtp)->Args({0, 160})->Args({0, 1200})->Args({1, 160})->Args({1, 1200});
+}  // namespace
@@ -13,6 +13,7 @@
 namespace cfg
 {
 	std::shared_ptr<LoggerTagInfo> ParseTag(pugi::xml_node tag_node);
+	ConfigLoggerLoader::AsyncInfo ParseAsync(pugi::xml_node async_node);
 
 	ConfigLoggerLoader::ConfigLoggerLoader()
 	{
@@ -54,10 +55,11 @@ namespace cfg
 				_tags.push_back(tag_info);
 			}
 
-			tag_node = tag_node.next_sibling();
+			tag_node = tag_node.next_sibling("Tag");
 		}
 
 		_log_path = logger_node.child_value("Path");
+		_async_info = ParseAsync(logger_node.child("Async"));
 		_version  = logger_node.attribute("version").value();
 	}
 
@@ -83,6 +85,11 @@ namespace cfg
 		return _version;
 	}
 
+	const ConfigLoggerLoader::AsyncInfo &ConfigLoggerLoader::GetAsyncInfo() const noexcept
+	{
+		return _async_info;
+	}
+
 	std::shared_ptr<LoggerTagInfo> ParseTag(pugi::xml_node tag_node)
 	{
 		std::shared_ptr<LoggerTagInfo> tag_info = std::make_shared<LoggerTagInfo>();
@@ -100,4 +107,52 @@ namespace cfg
 
 		return tag_info;
 	}
+
+	ConfigLoggerLoader::AsyncInfo ParseAsync(pugi::xml_node async_node)
+	{
+		ConfigLoggerLoader::AsyncInfo async_info;
+
+		if (async_node.empty())
+		{
+			return async_info;
+		}
+
+		async_info.enable = ov::Converter::ToBool(async_node.child_value("Enable"));
+
+		auto queue_size_node = async_node.child("QueueSize");
+		if (queue_size_node.empty() == false)
+		{
+			auto queue_size = ov::Converter::ToInt32(queue_size_node.child_value());
+
+			if (queue_size <= 0)
+			{
+				throw CreateConfigError("Invalid queue size: %s (<Async><QueueSize>)", queue_size_node.child_value());
+			}
+
+			async_info.queue_size = queue_size;
+		}
+
+		auto overflow_policy_node = async_node.child("OverflowPolicy");
+		if (overflow_policy_node.empty() == false)
+		{
+			ov::String overflow_policy = ov::String(overflow_policy_node.child_value()).Trim().LowerCaseString();
+
+			if (overflow_policy == "drop")
+			{
+				async_info.overflow_policy = OVLogOverflowPolicyDrop;
+			}
+			else if (overflow_policy == "block")
+			{
+				async_info.overflow_policy = OVLogOverflowPolicyBlock;
+			}
+			else
+			{
+				throw CreateConfigError("Invalid overflow policy: %s (<Async><OverflowPolicy>, must be drop or block)", overflow_policy.CStr());
+			}
+		}
+
+		async_info.fsync_interval_ms = std::max(ov::Converter::ToInt32(async_node.child_value("FsyncInterval")), 0);
+
+		return async_info;
+	}
 }  // namespace cfg
@@ -17,6 +17,17 @@ namespace cfg
 	class ConfigLoggerLoader : public ConfigLoader
 	{
 	public:
+		// <Async>
+		struct AsyncInfo
+		{
+			bool enable = false;
+			// Maximum number of pending logs per thread
+			size_t queue_size = 8192;
+			OVLogOverflowPolicy overflow_policy = OVLogOverflowPolicyDrop;
+			// 0: never fsync()
+			int fsync_interval_ms = 0;
+		};
+
 		ConfigLoggerLoader();
 		explicit ConfigLoggerLoader(const ov::String config_path);
 		virtual ~ConfigLoggerLoader();
@@ -29,10 +40,12 @@ namespace cfg
 		std::vector<std::shared_ptr<LoggerTagInfo>> GetTags() const noexcept;
 		ov::String GetLogPath() const noexcept;
 		ov::String GetVersion() const noexcept;
+		const AsyncInfo &GetAsyncInfo() const noexcept;
 
 	private:
 		std::vector<std::shared_ptr<LoggerTagInfo>> _tags;
 		ov::String _log_path;
 		ov::String _version = "1.0";
+		AsyncInfo _async_info;
 	};
 }  // namespace cfg
\ No newline at end of file
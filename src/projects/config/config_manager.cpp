@@ -218,6 +218,9 @@ namespace cfg
 		auto log_path = logger_loader->GetLogPath();
 		::ov_log_set_path(log_path.CStr());
 
+		auto &async_info = logger_loader->GetAsyncInfo();
+		::ov_log_set_async(async_info.enable, async_info.queue_size, async_info.overflow_policy, async_info.fsync_interval_ms);
+
 		// For event logger
 		MonitorInstance->SetLogPath(log_path.CStr());
 
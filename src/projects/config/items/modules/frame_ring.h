@@ -0,0 +1,60 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		struct FrameRing : public ModuleTemplate
+		{
+		protected:
+			int _capacity = 1024;
+
+		public:
+			FrameRing(bool enable) : ModuleTemplate(enable)
+			{
+			}
+
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetCapacity, _capacity)
+
+		protected:
+			void MakeList() override
+			{
+				ModuleTemplate::MakeList();
+
+				/**
+					Outbound frame ring
+
+					Each outbound stream keeps its frames once in a ring read by all publishers, instead of
+					a copy of the queue per publisher. A publisher that falls more than <Capacity> frames behind
+					skips the overwritten video/audio frames (video resumes from the next key frame).
+					Data frames (events, ID3, subtitles) are kept until they are read, up to <Capacity> of them.
+					Frames read by all publishers are released right away, so <Capacity> only bounds the memory
+					used while a publisher is lagging. <Capacity> counts the frames of all tracks:
+					1024 frames are about 13 seconds of a 30 fps video track with a 48 kHz AAC track (~47 frames/s),
+					and less for a stream with several renditions.
+
+					If disabled, the frames are queued to each publisher as before.
+
+					server.xml:
+						<Modules>
+							<FrameRing>
+								<Enable>false</Enable>
+								<!-- Maximum number of frames kept per stream -->
+								<Capacity>1024</Capacity>
+							</FrameRing>
+						</Modules>
+				*/
+				Register<Optional>("Capacity", &_capacity);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
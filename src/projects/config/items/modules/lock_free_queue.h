@@ -0,0 +1,59 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		struct LockFreeQueue : public ModuleTemplate
+		{
+		protected:
+			int _capacity = 1024;
+			std::vector<ov::String> _urn_list;
+
+		public:
+			// Experimental feature is disabled by default
+			LockFreeQueue(bool enable) : ModuleTemplate(enable)
+			{
+			}
+
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetCapacity, _capacity)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetUrnList, _urn_list)
+
+		protected:
+			void MakeList() override
+			{
+				ModuleTemplate::MakeList();
+
+				/**
+					[Experimental] Lock-free managed queue
+
+					Managed queues whose URN matches one of the wildcard patterns use a bounded lock-free ring
+					instead of the mutex-protected linked list. Queues that need buffering delay or
+					exceed-wait keep the default implementation.
+
+					server.xml:
+						<Modules>
+							<LockFreeQueue>
+								<Enable>true</Enable>
+								<!-- Number of slots in the ring (rounded up to a power of two) -->
+								<Capacity>1024</Capacity>
+								<Urn>mngq:v=*:s=*:p=pub:n=streamworker_*</Urn>
+								<Urn>mngq:v=*:s=*:p=imr:n=streamworker</Urn>
+							</LockFreeQueue>
+						</Modules>
+				*/
+				Register<Optional>("Capacity", &_capacity);
+				Register<Optional>("Urn", &_urn_list);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
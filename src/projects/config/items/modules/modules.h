@@ -8,8 +8,11 @@
 //==============================================================================
 #pragma once
 
+#include "frame_ring.h"
+#include "lock_free_queue.h"
 #include "p2p.h"
 #include "recovery.h"
+#include "reuse_port.h"
 
 namespace cfg
 {
@@ -29,6 +32,18 @@ namespace cfg
 			ModuleTemplate _etag{false};
 			// Experimental feature is disabled by default
 			ModuleTemplate _ertmp{false};
+			// Experimental feature is disabled by default
+			LockFreeQueue _lock_free_queue{false};
+			// Experimental feature is disabled by default
+			ReusePort _reuse_port{false};
+			// Experimental feature is disabled by default
+			//
+			// Encrypts outgoing TLS records of HTTPS/WSS connections in the kernel (Linux kTLS),
+			// so responses are written in plain text (and stored segments are sent using sendfile()).
+			// Connections whose cipher is not supported by the kernel are encrypted in user space as before.
+			ModuleTemplate _ktls{false};
+			// Experimental feature is disabled by default
+			FrameRing _frame_ring{false};
 
 		public:
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetHttp2, _http2)
@@ -38,6 +53,10 @@ namespace cfg
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetDynamicAppRemoval, _dynamic_app_removal)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetETag, _etag)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetERTMP, _ertmp)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetLockFreeQueue, _lock_free_queue)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetReusePort, _reuse_port)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetKTLS, _ktls)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetFrameRing, _frame_ring)
 
 		protected:
 			void MakeList() override
@@ -49,6 +68,10 @@ namespace cfg
 				Register<Optional>("DynamicAppRemoval", &_dynamic_app_removal);
 				Register<Optional>("ETag", &_etag);
 				Register<Optional>("ERTMP", &_ertmp);
+				Register<Optional>("LockFreeQueue", &_lock_free_queue);
+				Register<Optional>("ReusePort", &_reuse_port);
+				Register<Optional>("KTLS", &_ktls);
+				Register<Optional>("FrameRing", &_frame_ring);
 			}
 		};
 	}  // namespace modules
@@ -0,0 +1,54 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		struct ReusePort : public ModuleTemplate
+		{
+		protected:
+			bool _cpu_affinity = false;
+
+		public:
+			// Experimental feature is disabled by default
+			ReusePort(bool enable) : ModuleTemplate(enable)
+			{
+			}
+
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsCpuAffinityEnabled, _cpu_affinity)
+
+		protected:
+			void MakeList() override
+			{
+				ModuleTemplate::MakeList();
+
+				/**
+					[Experimental] SO_REUSEPORT listeners
+
+					TCP/UDP physical ports open one listening socket per socket pool worker with SO_REUSEPORT,
+					so the kernel spreads connections/datagrams over the workers instead of waking them all up
+					on a single shared socket. SRT ports and ports using thread-per-socket are not affected.
+
+					server.xml:
+						<Modules>
+							<ReusePort>
+								<Enable>true</Enable>
+								<!-- Pin each worker thread to a CPU -->
+								<CpuAffinity>false</CpuAffinity>
+							</ReusePort>
+						</Modules>
+				*/
+				Register<Optional>("CpuAffinity", &_cpu_affinity);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
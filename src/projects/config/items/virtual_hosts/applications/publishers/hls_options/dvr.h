@@ -22,12 +22,15 @@ namespace cfg
 					bool _enabled				  = false;
 					ov::String _temp_storage_path = "/tmp/ll_hls_dvr";
 					int _max_duration			  = 3600;
+					// MB, 0 means no limit
+					int _max_storage_size		  = 0;
 					bool _event_playlist_type	  = false;
 
 				public:
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsEnabled, _enabled)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetTempStoragePath, _temp_storage_path)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxDuration, _max_duration)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxStorageSize, _max_storage_size)
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsEventPlaylistType, _event_playlist_type)
 
 				protected:
@@ -36,6 +39,7 @@ namespace cfg
 						Register<Optional>("Enable", &_enabled);
 						Register<Optional>("TempStoragePath", &_temp_storage_path);
 						Register<Optional>("MaxDuration", &_max_duration);
+						Register<Optional>("MaxStorageSize", &_max_storage_size);
 						Register<Optional>("EventPlaylistType", &_event_playlist_type);
 					}
 				};
@@ -25,6 +25,12 @@ namespace cfg
 					double _chunk_duration	  = 0.5;
 					double _part_hold_back	  = 0;	// it will be set to 3 * chunk_duration automatically
 					bool _enable_preload_hint = true;
+					// HTTP/2 server push of the part that the preload hint points to
+					bool _enable_preload_hint_push = false;
+					// Sends the part being built progressively (HTTP/1.1 chunked transfer, HTTP/2 DATA frames)
+					bool _enable_progressive_part_delivery = false;
+					// Threads that package the tracks of a stream in parallel (0: packaged by the thread that receives the frames)
+					int _packaging_worker_count = 0;
 					Drm _drm;
 
 				public:
@@ -36,6 +42,9 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetChunkDuration, _chunk_duration)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetPartHoldBack, _part_hold_back)
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsPreloadHintEnabled, _enable_preload_hint)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsPreloadHintPushEnabled, _enable_preload_hint_push)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsProgressivePartDeliveryEnabled, _enable_progressive_part_delivery)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetPackagingWorkerCount, _packaging_worker_count)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetDrm, _drm)
 
 				protected:
@@ -46,6 +55,9 @@ namespace cfg
 						Register<Optional>("ChunkDuration", &_chunk_duration);
 						Register<Optional>("PartHoldBack", &_part_hold_back);
 						Register<Optional>("EnablePreloadHint", &_enable_preload_hint);
+						Register<Optional>("EnablePreloadHintPush", &_enable_preload_hint_push);
+						Register<Optional>("EnableProgressivePartDelivery", &_enable_progressive_part_delivery);
+						Register<Optional>("PackagingWorkerCount", &_packaging_worker_count);
 						Register<Optional>("DRM", &_drm);
 					}
 				};
@@ -67,12 +67,11 @@ namespace cfg
 								{
 									_bandwidth_estimation_type = WebRtcBandwidthEstimationType::REMB;
 								}
-								// Not yet supported
-								// else if (_bwe.UpperCaseString() == "TRANSPORTCC")
-								// {
-								// 	_bandwidth_estimation_type = BandwidthEstimationType::TransportCc;
-									
-								// }
+								// Send-side estimation, the packets are paced using the estimate
+								else if (_bwe.UpperCaseString() == "TRANSPORTCC")
+								{
+									_bandwidth_estimation_type = WebRtcBandwidthEstimationType::TransportCc;
+								}
 								else
 								{
 									return CreateConfigErrorPtr("Invalid value for BWE. Valid values are 'TransportCC' or 'REMB'");
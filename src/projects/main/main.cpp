@@ -16,6 +16,7 @@
 #include <config/config_manager.h>
 #include <mediarouter/mediarouter.h>
 #include <modules/address/address_utilities.h>
+#include <modules/managed_queue/lock_free_queue_settings.h>
 #include <modules/sdp/sdp_regex_pattern.h>
 #include <monitoring/monitoring.h>
 #include <orchestrator/orchestrator.h>
@@ -102,6 +103,10 @@ int main(int argc, char *argv[])
 	// Set Default CORS for HTTP Server
 	http::svr::HttpServerManager::GetInstance()->SetDefaultCrosssDomains(server_config->GetDefaults().GetCrossDomains());
 
+	// Managed queues that use the lock-free ring
+	auto &lock_free_queue_config = server_config->GetModules().GetLockFreeQueue();
+	ov::LockFreeQueueSettings::Set(lock_free_queue_config.IsEnabled(), lock_free_queue_config.GetCapacity(), lock_free_queue_config.GetUrnList());
+
 	// Precompile SDP patterns for better performance.
 	if (SDPRegexPattern::GetInstance()->Compile() == false)
 	{
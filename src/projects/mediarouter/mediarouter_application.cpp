@@ -998,6 +998,13 @@ void MediaRouteApplication::OutboundWorkerThread(uint32_t worker_id)
 			NotifyStreamPrepared(stream);
 		}
 
+		// The frame is stored once, and publishers read it from the ring (<Modules><FrameRing>)
+		auto &frame_ring = stream->GetFrameRing();
+		if (frame_ring != nullptr)
+		{
+			frame_ring->Push(media_packet);
+		}
+
 		std::shared_lock<std::shared_mutex> lock(_observers_lock);
 		auto observers = _observers; // Avoid deadlock
 		lock.unlock();
@@ -1009,7 +1016,11 @@ void MediaRouteApplication::OutboundWorkerThread(uint32_t worker_id)
 			{
 				// Get Stream Info
 				auto stream_info = stream->GetStream();
-				observer->OnSendFrame(stream_info, media_packet);
+
+				if ((frame_ring == nullptr) || (observer->OnFramePushed(stream_info, frame_ring) == false))
+				{
+					observer->OnSendFrame(stream_info, media_packet);
+				}
 			}
 		}
 
@@ -41,6 +41,17 @@ MediaRouteStream::MediaRouteStream(const std::shared_ptr<info::Stream> &stream,
 {
 	SetType(type);
 
+	// Only publishers read the frames of outbound streams from the ring
+	auto server_config = cfg::ConfigManager::GetInstance()->GetServer();
+	if ((type == cmn::MediaRouterStreamType::OUTBOUND) && (server_config != nullptr))
+	{
+		auto &frame_ring_config = server_config->GetModules().GetFrameRing();
+		if (frame_ring_config.IsEnabled())
+		{
+			_frame_ring = std::make_shared<MediaFrameRing>(std::max(frame_ring_config.GetCapacity(), 1));
+		}
+	}
+
 	MediaRouterStats::Init(stream);
 	MediaRouterAlert::Init(stream);
 }
@@ -49,6 +60,11 @@ MediaRouteStream::~MediaRouteStream()
 {
 	_media_packet_stash.clear();
 	_packets_queue.Clear();
+
+	if (_frame_ring != nullptr)
+	{
+		_frame_ring->Clear();
+	}
 }
 
 std::shared_ptr<info::Stream> MediaRouteStream::GetStream()
@@ -16,6 +16,7 @@
 
 #include "base/info/stream.h"
 #include "base/mediarouter/media_buffer.h"
+#include "base/mediarouter/media_frame_ring.h"
 #include "base/mediarouter/media_type.h"
 #include "mediarouter_nomalize.h"
 #include "mediarouter_stats.h"
@@ -63,6 +64,12 @@ public:
 	};
 	std::vector<std::shared_ptr<MirrorBufferItem>> GetMirrorBuffer();
 
+	// Frames delivered to publishers (Outbound only), nullptr if <Modules><FrameRing> is disabled
+	const std::shared_ptr<MediaFrameRing> &GetFrameRing() const
+	{
+		return _frame_ring;
+	}
+
 	// Query original stream information
 	std::shared_ptr<info::Stream> GetStream();
 
@@ -92,4 +99,7 @@ private:
 
 	// Mirror buffer
 	std::vector<std::shared_ptr<MirrorBufferItem>> _mirror_buffer;
+
+	// Frames shared by all publishers
+	std::shared_ptr<MediaFrameRing> _frame_ring;
 };
@@ -3,6 +3,8 @@
 #include <modules/bitstream/h264/h264_parser.h>
 #include <modules/bitstream/nalu/nal_unit_fragment_header.h>
 
+#include "nal_unit_scanner.h"
+
 #define OV_LOG_TAG "NalUnitInsertor"
 
 const uint8_t START_CODE_3B[3] = {0x00, 0x00, 0x01};
@@ -137,8 +139,19 @@ std::shared_ptr<ov::Data> NalUnitInsertor::EmulationPreventionBytes(const std::s
 		return nullptr;
 	}
 
+	auto candidate = NalUnitScanner::FindEmulationPreventionCandidate(nal->GetDataAs<uint8_t>(), nal->GetLength());
+	if (candidate == -1)
+	{
+		// Nothing to escape
+		return nal->Clone();
+	}
+
 	ov::ByteStream stream(nal);
 	ov::ByteStream new_nal(nal->GetLength() + (nal->GetLength() / 2));
+
+	// The byte before the first candidate is never 0x00, so the bytes up to the candidate can be copied as they are
+	new_nal.Write(nal->GetData(), candidate);
+	stream.Skip(candidate);
 	
 	int8_t zeroCount  = 0;
 
@@ -0,0 +1,227 @@
+#include "nal_unit_scanner.h"
+
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#	define NAL_UNIT_SCANNER_X86 1
+#	include <immintrin.h>
+#endif
+
+namespace
+{
+	// Returns the offset of the first (00 00 x) where min_third <= x <= max_third, or length if not found
+	using FindZeroZeroFunction = size_t (*)(const uint8_t *data, size_t length, uint8_t min_third, uint8_t max_third);
+
+	inline bool IsMatched(const uint8_t *data, size_t offset, uint8_t min_third, uint8_t max_third)
+	{
+		return (data[offset] == 0x00) && (data[offset + 1] == 0x00) &&
+			   (data[offset + 2] >= min_third) && (data[offset + 2] <= max_third);
+	}
+
+	size_t FindZeroZeroScalar(const uint8_t *data, size_t length, uint8_t min_third, uint8_t max_third)
+	{
+		size_t offset = 0;
+
+		while (offset + 3 <= length)
+		{
+			// If the 3rd byte is out of range and not zero, no match can start at offset, offset + 1 and offset + 2
+			auto third = data[offset + 2];
+			if ((third > max_third) && (third != 0x00))
+			{
+				offset += 3;
+				continue;
+			}
+
+			if (IsMatched(data, offset, min_third, max_third))
+			{
+				return offset;
+			}
+
+			offset++;
+		}
+
+		return length;
+	}
+
+#if NAL_UNIT_SCANNER_X86
+	// Checks every candidate of the mask (bit n means data[offset + n] == 0 && data[offset + n + 1] == 0)
+	inline bool CheckCandidates(const uint8_t *data, size_t offset, uint32_t mask, uint8_t min_third, uint8_t max_third, size_t &found)
+	{
+		while (mask != 0)
+		{
+			auto position = offset + __builtin_ctz(mask);
+			auto third = data[position + 2];
+
+			if ((third >= min_third) && (third <= max_third))
+			{
+				found = position;
+				return true;
+			}
+
+			mask &= (mask - 1);
+		}
+
+		return false;
+	}
+
+	__attribute__((target("sse2"))) size_t FindZeroZeroSse2(const uint8_t *data, size_t length, uint8_t min_third, uint8_t max_third)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		size_t offset = 0;
+		size_t found;
+
+		// 16 candidates + 2 bytes of lookahead
+		while (offset + 16 + 2 <= length)
+		{
+			auto current = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset));
+			auto next = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset + 1));
+			auto both_zero = _mm_and_si128(_mm_cmpeq_epi8(current, zero), _mm_cmpeq_epi8(next, zero));
+			auto mask = static_cast<uint32_t>(_mm_movemask_epi8(both_zero));
+
+			if ((mask != 0) && CheckCandidates(data, offset, mask, min_third, max_third, found))
+			{
+				return found;
+			}
+
+			offset += 16;
+		}
+
+		return offset + FindZeroZeroScalar(data + offset, length - offset, min_third, max_third);
+	}
+
+	__attribute__((target("avx2"))) size_t FindZeroZeroAvx2(const uint8_t *data, size_t length, uint8_t min_third, uint8_t max_third)
+	{
+		const __m256i zero = _mm256_setzero_si256();
+		size_t offset = 0;
+		size_t found;
+
+		// 32 candidates + 2 bytes of lookahead
+		while (offset + 32 + 2 <= length)
+		{
+			auto current = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset));
+			auto next = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset + 1));
+			auto both_zero = _mm256_and_si256(_mm256_cmpeq_epi8(current, zero), _mm256_cmpeq_epi8(next, zero));
+			auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(both_zero));
+
+			if ((mask != 0) && CheckCandidates(data, offset, mask, min_third, max_third, found))
+			{
+				return found;
+			}
+
+			offset += 32;
+		}
+
+		return offset + FindZeroZeroSse2(data + offset, length - offset, min_third, max_third);
+	}
+#endif	// NAL_UNIT_SCANNER_X86
+
+	struct Implementation
+	{
+		FindZeroZeroFunction function;
+		const char *name;
+		// Whether the CPU supports the implementation
+		bool (*is_supported)();
+	};
+
+	const Implementation IMPLEMENTATIONS[] = {
+#if NAL_UNIT_SCANNER_X86
+		{FindZeroZeroAvx2, "avx2", []() -> bool { __builtin_cpu_init(); return __builtin_cpu_supports("avx2"); }},
+		{FindZeroZeroSse2, "sse2", []() -> bool { __builtin_cpu_init(); return __builtin_cpu_supports("sse2"); }},
+#endif	// NAL_UNIT_SCANNER_X86
+		{FindZeroZeroScalar, "scalar", []() -> bool { return true; }},
+	};
+
+	// The fastest implementation supported by the CPU (the scalar one is the last)
+	const Implementation *SelectImplementation()
+	{
+		for (const auto &implementation : IMPLEMENTATIONS)
+		{
+			if (implementation.is_supported())
+			{
+				return &implementation;
+			}
+		}
+
+		return nullptr;
+	}
+
+	std::atomic<const Implementation *> &GetImplementationHolder()
+	{
+		static std::atomic<const Implementation *> implementation{SelectImplementation()};
+		return implementation;
+	}
+
+	const Implementation &GetImplementation()
+	{
+		return *GetImplementationHolder().load(std::memory_order_relaxed);
+	}
+}  // namespace
+
+int NalUnitScanner::FindAnnexBStartCode(const uint8_t *bitstream, size_t length, size_t &start_code_size)
+{
+	start_code_size = 0;
+
+	if ((bitstream == nullptr) || (length < 3))
+	{
+		return -1;
+	}
+
+	auto offset = GetImplementation().function(bitstream, length, 0x01, 0x01);
+
+	if (offset >= length)
+	{
+		return -1;
+	}
+
+	// 00 00 00 01
+	if ((offset > 0) && (bitstream[offset - 1] == 0x00))
+	{
+		start_code_size = 4;
+		return static_cast<int>(offset - 1);
+	}
+
+	start_code_size = 3;
+	return static_cast<int>(offset);
+}
+
+int NalUnitScanner::FindEmulationPreventionCandidate(const uint8_t *bitstream, size_t length)
+{
+	if ((bitstream == nullptr) || (length < 3))
+	{
+		return -1;
+	}
+
+	auto offset = GetImplementation().function(bitstream, length, 0x00, 0x03);
+
+	return (offset < length) ? static_cast<int>(offset) : -1;
+}
+
+const char *NalUnitScanner::GetImplementationName()
+{
+	return GetImplementation().name;
+}
+
+bool NalUnitScanner::SetImplementation(const char *name)
+{
+	if (name == nullptr)
+	{
+		return false;
+	}
+
+	for (const auto &implementation : IMPLEMENTATIONS)
+	{
+		if ((::strcmp(implementation.name, name) == 0) && implementation.is_supported())
+		{
+			GetImplementationHolder().store(&implementation, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void NalUnitScanner::ResetImplementation()
+{
+	GetImplementationHolder().store(SelectImplementation(), std::memory_order_relaxed);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Scans Annex-B bitstreams for start codes (00 00 01 / 00 00 00 01) and emulation prevention candidates (00 00 0x, x <= 3).
+//
+// The "00 00" search runs 16 (SSE2) or 32 (AVX2) bytes at a time, the implementation is chosen at runtime.
+// A scalar implementation is used on other architectures.
+class NalUnitScanner
+{
+public:
+	// Returns the offset of the first start code, or -1 if not found.
+	// start_code_size is set to 4 if the start code is 00 00 00 01, or 3 if it is 00 00 01.
+	static int FindAnnexBStartCode(const uint8_t *bitstream, size_t length, size_t &start_code_size);
+
+	// Returns the offset of the first 00 00 0x (x <= 3) sequence, or -1 if not found.
+	// A NAL unit without this sequence needs no emulation prevention bytes.
+	static int FindEmulationPreventionCandidate(const uint8_t *bitstream, size_t length);
+
+	// "avx2", "sse2" or "scalar"
+	static const char *GetImplementationName();
+
+	// Forces an implementation by name, so the implementations can be compared (e.g. by the benchmarks).
+	// Returns false if the implementation is unknown or not supported by the CPU.
+	static bool SetImplementation(const char *name);
+	// Restores the implementation chosen at runtime
+	static void ResetImplementation();
+};
@@ -0,0 +1,1043 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#include "fmp4_dvr_log.h"
+
+#include <base/ovlibrary/files.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <filesystem>
+
+#include "fmp4_private.h"
+
+#define DVR_SEGMENT_LOG_MAGIC 0x5244564F  // "OVDR"
+#define DVR_SEGMENT_LOG_VERSION 3
+// Number of records allocated at once when the index grows
+#define DVR_SEGMENT_LOG_INDEX_GROWTH 1024
+
+namespace bmff
+{
+	struct DvrSegmentLog::IndexHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		// Number of records the index file can hold
+		uint64_t capacity;
+		// Live records are [head, tail)
+		uint64_t head;
+		uint64_t tail;
+		// Where the next segment is appended in the log
+		uint64_t log_size;
+		uint64_t initialization_hash;
+		// The log file is segments.<log_generation>.log
+		uint64_t log_generation;
+		// Set by Close(), and cleared by Open()
+		int64_t closed_time_ms;
+	};
+
+	struct DvrSegmentLog::IndexRecord
+	{
+		uint32_t segment_number;
+		uint32_t independent;
+		uint64_t offset;
+		uint64_t length;
+		int64_t start_time_ms;
+		double duration_ms;
+	};
+
+	namespace
+	{
+		std::mutex g_open_directories_mutex;
+		// Directory : Number of DvrSegmentLogs that opened it
+		std::map<ov::String, int> g_open_directories;
+	}  // namespace
+
+	// The space of an evicted segment is released (a hole is punched in the log) when no one is reading it,
+	// otherwise the readers would get zeros instead of the segment. The readers hold this object,
+	// so a segment can still be released after the log is closed.
+	//
+	// There is one instance per log file in the process, so the readers of a DvrSegmentLog that has been closed
+	// (e.g. by the previous stream of the same name) are also taken into account when the log is reopened.
+	class DvrSegmentLog::ReadRegions
+	{
+	public:
+		ReadRegions(int fd, const ov::String &log_path)
+			: _fd(fd), _log_path(log_path)
+		{
+		}
+
+		// Returns the instance of the log file, log_fd is duplicated if a new instance is created
+		static std::shared_ptr<ReadRegions> Get(int log_fd, const ov::String &log_path)
+		{
+			static std::mutex registry_mutex;
+			static std::map<ov::String, std::weak_ptr<ReadRegions>> registry;
+
+			std::lock_guard<std::mutex> lock(registry_mutex);
+
+			for (auto item = registry.begin(); item != registry.end();)
+			{
+				item = item->second.expired() ? registry.erase(item) : std::next(item);
+			}
+
+			auto item = registry.find(log_path);
+			if (item != registry.end())
+			{
+				auto read_regions = item->second.lock();
+				if (read_regions != nullptr)
+				{
+					return read_regions;
+				}
+			}
+
+			// The readers have their own descriptor, so the space can be released after the log is closed
+			int fd = ::dup(log_fd);
+			if (fd < 0)
+			{
+				logte("Could not duplicate the descriptor of %s (%s)", log_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+				return nullptr;
+			}
+
+			auto read_regions = std::make_shared<ReadRegions>(fd, log_path);
+			registry[log_path] = read_regions;
+
+			return read_regions;
+		}
+
+		~ReadRegions()
+		{
+			if (_fd >= 0)
+			{
+				::close(_fd);
+			}
+		}
+
+		// Called when a reader starts reading the range, the caller must hold the lock of the log
+		// so that the segment is not evicted in the meantime
+		void Acquire(uint64_t offset, uint64_t length)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			auto &region = _regions[offset];
+			region.length = length;
+			region.readers++;
+		}
+
+		// Called when the reader is gone
+		void Release(uint64_t offset)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			auto item = _regions.find(offset);
+			if (item == _regions.end())
+			{
+				return;
+			}
+
+			auto &region = item->second;
+
+			region.readers--;
+			if (region.readers > 0)
+			{
+				return;
+			}
+
+			if (region.evicted)
+			{
+				PunchHole(offset, region.length);
+			}
+
+			_regions.erase(item);
+		}
+
+		// Releases the space of the range now, or when the last reader is gone
+		void Evict(uint64_t offset, uint64_t length)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			auto item = _regions.find(offset);
+			if (item != _regions.end())
+			{
+				item->second.evicted = true;
+				return;
+			}
+
+			PunchHole(offset, length);
+		}
+
+	private:
+		struct Region
+		{
+			uint64_t length = 0;
+			uint32_t readers = 0;
+			bool evicted = false;
+		};
+
+		void PunchHole(uint64_t offset, uint64_t length)
+		{
+#if IS_LINUX
+			// The size of the log (and the offsets of the other segments) do not change
+			if (_punch_hole_supported &&
+				(::fallocate(_fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, static_cast<off_t>(offset), static_cast<off_t>(length)) != 0))
+			{
+				logtw("Could not release the space of DVR segments, the log file keeps growing: %s (%s)", _log_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+				_punch_hole_supported = false;
+			}
+#endif	// IS_LINUX
+		}
+
+		int _fd = -1;
+		ov::String _log_path;
+		bool _punch_hole_supported = true;
+
+		std::mutex _mutex;
+		// Offset : Region
+		std::map<uint64_t, Region> _regions;
+	};
+
+	size_t DvrSegmentLog::GetIndexFileSize(uint64_t capacity)
+	{
+		return sizeof(IndexHeader) + (capacity * sizeof(IndexRecord));
+	}
+
+	DvrSegmentLog::DvrSegmentLog(const ov::String &directory)
+		: _directory(directory)
+	{
+		_index_path = ov::String::FormatString("%s/segments.idx", directory.CStr());
+	}
+
+	DvrSegmentLog::~DvrSegmentLog()
+	{
+		Close();
+	}
+
+	bool DvrSegmentLog::Open()
+	{
+		std::lock_guard<std::shared_mutex> lock(_mutex);
+
+		if (_index_fd >= 0)
+		{
+			return true;
+		}
+
+		if (ov::IsDirExist(_directory) == false)
+		{
+			logti("Try to create directory for LLHLS DVR: %s", _directory.CStr());
+			if (ov::CreateDirectories(_directory) == false)
+			{
+				logte("Could not create directory for DVR: %s", _directory.CStr());
+				return false;
+			}
+		}
+
+		_index_fd = ::open(_index_path.CStr(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+		if (_index_fd < 0)
+		{
+			logte("Could not open DVR segment index: %s (%s)", _index_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		{
+			std::lock_guard<std::mutex> open_directories_lock(g_open_directories_mutex);
+			g_open_directories[_directory]++;
+		}
+
+		struct stat index_stat;
+		if (::fstat(_index_fd, &index_stat) != 0)
+		{
+			CloseInternal();
+			return false;
+		}
+
+		bool is_new = (static_cast<size_t>(index_stat.st_size) < sizeof(IndexHeader));
+		uint64_t capacity = DVR_SEGMENT_LOG_INDEX_GROWTH;
+
+		if (is_new == false)
+		{
+			// Map the header first to find out the capacity
+			if (MapIndex(0) == false)
+			{
+				CloseInternal();
+				return false;
+			}
+
+			auto header = GetHeader();
+
+			if ((header->magic != DVR_SEGMENT_LOG_MAGIC) || (header->version != DVR_SEGMENT_LOG_VERSION) ||
+				(GetIndexFileSize(header->capacity) > static_cast<size_t>(index_stat.st_size)))
+			{
+				logtw("DVR segment index is broken or incompatible, the log will be reset: %s", _index_path.CStr());
+				is_new = true;
+			}
+			else
+			{
+				capacity = header->capacity;
+			}
+
+			UnmapIndex();
+		}
+
+		if (is_new)
+		{
+			// Only the index is truncated, the log may still be mapped by the readers
+			if ((::ftruncate(_index_fd, 0) != 0) || (::ftruncate(_index_fd, GetIndexFileSize(capacity)) != 0))
+			{
+				logte("Could not initialize DVR segment log: %s (%s)", _directory.CStr(), ov::Error::CreateErrorFromErrno()->What());
+				CloseInternal();
+				return false;
+			}
+		}
+
+		if (MapIndex(capacity) == false)
+		{
+			CloseInternal();
+			return false;
+		}
+
+		auto header = GetHeader();
+
+		if (is_new)
+		{
+			header->magic = DVR_SEGMENT_LOG_MAGIC;
+			header->version = DVR_SEGMENT_LOG_VERSION;
+			header->capacity = capacity;
+			header->head = 0;
+			header->tail = 0;
+			header->log_size = 0;
+			header->initialization_hash = 0;
+			header->log_generation = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+			header->closed_time_ms = 0;
+		}
+
+		_previous_closed_time_ms = header->closed_time_ms;
+		header->closed_time_ms = 0;
+
+		if (OpenLog() == false)
+		{
+			CloseInternal();
+			return false;
+		}
+
+		// Logs left by the previous versions or generations
+		RemoveOtherGenerations();
+
+		return Validate();
+	}
+
+	ov::String DvrSegmentLog::GetLogPath(uint64_t generation) const
+	{
+		return ov::String::FormatString("%s/segments.%" PRIu64 ".log", _directory.CStr(), generation);
+	}
+
+	bool DvrSegmentLog::OpenLog()
+	{
+		_log_path = GetLogPath(GetHeader()->log_generation);
+		_log_fd = ::open(_log_path.CStr(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+		if (_log_fd < 0)
+		{
+			logte("Could not open DVR segment log: %s (%s)", _log_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		_read_regions = ReadRegions::Get(_log_fd, _log_path);
+		if (_read_regions == nullptr)
+		{
+			CloseLog();
+			return false;
+		}
+
+		return true;
+	}
+
+	void DvrSegmentLog::CloseLog()
+	{
+		// The readers keep it until they are gone
+		_read_regions.reset();
+
+		if (_log_fd >= 0)
+		{
+			::close(_log_fd);
+			_log_fd = -1;
+		}
+	}
+
+	bool DvrSegmentLog::StartNewGeneration()
+	{
+		auto header = GetHeader();
+		auto old_log_path = _log_path;
+
+		CloseLog();
+
+		auto generation = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+		header->log_generation = std::max(generation, header->log_generation + 1);
+		header->log_size = 0;
+
+		if (OpenLog() == false)
+		{
+			return false;
+		}
+
+		// The segments that are being read stay in the file until the readers are gone
+		if ((::unlink(old_log_path.CStr()) != 0) && (errno != ENOENT))
+		{
+			logtw("Could not remove DVR segment log: %s (%s)", old_log_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+		}
+
+		return true;
+	}
+
+	void DvrSegmentLog::RemoveOtherGenerations()
+	{
+		auto [result, file_list] = ov::GetFileList(_directory);
+		if (result == false)
+		{
+			return;
+		}
+
+		for (const auto &file_path : file_list)
+		{
+			auto file_name = ov::GetFileName(file_path);
+
+			if (file_name.HasPrefix("segments.") && file_name.HasSuffix(".log") && (file_path != _log_path))
+			{
+				logti("Remove the DVR segment log of another generation: %s", file_path.CStr());
+				::unlink(file_path.CStr());
+			}
+		}
+	}
+
+	int64_t DvrSegmentLog::GetWallclockMs()
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	}
+
+	int64_t DvrSegmentLog::GetPreviousClosedTimeMs() const
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+		return _previous_closed_time_ms;
+	}
+
+	void DvrSegmentLog::RemoveIdleLogs(const ov::String &root_directory, int64_t max_idle_ms)
+	{
+		std::vector<ov::String> idle_directories;
+		auto now_ms = GetWallclockMs();
+
+		std::error_code error_code;
+		for (auto it = std::filesystem::recursive_directory_iterator(root_directory.CStr(), error_code);
+			 (error_code.value() == 0) && (it != std::filesystem::recursive_directory_iterator());
+			 it.increment(error_code))
+		{
+			if (it->path().filename() != "segments.idx")
+			{
+				continue;
+			}
+
+			ov::String directory = it->path().parent_path().c_str();
+
+			{
+				std::lock_guard<std::mutex> lock(g_open_directories_mutex);
+				if (g_open_directories.find(directory) != g_open_directories.end())
+				{
+					continue;
+				}
+			}
+
+			// The index is touched whenever the log is closed
+			struct stat index_stat;
+			if ((::stat(it->path().c_str(), &index_stat) == 0) &&
+				((now_ms - (static_cast<int64_t>(index_stat.st_mtime) * 1000)) > max_idle_ms))
+			{
+				idle_directories.push_back(directory);
+			}
+		}
+
+		for (const auto &directory : idle_directories)
+		{
+			logti("Remove the idle DVR segment log: %s", directory.CStr());
+			ov::DeleteDirectories(directory);
+
+			// Remove the parent directories (of the stream) if they become empty
+			auto parent = std::filesystem::path(directory.CStr()).parent_path();
+			while ((parent.string().size() > root_directory.GetLength()) && (::rmdir(parent.c_str()) == 0))
+			{
+				parent = parent.parent_path();
+			}
+		}
+	}
+
+	bool DvrSegmentLog::Validate()
+	{
+		auto header = GetHeader();
+
+		struct stat log_stat;
+		if (::fstat(_log_fd, &log_stat) != 0)
+		{
+			return false;
+		}
+
+		auto log_size = static_cast<uint64_t>(log_stat.st_size);
+
+		if ((header->head > header->tail) || (header->tail > header->capacity))
+		{
+			header->head = 0;
+			header->tail = 0;
+		}
+
+		// Drop the records of segments that were not completely written
+		while (header->tail > header->head)
+		{
+			auto record = GetRecord(header->tail - 1);
+
+			if ((record->offset + record->length) <= log_size)
+			{
+				break;
+			}
+
+			logtw("Discard a torn DVR segment: %u (%s)", record->segment_number, _log_path.CStr());
+			header->tail--;
+		}
+
+		_total_duration_ms = 0;
+		_total_bytes = 0;
+		header->log_size = 0;
+
+		for (auto position = header->head; position < header->tail; position++)
+		{
+			auto record = GetRecord(position);
+
+			_total_duration_ms += record->duration_ms;
+			_total_bytes += record->length;
+			header->log_size = record->offset + record->length;
+		}
+
+		if (header->tail > header->head)
+		{
+			logti("DVR segment log has been recovered: %s (segments: %u ~ %u, %.1lf sec, %" PRIu64 " bytes)",
+				  _directory.CStr(), GetRecord(header->head)->segment_number, GetRecord(header->tail - 1)->segment_number,
+				  _total_duration_ms / 1000.0, _total_bytes);
+		}
+		else if (log_size > 0)
+		{
+			// No live segment. The log is not truncated or punched, since its segments may still be mapped by the readers
+			// of the log opened before (e.g. by the previous stream of the same name), which would cause SIGBUS or zeros.
+			header->head = 0;
+			header->tail = 0;
+
+			return StartNewGeneration();
+		}
+
+		return true;
+	}
+
+	void DvrSegmentLog::Close()
+	{
+		std::lock_guard<std::shared_mutex> lock(_mutex);
+		CloseInternal();
+	}
+
+	void DvrSegmentLog::CloseInternal()
+	{
+		if ((_index_map != nullptr) && (_log_fd >= 0))
+		{
+			GetHeader()->closed_time_ms = GetWallclockMs();
+		}
+
+		UnmapIndex();
+		CloseLog();
+
+		if (_index_fd >= 0)
+		{
+			// RemoveIdleLogs() uses the modification time of the index
+			::futimens(_index_fd, nullptr);
+			::close(_index_fd);
+			_index_fd = -1;
+
+			std::lock_guard<std::mutex> lock(g_open_directories_mutex);
+			auto item = g_open_directories.find(_directory);
+			if ((item != g_open_directories.end()) && (--item->second <= 0))
+			{
+				g_open_directories.erase(item);
+			}
+		}
+	}
+
+	bool DvrSegmentLog::Reset()
+	{
+		std::lock_guard<std::shared_mutex> lock(_mutex);
+
+		if (_index_map == nullptr)
+		{
+			return false;
+		}
+
+		auto header = GetHeader();
+
+		if (header->tail > header->head)
+		{
+			auto first_record = GetRecord(header->head);
+			auto last_record = GetRecord(header->tail - 1);
+
+			logti("DVR segment log has been reset: %s (segments: %u ~ %u)", _directory.CStr(), first_record->segment_number, last_record->segment_number);
+		}
+
+		header->head = 0;
+		header->tail = 0;
+
+		_total_duration_ms = 0;
+		_total_bytes = 0;
+
+		// Segments that are being read are still mapped, so the log is not truncated (it could cause SIGBUS).
+		// The next segments are appended to a new log, and the old one is released when it is not being read.
+		if (header->log_size > 0)
+		{
+			return StartNewGeneration();
+		}
+
+		return true;
+	}
+
+	bool DvrSegmentLog::MapIndex(uint64_t capacity)
+	{
+		auto size = GetIndexFileSize(capacity);
+		auto map = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, _index_fd, 0);
+
+		if (map == MAP_FAILED)
+		{
+			logte("Could not map DVR segment index: %s (%s)", _index_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		_index_map = map;
+		_index_map_size = size;
+
+		return true;
+	}
+
+	void DvrSegmentLog::UnmapIndex()
+	{
+		if (_index_map != nullptr)
+		{
+			::munmap(_index_map, _index_map_size);
+
+			_index_map = nullptr;
+			_index_map_size = 0;
+		}
+	}
+
+	DvrSegmentLog::IndexHeader *DvrSegmentLog::GetHeader() const
+	{
+		return static_cast<IndexHeader *>(_index_map);
+	}
+
+	DvrSegmentLog::IndexRecord *DvrSegmentLog::GetRecord(uint64_t position) const
+	{
+		return reinterpret_cast<IndexRecord *>(static_cast<uint8_t *>(_index_map) + sizeof(IndexHeader)) + position;
+	}
+
+	bool DvrSegmentLog::ReserveRecord()
+	{
+		auto header = GetHeader();
+
+		if (header->tail < header->capacity)
+		{
+			return true;
+		}
+
+		if (header->head > 0)
+		{
+			// Move the live records to the front
+			auto count = header->tail - header->head;
+			::memmove(GetRecord(0), GetRecord(header->head), count * sizeof(IndexRecord));
+
+			header->head = 0;
+			header->tail = count;
+
+			return true;
+		}
+
+		// Grow the index
+		auto capacity = header->capacity + DVR_SEGMENT_LOG_INDEX_GROWTH;
+
+		if (::ftruncate(_index_fd, GetIndexFileSize(capacity)) != 0)
+		{
+			logte("Could not grow DVR segment index: %s (%s)", _index_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		UnmapIndex();
+
+		if (MapIndex(capacity) == false)
+		{
+			return false;
+		}
+
+		GetHeader()->capacity = capacity;
+
+		return true;
+	}
+
+	bool DvrSegmentLog::Append(uint32_t segment_number, int64_t start_time_ms, double duration_ms, bool independent, const std::shared_ptr<const ov::Data> &data)
+	{
+		if ((data == nullptr) || data->IsEmpty())
+		{
+			return false;
+		}
+
+		std::lock_guard<std::shared_mutex> lock(_mutex);
+
+		if (_index_map == nullptr)
+		{
+			return false;
+		}
+
+		auto header = GetHeader();
+
+		if ((header->tail > header->head) && (GetRecord(header->tail - 1)->segment_number >= segment_number))
+		{
+			logte("DVR segment number must increase: %u -> %u", GetRecord(header->tail - 1)->segment_number, segment_number);
+			return false;
+		}
+
+		// Write the segment first, then the record, so a crash leaves at most a torn record that Validate() drops
+		auto offset = header->log_size;
+		auto buffer = data->GetDataAs<uint8_t>();
+		size_t remained = data->GetLength();
+
+		while (remained > 0)
+		{
+			auto written = ::pwrite(_log_fd, buffer, remained, offset + (data->GetLength() - remained));
+
+			if (written < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				logte("Could not write DVR segment %u to %s (%s)", segment_number, _log_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+				return false;
+			}
+
+			buffer += written;
+			remained -= written;
+		}
+
+		if (ReserveRecord() == false)
+		{
+			return false;
+		}
+
+		header = GetHeader();
+
+		auto record = GetRecord(header->tail);
+		record->segment_number = segment_number;
+		record->independent = independent ? 1 : 0;
+		record->offset = offset;
+		record->length = data->GetLength();
+		record->start_time_ms = start_time_ms;
+		record->duration_ms = duration_ms;
+
+		header->log_size = offset + data->GetLength();
+		header->tail++;
+
+		_total_duration_ms += duration_ms;
+		_total_bytes += data->GetLength();
+
+		return true;
+	}
+
+	DvrSegmentLog::SegmentInfo DvrSegmentLog::PopOldestSegment()
+	{
+		std::lock_guard<std::shared_mutex> lock(_mutex);
+
+		if (_index_map == nullptr)
+		{
+			return {};
+		}
+
+		auto header = GetHeader();
+
+		if (header->head >= header->tail)
+		{
+			return {};
+		}
+
+		auto segment_info = ToSegmentInfo(GetRecord(header->head));
+		header->head++;
+
+		_total_duration_ms -= segment_info.duration_ms;
+		_total_bytes -= segment_info.length;
+
+		// Release the disk space, after the segment is sent if it is being sent
+		_read_regions->Evict(segment_info.offset, segment_info.length);
+
+		return segment_info;
+	}
+
+	uint64_t DvrSegmentLog::GetInitializationHash() const
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+
+		if (_index_map == nullptr)
+		{
+			return 0;
+		}
+
+		return GetHeader()->initialization_hash;
+	}
+
+	void DvrSegmentLog::SetInitializationHash(uint64_t hash)
+	{
+		std::lock_guard<std::shared_mutex> lock(_mutex);
+
+		if (_index_map != nullptr)
+		{
+			GetHeader()->initialization_hash = hash;
+		}
+	}
+
+	int64_t DvrSegmentLog::FindRecord(uint32_t segment_number) const
+	{
+		auto header = GetHeader();
+
+		if (header->head >= header->tail)
+		{
+			return -1;
+		}
+
+		// Segment numbers are usually continuous
+		auto first_number = GetRecord(header->head)->segment_number;
+		if (segment_number < first_number)
+		{
+			return -1;
+		}
+
+		auto position = header->head + (segment_number - first_number);
+		if ((position < header->tail) && (GetRecord(position)->segment_number == segment_number))
+		{
+			return position;
+		}
+
+		auto begin = GetRecord(header->head);
+		auto end = GetRecord(header->tail);
+		auto it = std::lower_bound(begin, end, segment_number, [](const IndexRecord &record, uint32_t number) {
+			return record.segment_number < number;
+		});
+
+		if ((it != end) && (it->segment_number == segment_number))
+		{
+			return header->head + (it - begin);
+		}
+
+		return -1;
+	}
+
+	DvrSegmentLog::SegmentInfo DvrSegmentLog::ToSegmentInfo(const IndexRecord *record)
+	{
+		SegmentInfo segment_info;
+
+		segment_info.segment_number = record->segment_number;
+		segment_info.offset = record->offset;
+		segment_info.length = record->length;
+		segment_info.start_time_ms = record->start_time_ms;
+		segment_info.duration_ms = record->duration_ms;
+		segment_info.independent = (record->independent != 0);
+
+		return segment_info;
+	}
+
+	DvrSegmentLog::SegmentInfo DvrSegmentLog::GetSegmentInfo(uint32_t segment_number) const
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+
+		if (_index_map == nullptr)
+		{
+			return {};
+		}
+
+		auto position = FindRecord(segment_number);
+		if (position < 0)
+		{
+			return {};
+		}
+
+		return ToSegmentInfo(GetRecord(position));
+	}
+
+	std::vector<DvrSegmentLog::SegmentInfo> DvrSegmentLog::GetSegments() const
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+
+		std::vector<SegmentInfo> segments;
+
+		if (_index_map == nullptr)
+		{
+			return segments;
+		}
+
+		auto header = GetHeader();
+
+		for (auto position = header->head; position < header->tail; position++)
+		{
+			segments.push_back(ToSegmentInfo(GetRecord(position)));
+		}
+
+		return segments;
+	}
+
+	std::shared_ptr<ov::Data> DvrSegmentLog::Read(uint32_t segment_number, SegmentInfo *segment_info) const
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+
+		if (_index_map == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto position = FindRecord(segment_number);
+		if (position < 0)
+		{
+			return nullptr;
+		}
+
+		auto info = ToSegmentInfo(GetRecord(position));
+
+		// mmap() requires the offset to be aligned to the page size
+		static const uint64_t page_size = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+		auto aligned_offset = info.offset - (info.offset % page_size);
+		auto delta = info.offset - aligned_offset;
+		auto map_size = static_cast<size_t>(delta + info.length);
+
+		auto map = ::mmap(nullptr, map_size, PROT_READ, MAP_SHARED, _log_fd, static_cast<off_t>(aligned_offset));
+		if (map == MAP_FAILED)
+		{
+			logte("Could not map DVR segment %u from %s (%s)", segment_number, _log_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return nullptr;
+		}
+
+		// The segment cannot be evicted while the lock is held
+		auto read_regions = _read_regions;
+		read_regions->Acquire(info.offset, info.length);
+
+		lock.unlock();
+
+		// The mapping is released when the last reference to the data (or its subdata) is gone
+		std::shared_ptr<const void> owner(map, [map_size, read_regions, offset = info.offset](const void *address) {
+			::munmap(const_cast<void *>(address), map_size);
+			read_regions->Release(offset);
+		});
+
+		if (segment_info != nullptr)
+		{
+			*segment_info = info;
+		}
+
+		return std::make_shared<ov::Data>(static_cast<const uint8_t *>(map) + delta, info.length, owner);
+	}
+
+	std::shared_ptr<ov::FileRegion> DvrSegmentLog::GetFileRegion(uint32_t segment_number) const
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+
+		if (_index_map == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto position = FindRecord(segment_number);
+		if (position < 0)
+		{
+			return nullptr;
+		}
+
+		auto info = ToSegmentInfo(GetRecord(position));
+		// The index may be remapped or unmapped once the lock is released
+		auto log_generation = GetHeader()->log_generation;
+
+		// The region has its own descriptor, so it can be sent even after the log is closed
+		int fd = ::dup(_log_fd);
+		if (fd < 0)
+		{
+			logte("Could not duplicate the descriptor of %s (%s)", _log_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return nullptr;
+		}
+
+		// The segment cannot be evicted while the lock is held
+		auto read_regions = _read_regions;
+		read_regions->Acquire(info.offset, info.length);
+
+		lock.unlock();
+
+		auto fd_owner = std::shared_ptr<int>(new int(fd), [read_regions, offset = info.offset](int *fd) {
+			::close(*fd);
+			delete fd;
+			read_regions->Release(offset);
+		});
+
+		// Offsets in a generation of the log are never reused, so they identify the contents
+		auto identity = ov::String::FormatString("%x-%" PRIx64 "-%jx-%jx", segment_number, log_generation, static_cast<uintmax_t>(info.offset), static_cast<uintmax_t>(info.length));
+
+		return std::make_shared<ov::FileRegion>(fd, static_cast<off_t>(info.offset), static_cast<size_t>(info.length), fd_owner, identity);
+	}
+
+	uint32_t DvrSegmentLog::GetSegmentCount() const
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+
+		if (_index_map == nullptr)
+		{
+			return 0;
+		}
+
+		auto header = GetHeader();
+		return static_cast<uint32_t>(header->tail - header->head);
+	}
+
+	double DvrSegmentLog::GetTotalDurationMs() const
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+		return _total_duration_ms;
+	}
+
+	uint64_t DvrSegmentLog::GetTotalBytes() const
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+		return _total_bytes;
+	}
+
+	int64_t DvrSegmentLog::GetFirstSegmentNumber() const
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+
+		if ((_index_map == nullptr) || (GetHeader()->head >= GetHeader()->tail))
+		{
+			return -1;
+		}
+
+		return GetRecord(GetHeader()->head)->segment_number;
+	}
+
+	int64_t DvrSegmentLog::GetLastSegmentNumber() const
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+
+		if ((_index_map == nullptr) || (GetHeader()->head >= GetHeader()->tail))
+		{
+			return -1;
+		}
+
+		return GetRecord(GetHeader()->tail - 1)->segment_number;
+	}
+}  // namespace bmff
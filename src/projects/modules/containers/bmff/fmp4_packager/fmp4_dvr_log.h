@@ -0,0 +1,149 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <shared_mutex>
+
+namespace bmff
+{
+	// Append-only DVR segment log of a track
+	//
+	//  <directory>/segments.<generation>.log : media segments appended back to back
+	//  <directory>/segments.idx : memory-mapped index (segment number -> offset, length, start time, duration, independent)
+	//
+	// Offsets in the log never change. The bytes of evicted segments are released by punching holes in the log,
+	// so there is no compaction. Segments are read by mapping their range of the log, without copying to the heap.
+	// A range that is still being read (the data returned by Read() or the region returned by GetFileRegion())
+	// is released when the last reader is gone, even if the reader got it from another DvrSegmentLog of the same file.
+	//
+	// The log is never truncated while it may be mapped. When all segments are discarded, the segments are appended to
+	// a log of a new generation, and the previous log is unlinked (the readers keep reading it until they are gone).
+	// The index is validated against the log when it is opened, so the log can be reused after a restart.
+	class DvrSegmentLog
+	{
+	public:
+		struct SegmentInfo
+		{
+			uint32_t segment_number = 0;
+			uint64_t offset = 0;
+			uint64_t length = 0;
+			// Wall clock time of the first sample (milliseconds since epoch)
+			int64_t start_time_ms = 0;
+			double duration_ms = 0;
+			bool independent = false;
+
+			bool IsAvailable() const
+			{
+				return length != 0;
+			}
+		};
+
+		explicit DvrSegmentLog(const ov::String &directory);
+		~DvrSegmentLog();
+
+		// Creates the files, or reopens the existing ones.
+		// Records that point beyond the end of the log (torn writes) are discarded.
+		bool Open();
+		// Records the time the log is closed, see GetPreviousClosedTimeMs()
+		void Close();
+
+		// Wall clock time (milliseconds since epoch) the log was closed before Open(),
+		// 0 if it was not closed (e.g. the process was killed) or the log is new
+		int64_t GetPreviousClosedTimeMs() const;
+
+		// Removes the logs under <root_directory> that are not open and have not been used for <max_idle_ms>
+		static void RemoveIdleLogs(const ov::String &root_directory, int64_t max_idle_ms);
+
+		// Removes all segments
+		bool Reset();
+
+		bool Append(uint32_t segment_number, int64_t start_time_ms, double duration_ms, bool independent, const std::shared_ptr<const ov::Data> &data);
+
+		// Removes the oldest segment from the index, and releases its bytes in the log
+		SegmentInfo PopOldestSegment();
+
+		// Hash of the initialization segment the segments were packaged with.
+		// Segments recovered after a restart can be served only if the initialization segment is the same.
+		uint64_t GetInitializationHash() const;
+		void SetInitializationHash(uint64_t hash);
+
+		SegmentInfo GetSegmentInfo(uint32_t segment_number) const;
+		// Returns all segments in the order of the segment number
+		std::vector<SegmentInfo> GetSegments() const;
+		// Returns the data of the segment mapped from the log (zero-copy)
+		std::shared_ptr<ov::Data> Read(uint32_t segment_number, SegmentInfo *segment_info = nullptr) const;
+		// Returns the range of the segment in the log, which can be sent using sendfile()
+		std::shared_ptr<ov::FileRegion> GetFileRegion(uint32_t segment_number) const;
+
+		uint32_t GetSegmentCount() const;
+		double GetTotalDurationMs() const;
+		uint64_t GetTotalBytes() const;
+
+		// -1 if there is no segment
+		int64_t GetFirstSegmentNumber() const;
+		int64_t GetLastSegmentNumber() const;
+
+	private:
+		struct IndexHeader;
+		struct IndexRecord;
+		// Ranges of the log being read, shared with the readers
+		class ReadRegions;
+
+		static size_t GetIndexFileSize(uint64_t capacity);
+
+		IndexHeader *GetHeader() const;
+		IndexRecord *GetRecord(uint64_t position) const;
+
+		bool MapIndex(uint64_t capacity);
+		void UnmapIndex();
+
+		// Close() without the lock
+		void CloseInternal();
+
+		ov::String GetLogPath(uint64_t generation) const;
+		// Opens the log of the generation in the header
+		bool OpenLog();
+		void CloseLog();
+		// Appends the next segments to a new log and unlinks the current one, all segments must have been removed
+		bool StartNewGeneration();
+		// Unlinks the logs of the other generations
+		void RemoveOtherGenerations();
+		// Makes room for a record at the tail (compaction or growth)
+		bool ReserveRecord();
+
+		bool Validate();
+
+		// Returns the position of the record in the index, or -1 if not found
+		int64_t FindRecord(uint32_t segment_number) const;
+		static SegmentInfo ToSegmentInfo(const IndexRecord *record);
+
+		static int64_t GetWallclockMs();
+
+		ov::String _directory;
+		ov::String _log_path;
+		ov::String _index_path;
+
+		int _log_fd = -1;
+		int _index_fd = -1;
+
+		void *_index_map = nullptr;
+		size_t _index_map_size = 0;
+
+		// Sum of the live segments (updated with the index)
+		double _total_duration_ms = 0;
+		uint64_t _total_bytes = 0;
+
+		int64_t _previous_closed_time_ms = 0;
+
+		std::shared_ptr<ReadRegions> _read_regions;
+
+		mutable std::shared_mutex _mutex;
+	};
+}  // namespace bmff
@@ -320,30 +320,29 @@ namespace bmff
 					reserve_buffer_size = (_target_chunk_duration_ms / 1000.0) * ((0.5 * 1000.0 * 1000.0) / 8.0);
 				}
 
-				ov::ByteStream chunk_stream(reserve_buffer_size);
-				
-				auto data_samples = GetDataSamples(samples->GetStartTimestamp(), samples->GetEndTimestamp());
-				if (data_samples != nullptr)
+				std::shared_ptr<ov::Data> chunk;
+
+				if (_config.progressive_part)
 				{
-					if (WriteEmsgBox(chunk_stream, data_samples) == false)
+					// The fragments of the samples have already been written
+					chunk = std::move(_progressive_part_data);
+					if (chunk == nullptr)
 					{
-						logtw("FMP4Packager::AppendSample() - Failed to write emsg box");
+						logte("FMP4Packager::AppendSample() - No fragment of the part has been written");
+						return false;
 					}
 				}
-
-				if (WriteMoofBox(chunk_stream, samples) == false)
+				else
 				{
-					logte("FMP4Packager::AppendSample() - Failed to write moof box");
-					return false;
-				}
+					ov::ByteStream chunk_stream(reserve_buffer_size);
 
-				if (WriteMdatBox(chunk_stream, samples) == false)
-				{
-					logte("FMP4Packager::AppendSample() - Failed to write mdat box");
-					return false;
-				}
+					if (WriteFragment(chunk_stream, samples) == false)
+					{
+						return false;
+					}
 
-				auto chunk = chunk_stream.GetDataPointer();
+					chunk = chunk_stream.GetDataPointer();
+				}
 
 				auto markers = PopMarkers(samples->GetStartTimestamp(), samples->GetEndTimestamp());
 
@@ -426,6 +425,11 @@ namespace bmff
 			return false;
 		}
 
+		if (_config.progressive_part && (AppendProgressiveFragment() == false))
+		{
+			return false;
+		}
+
 		samples = _sample_buffer.GetSamples();
 		total_sample_duration = samples != nullptr ? samples->GetTotalDuration() : 0;
 		total_sample_duration_ms = (static_cast<double>(total_sample_duration) / GetMediaTrack()->GetTimeBase().GetTimescale()) * 1000.0;
@@ -457,30 +461,28 @@ namespace bmff
 
 		if (samples != nullptr && samples->GetTotalCount() > 0)
 		{
-			ov::ByteStream chunk_stream(4096);
+			std::shared_ptr<ov::Data> chunk;
 
-			auto data_samples = GetDataSamples(samples->GetStartTimestamp(), samples->GetEndTimestamp());
-			if (data_samples != nullptr)
+			if (_config.progressive_part)
 			{
-				if (WriteEmsgBox(chunk_stream, data_samples) == false)
+				chunk = std::move(_progressive_part_data);
+				if (chunk == nullptr)
 				{
-					logtw("FMP4Packager::Flush() - Failed to write emsg box");
+					logte("FMP4Packager::Flush() - No fragment of the part has been written");
+					return false;
 				}
 			}
-
-			if (WriteMoofBox(chunk_stream, samples) == false)
+			else
 			{
-				logte("FMP4Packager::Flush() - Failed to write moof box");
-				return false;
-			}
+				ov::ByteStream chunk_stream(4096);
 
-			if (WriteMdatBox(chunk_stream, samples) == false)
-			{
-				logte("FMP4Packager::Flush() - Failed to write mdat box");
-				return false;
-			}
+				if (WriteFragment(chunk_stream, samples) == false)
+				{
+					return false;
+				}
 
-			auto chunk = chunk_stream.GetDataPointer();
+				chunk = chunk_stream.GetDataPointer();
+			}
 
 			if (_storage != nullptr && _storage->AppendMediaChunk(chunk, 
 											samples->GetStartTimestamp(), 
@@ -497,6 +499,67 @@ namespace bmff
 		return true;
 	}
 
+	bool FMP4Packager::WriteFragment(ov::ByteStream &stream, const std::shared_ptr<Samples> &samples)
+	{
+		auto data_samples = GetDataSamples(samples->GetStartTimestamp(), samples->GetEndTimestamp());
+		if (data_samples != nullptr)
+		{
+			if (WriteEmsgBox(stream, data_samples) == false)
+			{
+				logtw("FMP4Packager::WriteFragment() - Failed to write emsg box");
+			}
+		}
+
+		if (WriteMoofBox(stream, samples) == false)
+		{
+			logte("FMP4Packager::WriteFragment() - Failed to write moof box");
+			return false;
+		}
+
+		if (WriteMdatBox(stream, samples) == false)
+		{
+			logte("FMP4Packager::WriteFragment() - Failed to write mdat box");
+			return false;
+		}
+
+		return true;
+	}
+
+	bool FMP4Packager::AppendProgressiveFragment()
+	{
+		auto samples = _sample_buffer.GetSamples();
+		if (samples == nullptr || samples->GetTotalCount() == 0)
+		{
+			return true;
+		}
+
+		// The last sample has been encrypted by the sample buffer if CENC is enabled
+		auto fragment_samples = std::make_shared<Samples>();
+		fragment_samples->AppendSample(samples->GetList().back());
+
+		ov::ByteStream fragment_stream(fragment_samples->GetTotalSize() + 1024);
+
+		if (WriteFragment(fragment_stream, fragment_samples) == false)
+		{
+			return false;
+		}
+
+		auto fragment = fragment_stream.GetDataPointer();
+
+		if (_progressive_part_data == nullptr)
+		{
+			_progressive_part_data = std::make_shared<ov::Data>();
+		}
+		_progressive_part_data->Append(fragment);
+
+		if (_storage != nullptr)
+		{
+			_storage->AppendMediaFragment(fragment);
+		}
+
+		return true;
+	}
+
 	// Get config
 	const FMP4Packager::Config &FMP4Packager::GetConfig() const
 	{
@@ -545,7 +608,7 @@ namespace bmff
 				return nullptr;
 			}
 
-			auto new_packet = std::make_shared<MediaPacket>(*media_packet);
+			auto new_packet = ov::MakePooledShared<MediaPacket>(*media_packet);
 			new_packet->SetData(converted_data);
 			new_packet->SetBitstreamFormat(cmn::BitstreamFormat::H264_AVCC);
 			new_packet->SetPacketType(cmn::PacketType::NALU);
@@ -561,7 +624,7 @@ namespace bmff
 				return nullptr;
 			}
 
-			auto new_packet = std::make_shared<MediaPacket>(*media_packet);
+			auto new_packet = ov::MakePooledShared<MediaPacket>(*media_packet);
 			new_packet->SetData(converted_data);
 			new_packet->SetBitstreamFormat(cmn::BitstreamFormat::HVCC);
 			new_packet->SetPacketType(cmn::PacketType::NALU);
@@ -577,7 +640,7 @@ namespace bmff
 				return nullptr;
 			}
 
-			auto new_packet = std::make_shared<MediaPacket>(*media_packet);
+			auto new_packet = ov::MakePooledShared<MediaPacket>(*media_packet);
 			new_packet->SetData(raw_data);
 			new_packet->SetBitstreamFormat(cmn::BitstreamFormat::AAC_RAW);
 			new_packet->SetPacketType(cmn::PacketType::RAW);
@@ -24,6 +24,11 @@ namespace bmff
 		{
 			double chunk_duration_ms = 500.0;
 			double segment_duration_ms = 6000.0;
+
+			// Writes a fragment (moof+mdat) for each sample and passes it to the storage immediately,
+			// so that the part being built can be sent before it is completed.
+			// The part consists of the fragments of its samples.
+			bool progressive_part = false;
 			
 			CencProperty cenc_property;
 		};
@@ -53,6 +58,11 @@ namespace bmff
 
 		std::shared_ptr<bmff::Samples> GetDataSamples(int64_t start_timestamp, int64_t end_timestamp);
 
+		// emsg (if any) + moof + mdat
+		bool WriteFragment(ov::ByteStream &stream, const std::shared_ptr<Samples> &samples);
+		// Config::progressive_part - writes the fragment of the last sample of the part being built
+		bool AppendProgressiveFragment();
+
 		bool StoreInitializationSection(const std::shared_ptr<ov::Data> &segment);
 
 		std::shared_ptr<const MediaPacket> ConvertBitstreamFormat(const std::shared_ptr<const MediaPacket> &media_packet);
@@ -66,6 +76,9 @@ namespace bmff
 
 		std::queue<std::shared_ptr<const MediaPacket>> _reserved_data_packets;
 
+		// Config::progressive_part - fragments of the part being built
+		std::shared_ptr<ov::Data> _progressive_part_data;
+
 		std::map<int64_t, Marker> _markers;
 		mutable std::shared_mutex _markers_guard;
 	};
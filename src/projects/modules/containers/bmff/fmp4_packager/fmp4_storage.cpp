@@ -8,6 +8,7 @@
 //==============================================================================
 
 #include <base/info/media_track.h>
+#include <base/ovcrypto/ovcrypto.h>
 #include <base/ovlibrary/files.h>
 
 #include <base/modules/data_format/cue_event/cue_event.h>
@@ -15,6 +16,12 @@
 #include "fmp4_storage.h"
 #include "fmp4_private.h"
 
+// The DVR log of a stream that has ended is served again only if the stream is published again within this time
+// (e.g. the encoder reconnects, or the server is restarted). Otherwise it is another broadcast with the same name.
+#define FMP4_DVR_RESUME_TIMEOUT_MS (60 * 1000)
+// Interval of looking for the DVR logs of the streams that are not published anymore
+#define FMP4_DVR_IDLE_CHECK_INTERVAL_MS (60 * 1000)
+
 namespace bmff
 {
 	FMP4Storage::FMP4Storage(const std::shared_ptr<FMp4StorageObserver> &observer, const std::shared_ptr<const MediaTrack> &track, const FMP4Storage::Config &config, const ov::String &stream_tag)
@@ -33,18 +40,23 @@ namespace bmff
 			// last segment number = current epoch time / segment duration
 			_initial_segment_number = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count() / _target_segment_duration_ms;
 		}
+
+		if (_config.dvr_enabled == true)
+		{
+			OpenDvrLog();
+		}
 	}
 
 	FMP4Storage::~FMP4Storage()
 	{
 		if (_config.dvr_enabled == true)
 		{
-			// Delete all dvr directory and files
-			auto dvr_path = GetDVRDirectory();
-
-			logti("Try to delete directory for LLHLS DVR: %s", dvr_path.CStr());
-			ov::DeleteDirectories(dvr_path);
-			logti("Successfully deleted directory for LLHLS DVR: %s", dvr_path.CStr());
+			// The log is kept so that the DVR segments are served again when the stream is resumed (or the process is restarted),
+			// it is discarded by OpenDvrLog() or DvrSegmentLog::RemoveIdleLogs() if the stream is not resumed in time
+			if (_dvr_log != nullptr)
+			{
+				_dvr_log->Close();
+			}
 		}
 
 		logtd("FMP4 Storage has been terminated successfully");
@@ -60,13 +72,36 @@ namespace bmff
 		return GetSegmentInternal(static_cast<int64_t>(segment_number));
 	}
 
+	std::shared_ptr<ov::FileRegion> FMP4Storage::GetSegmentFileRegion(uint32_t segment_number) const
+	{
+		if ((_config.dvr_enabled == false) || (_dvr_log == nullptr))
+		{
+			return nullptr;
+		}
+
+		{
+			std::shared_lock<std::shared_mutex> lock(_segments_lock);
+
+			// Only the recovered segments are in the log until the first live segment is created
+			auto first_segment_number = _segments.empty() ? _dvr_first_live_segment_number : _segments.begin()->first;
+			if (static_cast<int64_t>(segment_number) >= first_segment_number)
+			{
+				// The segment is served from memory
+				return nullptr;
+			}
+		}
+
+		return _dvr_log->GetFileRegion(segment_number);
+	}
+
 	std::shared_ptr<FMP4Segment> FMP4Storage::GetSegmentInternal(int64_t segment_number) const
 	{
 		std::shared_lock<std::shared_mutex> lock(_segments_lock);
 		
 		if (_segments.empty())
 		{
-			return nullptr;
+			// The segments recovered from DVR can be served before the first live segment is created
+			return (segment_number < _dvr_first_live_segment_number) ? LoadMediaSegmentFromFile(segment_number) : nullptr;
 		}
 
 		auto it = _segments.find(segment_number);
@@ -173,6 +208,28 @@ namespace bmff
 
 	bool FMP4Storage::StoreInitializationSection(const std::shared_ptr<ov::Data> &section)
 	{
+		if ((_dvr_log != nullptr) && (section != nullptr))
+		{
+			// Saved in the log, so it must be the same across builds and processes
+			uint64_t hash = 0;
+			auto digest = ov::MessageDigest::ComputeDigest(ov::CryptoAlgorithm::Sha1, section);
+			if ((digest != nullptr) && (digest->GetLength() >= sizeof(hash)))
+			{
+				::memcpy(&hash, digest->GetData(), sizeof(hash));
+			}
+
+			std::shared_lock<std::shared_mutex> lock(_segments_lock);
+
+			// The recovered segments cannot be played with the initialization section of another codec/track configuration
+			if (_segments.empty() && (_dvr_log->GetSegmentCount() > 0) && (_dvr_log->GetInitializationHash() != hash))
+			{
+				logtw("LLHLS stream (%s) / track (%d) - The track has been changed since the DVR segments were saved, they are discarded", _stream_tag.CStr(), _track->GetId());
+				_dvr_log->Reset();
+			}
+
+			_dvr_log->SetInitializationHash(hash);
+		}
+
 		_initialization_section = section;
 		if (_observer != nullptr)
 		{
@@ -191,57 +248,150 @@ namespace bmff
 		return ov::String::FormatString("%s/%s/%d", _config.dvr_storage_path.CStr(), _stream_tag.CStr(), _track->GetId());
 	}
 
-	ov::String FMP4Storage::GetSegmentFilePath(uint32_t segment_number) const
+	void FMP4Storage::OpenDvrLog()
 	{
-		return ov::String::FormatString("%s/%d.m4s", GetDVRDirectory().CStr(), segment_number);
+		auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+		auto dvr_window_ms = static_cast<int64_t>(_config.dvr_duration_sec * 1000);
+
+		// Logs of the streams that have not been published for a while cannot be resumed anymore
+		{
+			static std::mutex idle_check_mutex;
+			static int64_t last_idle_check_ms = 0;
+
+			std::lock_guard<std::mutex> lock(idle_check_mutex);
+			if ((now_ms - last_idle_check_ms) >= FMP4_DVR_IDLE_CHECK_INTERVAL_MS)
+			{
+				last_idle_check_ms = now_ms;
+				DvrSegmentLog::RemoveIdleLogs(_config.dvr_storage_path, std::max<int64_t>(dvr_window_ms, FMP4_DVR_RESUME_TIMEOUT_MS));
+			}
+		}
+
+		auto dvr_log = std::make_shared<DvrSegmentLog>(GetDVRDirectory());
+		if (dvr_log->Open() == false)
+		{
+			logte("LLHLS stream (%s) / track (%d) - Could not open DVR segment log, DVR is disabled", _stream_tag.CStr(), _track->GetId());
+			return;
+		}
+
+		// The stream ended normally a while ago, so this is another broadcast with the same name
+		auto closed_time_ms = dvr_log->GetPreviousClosedTimeMs();
+		if ((dvr_log->GetSegmentCount() > 0) && (closed_time_ms > 0) && ((now_ms - closed_time_ms) > FMP4_DVR_RESUME_TIMEOUT_MS))
+		{
+			logti("LLHLS stream (%s) / track (%d) - The DVR segments of the previous broadcast are discarded (ended %lld ms ago)",
+				  _stream_tag.CStr(), _track->GetId(), now_ms - closed_time_ms);
+			dvr_log->Reset();
+		}
+
+		// Segments that have fallen out of the DVR window in the meantime
+		for (const auto &segment_info : dvr_log->GetSegments())
+		{
+			if ((segment_info.start_time_ms + static_cast<int64_t>(segment_info.duration_ms)) >= (now_ms - dvr_window_ms))
+			{
+				break;
+			}
+
+			dvr_log->PopOldestSegment();
+		}
+
+		auto last_recovered_number = dvr_log->GetLastSegmentNumber();
+		if (last_recovered_number >= 0)
+		{
+			if (_config.server_time_based_segment_numbering == false)
+			{
+				// Continue the numbering after the segments left by the previous process
+				_initial_segment_number = last_recovered_number + 1;
+			}
+			else if (last_recovered_number >= _initial_segment_number)
+			{
+				// The numbers overlap the new ones (e.g. the clock went backwards)
+				dvr_log->Reset();
+			}
+		}
+
+		_dvr_first_live_segment_number = _initial_segment_number;
+
+		if (dvr_log->GetSegmentCount() > 0)
+		{
+			logti("LLHLS stream (%s) / track (%d) - %u DVR segments are recovered (%.1lf ms), live segments start from %lld",
+				  _stream_tag.CStr(), _track->GetId(), dvr_log->GetSegmentCount(), dvr_log->GetTotalDurationMs(), _initial_segment_number);
+		}
+
+		_dvr_log = dvr_log;
 	}
 
-	bool FMP4Storage::SaveMediaSegmentToFile(const std::shared_ptr<FMP4Segment> &segment)
+	std::vector<DvrSegmentLog::SegmentInfo> FMP4Storage::GetRecoveredSegments() const
 	{
-		if (_config.dvr_enabled == false)
+		std::vector<DvrSegmentLog::SegmentInfo> recovered_segments;
+
+		if (_dvr_log == nullptr)
 		{
-			return false;
+			return recovered_segments;
 		}
 
-		// Save to file
-		auto file_path = GetSegmentFilePath(segment->GetNumber());
-		auto dir = GetDVRDirectory();
-
-		// Create directory
-		if (ov::IsDirExist(dir) == false)
+		for (const auto &segment_info : _dvr_log->GetSegments())
 		{
-			logti("Try to create directory for LLHLS DVR: %s", dir.CStr());
-			if (ov::CreateDirectories(dir) == false)
+			if (static_cast<int64_t>(segment_info.segment_number) < _dvr_first_live_segment_number)
 			{
-				logte("Could not create directory for DVR: %s", dir.CStr());
-				return false;
+				recovered_segments.push_back(segment_info);
 			}
 		}
 
-		// Save to file
-		if (ov::DumpToFile(file_path, segment->GetData()) == nullptr)
+		return recovered_segments;
+	}
+
+	bool FMP4Storage::SetInitialSegmentNumber(int64_t segment_number)
+	{
+		std::lock_guard<std::shared_mutex> lock(_segments_lock);
+
+		if (_segments.empty() == false)
+		{
+			return false;
+		}
+
+		if ((_dvr_log != nullptr) && (_dvr_log->GetLastSegmentNumber() >= segment_number))
+		{
+			_dvr_log->Reset();
+		}
+
+		_initial_segment_number = segment_number;
+		_dvr_first_live_segment_number = segment_number;
+
+		return true;
+	}
+
+	void FMP4Storage::SetWallclockOffset(int64_t offset_ms)
+	{
+		_wallclock_offset_ms = offset_ms;
+	}
+
+	bool FMP4Storage::SaveMediaSegmentToFile(const std::shared_ptr<FMP4Segment> &segment)
+	{
+		if ((_config.dvr_enabled == false) || (_dvr_log == nullptr))
 		{
-			logte("Could not save segment to file: %s", file_path.CStr());
 			return false;
 		}
 
-		_dvr_info.AppendSegment(segment->GetNumber(), segment->GetDurationMs(), segment->GetDataLength());
+		auto first_partial = segment->GetPartialSegment(0);
+		bool independent = (first_partial != nullptr) ? first_partial->IsIndependent() : true;
+
+		auto start_time_ms = static_cast<int64_t>((static_cast<double>(segment->GetStartTimestamp()) / _track->GetTimeBase().GetTimescale()) * 1000.0) + _wallclock_offset_ms;
 
-		// Delete old segments until the total duration is less than the maximum DVR duration
-		while (_dvr_info.GetTotalDurationMs() > (_config.dvr_duration_sec * 1000.0))
+		if (_dvr_log->Append(segment->GetNumber(), start_time_ms, segment->GetDurationMs(), independent, segment->GetData()) == false)
 		{
-			auto segment_to_delete = _dvr_info.PopOldestSegmentInfo();
+			logte("Could not save segment %u to DVR segment log: %s", segment->GetNumber(), GetDVRDirectory().CStr());
+			return false;
+		}
+
+		// Delete old segments until both the total duration and the total size are under the limits
+		while ((_dvr_log->GetTotalDurationMs() > (_config.dvr_duration_sec * 1000.0)) ||
+			   ((_config.dvr_max_bytes > 0) && (_dvr_log->GetTotalBytes() > _config.dvr_max_bytes)))
+		{
+			auto segment_to_delete = _dvr_log->PopOldestSegment();
 			if (segment_to_delete.IsAvailable() == false)
 			{
 				break;
 			}
 
-			auto file_path = GetSegmentFilePath(segment_to_delete.segment_number);
-			if (std::remove(file_path) != 0)
-			{
-				logte("Could not delete DVR segment file: %s", file_path.CStr());
-			}
-
 			if (_observer != nullptr)
 			{
 				_observer->OnMediaSegmentDeleted(_track->GetId(), segment_to_delete.segment_number);
@@ -253,24 +403,18 @@ namespace bmff
 
 	std::shared_ptr<FMP4Segment> FMP4Storage::LoadMediaSegmentFromFile(uint32_t segment_number) const
 	{
-		if (_config.dvr_enabled == false)
-		{
-			return nullptr;
-		}
-
-		auto info = _dvr_info.GetSegmentInfo(segment_number);
-		if (info.IsAvailable() == false)
+		if ((_config.dvr_enabled == false) || (_dvr_log == nullptr))
 		{
-			logte("Could not find segment info: %u", segment_number);
 			return nullptr;
 		}
 
-		auto file_path = GetSegmentFilePath(segment_number);
+		DvrSegmentLog::SegmentInfo info;
 
-		auto data = ov::LoadFromFile(file_path);
+		// The data refers the memory-mapped log, it is not copied
+		auto data = _dvr_log->Read(segment_number, &info);
 		if (data == nullptr)
 		{
-			logte("Could not load segment from file: %s", file_path.CStr());
+			logte("Could not load segment %u from DVR segment log: %s", segment_number, GetDVRDirectory().CStr());
 			return nullptr;
 		}
 
@@ -342,6 +486,9 @@ namespace bmff
 			return false;
 		}
 
+		// The partial segment is now served as a completed one
+		ClearBuildingPartial();
+
 		segment->AddMarkers(markers);
 
 		if (segment->GetDurationMs() > _config.segment_duration_ms * 2)
@@ -456,4 +603,68 @@ namespace bmff
 
 		return true;
 	}
+
+	bool FMP4Storage::AppendMediaFragment(const std::shared_ptr<const ov::Data> &fragment)
+	{
+		if (fragment == nullptr)
+		{
+			return false;
+		}
+
+		auto segment = GetLastSegmentInternal();
+		if (segment == nullptr || segment->IsCompleted() == true)
+		{
+			// The number of the partial segment is determined when the segment is created
+			return true;
+		}
+
+		int64_t segment_number = segment->GetNumber();
+		int64_t partial_number = segment->GetPartialCount();
+
+		{
+			std::lock_guard<std::mutex> lock(_building_partial_lock);
+
+			if ((_building_segment_number != segment_number) || (_building_partial_number != partial_number))
+			{
+				_building_segment_number = segment_number;
+				_building_partial_number = partial_number;
+				_building_partial_fragments.clear();
+			}
+
+			_building_partial_fragments.push_back(fragment);
+		}
+
+		if (_observer != nullptr)
+		{
+			_observer->OnMediaFragmentAppended(_track->GetId(), segment_number, partial_number);
+		}
+
+		return true;
+	}
+
+	bool FMP4Storage::GetBuildingPartialFragments(int64_t segment_number, int64_t partial_number, size_t from_index, std::vector<std::shared_ptr<const ov::Data>> &fragments) const
+	{
+		std::lock_guard<std::mutex> lock(_building_partial_lock);
+
+		if ((_building_segment_number != segment_number) || (_building_partial_number != partial_number))
+		{
+			return false;
+		}
+
+		if (from_index < _building_partial_fragments.size())
+		{
+			fragments.insert(fragments.end(), _building_partial_fragments.begin() + from_index, _building_partial_fragments.end());
+		}
+
+		return true;
+	}
+
+	void FMP4Storage::ClearBuildingPartial()
+	{
+		std::lock_guard<std::mutex> lock(_building_partial_lock);
+
+		_building_segment_number = -1;
+		_building_partial_number = -1;
+		_building_partial_fragments.clear();
+	}
 } // namespace bmff
\ No newline at end of file
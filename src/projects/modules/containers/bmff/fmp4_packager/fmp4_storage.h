@@ -9,6 +9,7 @@
 #pragma once
 
 #include "fmp4_structure.h"
+#include "fmp4_dvr_log.h"
 #include <base/common_types.h>
 #include <base/modules/container/segment_storage.h>
 #include <base/modules/marker/marker_box.h>
@@ -21,6 +22,8 @@ namespace bmff
 		virtual void OnFMp4StorageInitialized(const int32_t &track_id) = 0;
 		virtual void OnMediaSegmentCreated(const int32_t &track_id, const uint32_t &segment_number) = 0;
 		virtual void OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number, bool last_chunk) = 0;
+		// A fragment of the chunk being built is appended (FMP4Packager::Config::progressive_part)
+		virtual void OnMediaFragmentAppended(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number) = 0;
 		virtual void OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t &segment_number) = 0;
 	};
 
@@ -34,6 +37,8 @@ namespace bmff
 			bool dvr_enabled = false;
 			ov::String dvr_storage_path;
 			uint64_t dvr_duration_sec = 0;
+			// 0 means no limit
+			uint64_t dvr_max_bytes = 0;
 			bool server_time_based_segment_numbering = false;
 		};
 
@@ -48,134 +53,54 @@ namespace bmff
 		uint64_t GetSegmentCount() const override;
 		int64_t GetLastSegmentNumber() const override;
 		std::tuple<int64_t, int64_t> GetLastPartialSegmentNumber() const;
+		// Returns the range of the segment in the DVR log to send it using sendfile()
+		// nullptr if the segment is still in memory or DVR is disabled
+		std::shared_ptr<ov::FileRegion> GetSegmentFileRegion(uint32_t segment_number) const;
 		
 		bool StoreInitializationSection(const std::shared_ptr<ov::Data> &section);
 		bool AppendMediaChunk(const std::shared_ptr<ov::Data> &chunk, int64_t start_timestamp, double duration_ms, bool independent, bool last_chunk, const std::vector<std::shared_ptr<Marker>> &markers = {});
 
+		// Appends a fragment of the partial segment being built, the partial segment is completed by AppendMediaChunk()
+		// and its data is the same as the fragments.
+		bool AppendMediaFragment(const std::shared_ptr<const ov::Data> &fragment);
+		// Returns false if (segment_number, partial_number) is not being built,
+		// otherwise <fragments> has the fragments from <from_index>
+		bool GetBuildingPartialFragments(int64_t segment_number, int64_t partial_number, size_t from_index, std::vector<std::shared_ptr<const ov::Data>> &fragments) const;
+
 		uint64_t GetMaxPartialDurationMs() const override;
 		uint64_t GetMinPartialDurationMs() const override;
 
 		double GetTargetSegmentDuration() const;
 
+		// DVR segments left by the previous process (of the same stream), they are older than the live segments
+		std::vector<DvrSegmentLog::SegmentInfo> GetRecoveredSegments() const;
+		// The live segments start from <segment_number> so that all tracks continue from the same number after the recovered segments.
+		// Must be called before the first segment is created.
+		bool SetInitialSegmentNumber(int64_t segment_number);
+		// Wall clock (ms) = timestamp (ms) + offset, saved with the DVR segments
+		void SetWallclockOffset(int64_t offset_ms);
+
 	private:
 		std::shared_ptr<FMP4Segment> GetSegmentInternal(int64_t segment_number) const;
 		std::shared_ptr<FMP4Segment> GetLastSegmentInternal() const;
 		
 
 		// For DVR
-		class DvrInfo
-		{
-		public:
-			struct SegmentInfo
-			{
-				uint32_t segment_number = 0;
-				double duration_ms = 0;
-				size_t segment_size = 0;
-
-				bool IsAvailable() const
-				{
-					return segment_size != 0;
-				}
-			}; 
-
-			// Get total duration of all segments
-			uint64_t GetTotalDurationMs() const
-			{
-				return _total_dvr_segment_duration_ms;
-			}
-
-			// Get total number of segments
-			uint32_t GetTotalSegmentCount() const
-			{
-				std::shared_lock<std::shared_mutex> lock(_segments_lock);
-				return _segments.size();
-			}
-
-			void AppendSegment(uint32_t segment_number, double duration_ms, size_t segment_size)
-			{
-				//lock
-				std::lock_guard<std::shared_mutex> lock(_segments_lock);
-				
-				if (_segments.empty())
-				{
-					_first_segment_number = segment_number;
-				}
-				else
-				{
-					if (_segments.back().segment_number + 1 != segment_number)
-					{
-						logw("DVR", "Segment number is not continuous: %u -> %u", _segments.front().segment_number, segment_number);
-					}
-				}
-
-				_segments.push_back({segment_number, duration_ms, segment_size});
-				_total_dvr_segment_duration_ms += duration_ms;
-			}
-
-			// Pop oldest segment info
-			SegmentInfo PopOldestSegmentInfo()
-			{
-				//lock
-				std::lock_guard<std::shared_mutex> lock(_segments_lock);
-
-				if(_segments.empty())
-				{
-					return {0, 0, 0};
-				}
-
-				auto segment_info = _segments.front();
-				_segments.pop_front();
-				_total_dvr_segment_duration_ms -= segment_info.duration_ms;
-
-				// update first segment number
-				_first_segment_number += 1;
-
-				return segment_info;
-			}
-
-			// Get segment info
-			SegmentInfo GetSegmentInfo(uint32_t segment_number) const
-			{
-				//lock
-				std::shared_lock<std::shared_mutex> lock(_segments_lock);
-
-				if(_segments.empty())
-				{
-					return {0, 0, 0};
-				}
-
-				// Check if the segment number is valid
-				if (_first_segment_number > segment_number)
-				{
-					return {0, 0, 0};
-				}
-
-				auto index = segment_number - _first_segment_number;
-				if (index >= _segments.size())
-				{
-					return {0, 0, 0};
-				}
-
-				return _segments[index];
-			}
-
-		private:
-			std::deque<SegmentInfo> _segments;
-			// segments lock
-			mutable std::shared_mutex _segments_lock;
-			uint32_t _first_segment_number = 0;
-			double _total_dvr_segment_duration_ms = 0;
-		};
+		std::shared_ptr<DvrSegmentLog> _dvr_log;
+		// Segments recovered from the log of the previous process are older than this
+		int64_t _dvr_first_live_segment_number = 0;
+		std::atomic<int64_t> _wallclock_offset_ms{0};
 
-		DvrInfo _dvr_info;
+		void OpenDvrLog();
 
 		ov::String GetDVRDirectory() const;
-		ov::String GetSegmentFilePath(uint32_t segment_number) const;
 		bool SaveMediaSegmentToFile(const std::shared_ptr<FMP4Segment> &segment);
 		std::shared_ptr<FMP4Segment> LoadMediaSegmentFromFile(uint32_t segment_number) const;
 
 		std::shared_ptr<FMP4Segment> CreateNextSegment();
 
+		void ClearBuildingPartial();
+
 		Config	_config;
 
 		std::shared_ptr<const MediaTrack> _track;
@@ -186,6 +111,12 @@ namespace bmff
 		std::map<int64_t, std::shared_ptr<FMP4Segment>> _segments;
 		mutable std::shared_mutex _segments_lock;
 
+		// Partial segment being built
+		int64_t _building_segment_number = -1;
+		int64_t _building_partial_number = -1;
+		std::vector<std::shared_ptr<const ov::Data>> _building_partial_fragments;
+		mutable std::mutex _building_partial_lock;
+
 		int64_t _initial_segment_number = 0;
 		int64_t _start_timestamp_delta = -1;
 
@@ -177,6 +177,17 @@ namespace mpegts
 		return segment->GetData();
 	}
 
+	std::shared_ptr<ov::FileRegion> Packager::GetSegmentFileRegion(uint64_t segment_id) const
+	{
+		auto segment = GetSegment(segment_id);
+		if (segment == nullptr)
+		{
+			return nullptr;
+		}
+
+		return segment->GetFileRegion();
+	}
+
     void Packager::OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::vector<std::shared_ptr<mpegts::Packet>> &pes_packets)
     {
        //logtd("OnFrame track_id %u", media_packet->GetTrackId());
@@ -124,6 +124,23 @@ namespace mpegts
 			return nullptr;
 		}
 
+		// Opens the file of the segment to send it using sendfile()
+		// nullptr if the segment is in memory
+		std::shared_ptr<ov::FileRegion> GetFileRegion() const
+		{
+			if ((_is_data_in_memory == true) || (_is_data_in_file == false))
+			{
+				return nullptr;
+			}
+
+			auto file_region = ov::FileRegion::Open(_file_path);
+			if (file_region == nullptr)
+			{
+				loge("MPEG-2 TS", "Segment::GetFileRegion - Failed to open file(%s)", _file_path.CStr());
+			}
+			return file_region;
+		}
+
 		bool HasMarker() const
 		{
 			return _markers.empty() == false;
@@ -416,6 +433,7 @@ namespace mpegts
 		// Get the segment data
 		std::shared_ptr<Segment> GetSegment(uint64_t segment_id) const;
 		std::shared_ptr<const ov::Data> GetSegmentData(uint64_t segment_id) const;
+		std::shared_ptr<ov::FileRegion> GetSegmentFileRegion(uint64_t segment_id) const;
 
     private:
         const Config &GetConfig() const;
@@ -22,16 +22,17 @@ SrtpAdapter::SrtpAdapter()
 
 SrtpAdapter::~SrtpAdapter()
 {
-}
-
-bool SrtpAdapter::Release()
-{
-	std::lock_guard<std::mutex> lock(_session_lock);
-
 	if(_session != nullptr)
 	{
 		srtp_dealloc(_session);
+		_session = nullptr;
 	}
+}
+
+bool SrtpAdapter::Release()
+{
+	// Another thread may be processing a packet, so the context is not deallocated here
+	_released = true;
 	return true;
 }
 
@@ -66,7 +67,6 @@ bool SrtpAdapter::SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shar
 	policy.allow_repeat_tx = 1;
 	policy.next = nullptr;
 
-	std::lock_guard<std::mutex> lock(_session_lock);
 	int err = srtp_create(&_session, &policy);
 	if(err != srtp_err_status_ok)
 	{
@@ -85,9 +85,14 @@ bool SrtpAdapter::SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shar
 	return true;
 }
 
-bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
+bool SrtpAdapter::ProtectRtp(const std::shared_ptr<ov::Data> &data, size_t offset)
 {
-	if(!_session)
+	if(!_session || _released)
+	{
+		return false;
+	}
+
+	if(offset >= data->GetLength())
 	{
 		return false;
 	}
@@ -100,17 +105,16 @@ bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
 		return false;
 	}
 
-	auto buffer = data->GetWritableData();
-	int out_len = static_cast<int>(data->GetLength());
+	auto buffer = data->GetWritableDataAs<uint8_t>() + offset;
+	int out_len = static_cast<int>(data->GetLength() - offset);
 	data->SetLength(need_len);
 
 	// FOR DEBUG
-	auto byte_buffer = data->GetDataAs<uint8_t>();
+	auto byte_buffer = data->GetDataAs<uint8_t>() + offset;
 	uint8_t payload_type = byte_buffer[1] & 0x7F;
 	uint8_t red_payload_type = byte_buffer[12];
 	uint16_t seq = ByteReader<uint16_t>::ReadBigEndian(&byte_buffer[2]);
 
-	std::lock_guard<std::mutex> lock(_session_lock);
 	int err = srtp_protect(_session, buffer, &out_len);
 	if(err != srtp_err_status_ok)
 	{
@@ -121,9 +125,9 @@ bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
 	return true;
 }
 
-bool SrtpAdapter::ProtectRtcp(std::shared_ptr<ov::Data> data)
+bool SrtpAdapter::ProtectRtcp(const std::shared_ptr<ov::Data> &data)
 {
-    if(!_session)
+    if(!_session || _released)
     {
         return false;
     }
@@ -141,7 +145,6 @@ bool SrtpAdapter::ProtectRtcp(std::shared_ptr<ov::Data> data)
     int out_len = static_cast<int>(data->GetLength());
     data->SetLength(need_len);
 
-	std::lock_guard<std::mutex> lock(_session_lock);
     int err = srtp_protect_rtcp(_session, buffer, &out_len);
     if(err != srtp_err_status_ok)
     {
@@ -154,7 +157,7 @@ bool SrtpAdapter::ProtectRtcp(std::shared_ptr<ov::Data> data)
 
 bool SrtpAdapter::UnprotectRtp(const std::shared_ptr<ov::Data> &data)
 {
-	if (!_session)
+	if (!_session || _released)
     {
         return false;
     }
@@ -162,7 +165,6 @@ bool SrtpAdapter::UnprotectRtp(const std::shared_ptr<ov::Data> &data)
     auto buffer = data->GetWritableData();
     int out_len = static_cast<int>(data->GetLength());
 
-	std::lock_guard<std::mutex> lock(_session_lock);
     int err = srtp_unprotect(_session, buffer, &out_len);
     if (err != srtp_err_status_ok)
     {
@@ -177,7 +179,7 @@ bool SrtpAdapter::UnprotectRtp(const std::shared_ptr<ov::Data> &data)
 
 bool SrtpAdapter::UnprotectRtcp(const std::shared_ptr<ov::Data> &data)
 {
-    if (!_session)
+    if (!_session || _released)
     {
         return false;
     }
@@ -185,7 +187,6 @@ bool SrtpAdapter::UnprotectRtcp(const std::shared_ptr<ov::Data> &data)
     auto buffer = data->GetWritableData();
     int out_len = static_cast<int>(data->GetLength());
 
-	std::lock_guard<std::mutex> lock(_session_lock);
     int err = srtp_unprotect_rtcp(_session, buffer, &out_len);
     if (err != srtp_err_status_ok)
     {
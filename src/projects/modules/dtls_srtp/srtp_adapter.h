@@ -13,22 +13,29 @@
 
 #include <srtp2/srtp.h>
 
+// A SRTP context of one direction
+//
+// It is not thread-safe, packets must be protected (or unprotected) by one thread at a time.
+// The owner serializes the calls, so no lock is taken per packet.
 class SrtpAdapter
 {
 public:
 	SrtpAdapter();
 	virtual ~SrtpAdapter();	
+	// Packets are no longer processed, the context is deallocated when the adapter is destroyed
 	bool	Release();
 	bool	SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shared_ptr<ov::Data> key);
 
-	bool	ProtectRtp(std::shared_ptr<ov::Data> data);
-    bool	ProtectRtcp(std::shared_ptr<ov::Data> data);
+	// Protects the packet in place, the auth tag is written in the tailroom of the buffer (capacity - length)
+	// The packet starts at the offset and ends at the end of the data, so the packets before it are kept (e.g. a batch)
+	bool	ProtectRtp(const std::shared_ptr<ov::Data> &data, size_t offset = 0);
+    bool	ProtectRtcp(const std::shared_ptr<ov::Data> &data);
 	bool	UnprotectRtp(const std::shared_ptr<ov::Data> &data);
     bool	UnprotectRtcp(const std::shared_ptr<ov::Data> &data);
 
 private:
-	std::mutex		_session_lock;
 	srtp_ctx_t_* 	_session;
+	std::atomic<bool>	_released{false};
 	
 	uint32_t 		_rtp_auth_tag_len;
     uint32_t 		_rtcp_auth_tag_len;
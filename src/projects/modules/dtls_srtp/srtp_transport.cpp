@@ -23,13 +23,9 @@ SrtpTransport::~SrtpTransport()
 
 bool SrtpTransport::Stop()
 {
-	if(_send_session != nullptr)
+	if(_key_ready)
 	{
 		_send_session->Release();
-	}
-
-	if(_recv_session != nullptr)
-	{
 		_recv_session->Release();
 	}
 
@@ -44,32 +40,70 @@ bool SrtpTransport::OnDataReceivedFromPrevNode(NodeType from_node, const std::sh
 		return false;
 	}
 
-	if(!_send_session)
+	if(_key_ready == false)
 	{
 		return false;
 	}
-	
-	if(from_node == NodeType::Rtp)
+
+	if(_send_context_confined)
 	{
-		if(!_send_session->ProtectRtp(data))
+		if(Protect(from_node, data) == false)
 		{
 			return false;
 		}
 	}
-	else if(from_node == NodeType::Rtcp)
+	else
 	{
-		 if(!_send_session->ProtectRtcp(data))
-		 {
+		std::lock_guard<std::mutex> lock(_send_lock);
+		if(Protect(from_node, data) == false)
+		{
 			return false;
-		 }
+		}
 	}
-	else
+
+	// To DTLS transport
+	return SendDataToNextNode(data);
+}
+
+bool SrtpTransport::Protect(NodeType from_node, const std::shared_ptr<ov::Data> &data)
+{
+	// The packet is protected in place
+	if(from_node == NodeType::Rtp)
+	{
+		return _send_session->ProtectRtp(data);
+	}
+	else if(from_node == NodeType::Rtcp)
+	{
+		return _send_session->ProtectRtcp(data);
+	}
+
+	return false;
+}
+
+void SrtpTransport::SetSendContextConfined(bool confined)
+{
+	_send_context_confined = confined;
+}
+
+bool SrtpTransport::ProtectRtp(const std::shared_ptr<ov::Data> &data, size_t offset)
+{
+	if(GetNodeState() != ov::Node::NodeState::Started)
 	{
 		return false;
 	}
 
-	// To DTLS transport
-	return SendDataToNextNode(data);
+	if(_key_ready == false)
+	{
+		return false;
+	}
+
+	if(_send_context_confined)
+	{
+		return _send_session->ProtectRtp(data, offset);
+	}
+
+	std::lock_guard<std::mutex> lock(_send_lock);
+	return _send_session->ProtectRtp(data, offset);
 }
 
 bool SrtpTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data)
@@ -80,7 +114,7 @@ bool SrtpTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::sh
 		return false;
 	}
 
-	if(_recv_session == nullptr)
+	if(_key_ready == false)
 	{
 		return false;
 	}
@@ -98,6 +132,8 @@ bool SrtpTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::sh
 
 	NodeType node_type = NodeType::Unknown;
 
+	std::unique_lock<std::mutex> lock(_recv_lock);
+
 	// RTCP
 	if(payload_type >= 192 && payload_type <= 223)
 	{
@@ -121,6 +157,8 @@ bool SrtpTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::sh
 		node_type = NodeType::Srtp;
 	}
 
+	lock.unlock();
+
 	// To RTP_RTCP
 	return SendDataToPrevNode(node_type, decode_data);
 }
@@ -128,37 +166,30 @@ bool SrtpTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::sh
 // Initialize SRTP
 bool SrtpTransport::SetKeyMaterial(uint64_t crypto_suite, std::shared_ptr<ov::Data> server_key, std::shared_ptr<ov::Data> client_key)
 {
-	if(_send_session || _recv_session)
+	if(_key_ready || _send_session || _recv_session)
 	{
 		return false;
 	}
 
 	logtd("Try to set key material");
 
-	_send_session = std::make_shared<SrtpAdapter>();
-	if(_send_session == nullptr)
+	auto send_session = std::make_shared<SrtpAdapter>();
+	if(!send_session->SetKey(ssrc_any_outbound, crypto_suite, server_key))
 	{
-		logte("Create srtp adapter failed");
 		return false;
 	}
 
-	if(!_send_session->SetKey(ssrc_any_outbound, crypto_suite, server_key))
+	auto recv_session = std::make_shared<SrtpAdapter>();
+	if(!recv_session->SetKey(ssrc_any_inbound, crypto_suite, client_key))
 	{
 		return false;
 	}
 
-	_recv_session = std::make_shared<SrtpAdapter>();
-	if(_recv_session == nullptr)
-	{
-		_send_session.reset();
-		_send_session = nullptr;
-		return false;
-	}
+	_send_session = send_session;
+	_recv_session = recv_session;
 
-	if(!_recv_session->SetKey(ssrc_any_inbound, crypto_suite, client_key))
-	{
-		return false;
-	}
+	// Packets are processed from now on
+	_key_ready = true;
 
 	return true;
-}
\ No newline at end of file
+}
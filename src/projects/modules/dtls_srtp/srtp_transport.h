@@ -27,7 +27,26 @@ public:
 
 	bool SetKeyMaterial(uint64_t crypto_suite, std::shared_ptr<ov::Data> server_key, std::shared_ptr<ov::Data> client_key);
 
+	// If the owner sends packets from one thread at a time (e.g. under its own lock),
+	// the send context is confined to that thread and used without locking.
+	// Must be called before the node is started.
+	void SetSendContextConfined(bool confined);
+
+	// Protects the RTP packet that the owner assembled at the offset of the data, without passing it to the next node.
+	// The packet must end at the end of the data, the auth tag is appended in place.
+	bool ProtectRtp(const std::shared_ptr<ov::Data> &data, size_t offset);
+
 private:
+	bool Protect(NodeType from_node, const std::shared_ptr<ov::Data> &data);
+
+	// The contexts are set once when the DTLS handshake is completed, then _key_ready is set
+	std::atomic<bool>					_key_ready{false};
 	std::shared_ptr<SrtpAdapter>		_send_session = nullptr;
 	std::shared_ptr<SrtpAdapter>		_recv_session = nullptr;
+
+	bool								_send_context_confined = false;
+	// Serializes the use of the send context if it is not confined
+	std::mutex							_send_lock;
+	// Packets may be received by several threads
+	std::mutex							_recv_lock;
 };
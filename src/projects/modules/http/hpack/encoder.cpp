@@ -33,19 +33,198 @@ namespace http
 			std::shared_ptr<ov::Data> encoded_data = std::make_shared<ov::Data>(header_fields.GetSize());
 			ov::ByteStream stream(encoded_data.get());
 
-			bool result = false;
+			if (EncodePendingDynamicTableSizeUpdate(stream) == false)
+			{
+				return nullptr;
+			}
+
+			if (EncodeHeaderField(stream, header_fields, type) == false)
+			{
+				return nullptr;
+			}
+
+			return encoded_data;
+		}
+
+		std::shared_ptr<ov::Data> Encoder::EncodeHeaderBlock(const std::vector<HeaderField> &header_fields)
+		{
+			std::lock_guard<std::mutex> lock(_encoder_lock);
+
+			std::vector<const HeaderField *> stable_fields;
+			std::vector<const HeaderField *> volatile_fields;
+			size_t estimated_size = 0;
+
+			stable_fields.reserve(header_fields.size());
+
+			// The relative order of the fields with the same name is kept since they are in the same group
+			for (const auto &header_field : header_fields)
+			{
+				if (IsVolatileHeaderField(header_field.GetName()))
+				{
+					volatile_fields.push_back(&header_field);
+				}
+				else
+				{
+					stable_fields.push_back(&header_field);
+				}
+
+				estimated_size += header_field.GetSize();
+			}
+
+			std::shared_ptr<ov::Data> encoded_data = std::make_shared<ov::Data>(estimated_size);
+			ov::ByteStream stream(encoded_data.get());
+
+			if (_need_signal_table_size_update)
+			{
+				// Indexes of the cached blocks may be evicted
+				_header_block_cache.clear();
+
+				if (EncodePendingDynamicTableSizeUpdate(stream) == false)
+				{
+					return nullptr;
+				}
+			}
+
+			auto hash = HashHeaderFields(stable_fields);
+			auto modification_count = _table_connector.GetDynamicTableModificationCount();
+
+			auto cache_item = _header_block_cache.find(hash);
+			if ((cache_item != _header_block_cache.end()) &&
+				(cache_item->second.table_modification_count == modification_count) &&
+				IsSameHeaderFields(cache_item->second.header_fields, stable_fields))
+			{
+				stream.Write(cache_item->second.encoded_data);
+			}
+			else
+			{
+				auto block_offset = encoded_data->GetLength();
+
+				for (const auto header_field : stable_fields)
+				{
+					if (EncodeHeaderField(stream, *header_field, EncodingType::LiteralWithIndexing) == false)
+					{
+						return nullptr;
+					}
+				}
+
+				// Only a block that refers to the tables without changing them can be reused as it is
+				if (_table_connector.GetDynamicTableModificationCount() == modification_count)
+				{
+					if ((_header_block_cache.size() >= HPACK_MAX_CACHED_HEADER_BLOCKS) && (cache_item == _header_block_cache.end()))
+					{
+						_header_block_cache.clear();
+					}
+
+					auto &cached_block = _header_block_cache[hash];
+
+					cached_block.header_fields.clear();
+					cached_block.header_fields.reserve(stable_fields.size());
+					for (const auto header_field : stable_fields)
+					{
+						cached_block.header_fields.push_back(*header_field);
+					}
+
+					cached_block.table_modification_count = modification_count;
+					cached_block.encoded_data = encoded_data->Subdata(block_offset);
+				}
+			}
+
+			for (const auto header_field : volatile_fields)
+			{
+				if (EncodeHeaderField(stream, *header_field, EncodingType::LiteralWithoutIndexing) == false)
+				{
+					return nullptr;
+				}
+			}
+
+			return encoded_data;
+		}
+
+		bool Encoder::IsVolatileHeaderField(const ov::String &name)
+		{
+			// Values of these fields are different for almost every response, indexing them just evicts useful entries
+			static const std::unordered_set<ov::String, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> volatile_field_names{
+				":path",
+				"age",
+				"content-length",
+				"content-range",
+				"date",
+				"etag",
+				"expires",
+				"last-modified",
+				"set-cookie"};
+
+			return volatile_field_names.find(name) != volatile_field_names.end();
+		}
+
+		uint64_t Encoder::HashHeaderFields(const std::vector<const HeaderField *> &header_fields)
+		{
+			// FNV-1a
+			uint64_t hash = 0xcbf29ce484222325ULL;
+
+			auto hash_string = [&hash](const ov::String &value) {
+				auto data = value.CStr();
+				auto length = value.GetLength();
+
+				for (size_t index = 0; index < length; index++)
+				{
+					hash ^= static_cast<uint8_t>(data[index]);
+					hash *= 0x100000001b3ULL;
+				}
+
+				// Separator so that {"ab", "c"} and {"a", "bc"} differ
+				hash ^= 0xFF;
+				hash *= 0x100000001b3ULL;
+			};
+
+			for (const auto header_field : header_fields)
+			{
+				hash_string(header_field->GetName());
+				hash_string(header_field->GetValue());
+			}
+
+			return hash;
+		}
+
+		bool Encoder::IsSameHeaderFields(const std::vector<HeaderField> &cached_header_fields, const std::vector<const HeaderField *> &header_fields)
+		{
+			if (cached_header_fields.size() != header_fields.size())
+			{
+				return false;
+			}
 
+			for (size_t index = 0; index < header_fields.size(); index++)
+			{
+				if ((cached_header_fields[index].GetName() != header_fields[index]->GetName()) ||
+					(cached_header_fields[index].GetValue() != header_fields[index]->GetValue()))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool Encoder::EncodePendingDynamicTableSizeUpdate(ov::ByteStream &stream)
+		{
 			if (_need_signal_table_size_update)
 			{
 				if (EncodeDynamicTableSizeUpdate(stream, _table_connector.GetDynamicTableSize()) == false)
 				{
 					logte("Failed to encode DynamicTableSizeUpdate (%u) field", _table_connector.GetDynamicTableSize());
-					return nullptr;
+					return false;
 				}
 
 				_need_signal_table_size_update = false;
 			}
 
+			return true;
+		}
+
+		bool Encoder::EncodeHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, EncodingType type)
+		{
+			bool result = false;
+
 			// First check if the header field is in the table
 			auto [name_indexed, value_indexed, index] = _table_connector.LookupIndex(header_fields);
 
@@ -67,17 +246,17 @@ namespace http
 						result = EncodeLiteralHeaderFieldNeverIndexed(stream, header_fields, index);
 						break;
 					default:
-						return nullptr;
+						return false;
 				}
 			}
 
 			if (result == false)
 			{
 				logte("Failed to encode header field");
-				return nullptr;
+				return false;
 			}
 
-			return encoded_data;
+			return true;
 		}
 
 		bool Encoder::EncodeIndexedHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t index)
@@ -9,9 +9,15 @@
 #pragma once
 
 #include <base/ovlibrary/ovlibrary.h>
+
+#include <unordered_set>
+
 #include "data_structure.h"
 #include "table_connector.h"
 
+// Maximum number of encoded header blocks kept by an encoder (a connection)
+#define HPACK_MAX_CACHED_HEADER_BLOCKS 32
+
 namespace http
 {
 	// https://www.rfc-editor.org/rfc/rfc7541.html
@@ -31,7 +37,30 @@ namespace http
 
 			std::shared_ptr<ov::Data> Encode(const HeaderField &header_fields, EncodingType type);
 
+			// Encodes a header block (all header fields of a HEADERS/PUSH_PROMISE frame)
+			//
+			// Fields whose values change on every response (Date, Content-Length, ...) are encoded without indexing,
+			// and the other fields are encoded with indexing. Once the other fields are encoded with only the indexes
+			// of the tables, the encoded bytes are cached and reused for the same header fields
+			// as long as the dynamic table is not changed.
+			std::shared_ptr<ov::Data> EncodeHeaderBlock(const std::vector<HeaderField> &header_fields);
+
 		private:
+			struct CachedHeaderBlock
+			{
+				std::vector<HeaderField> header_fields;
+				// Modification count of the dynamic table when the block was encoded
+				uint64_t table_modification_count = 0;
+				std::shared_ptr<const ov::Data> encoded_data;
+			};
+
+			static bool IsVolatileHeaderField(const ov::String &name);
+			static uint64_t HashHeaderFields(const std::vector<const HeaderField *> &header_fields);
+			static bool IsSameHeaderFields(const std::vector<HeaderField> &cached_header_fields, const std::vector<const HeaderField *> &header_fields);
+
+			bool EncodePendingDynamicTableSizeUpdate(ov::ByteStream &stream);
+			bool EncodeHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, EncodingType type);
+
 			bool EncodeIndexedHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t index);
 			bool EncodeLiteralHeaderFieldWithIndexing(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t name_index);
 			bool EncodeLiteralHeaderFieldWithoutIndexing(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t name_index);
@@ -49,6 +78,9 @@ namespace http
 			TableConnector	_table_connector;
 			bool _need_signal_table_size_update = false;
 
+			// Hash of header fields : Encoded header block
+			std::unordered_map<uint64_t, CachedHeaderBlock> _header_block_cache;
+
 			std::mutex _encoder_lock;
 		};
 	} // namespace hpack
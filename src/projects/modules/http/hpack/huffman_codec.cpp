@@ -7,9 +7,10 @@
 //
 //==============================================================================
 
-#include <base/ovlibrary/bit_reader.h>
 #include "huffman_codec.h"
 
+#include "hpack_private.h"
+
 namespace http
 {
 	namespace hpack
@@ -274,142 +275,208 @@ namespace http
 			Build(0x7fffff0, 27, 254);
 			Build(0x3ffffee, 26, 255);
 			Build(0x3fffffff, 30, 256); //EOS
+
+			BuildDecodingTable();
+		}
+
+		size_t HuffmanCodec::GetEncodedLength(const ov::String &str) const
+		{
+			size_t bit_length = 0;
+			auto data = reinterpret_cast<const uint8_t *>(str.CStr());
+			auto length = str.GetLength();
+
+			for (size_t i = 0; i < length; i++)
+			{
+				bit_length += _codes[data[i]].length;
+			}
+
+			return (bit_length + 7) / 8;
 		}
 
 		std::shared_ptr<ov::Data> HuffmanCodec::Encode(const ov::String &str)
 		{
-			uint8_t out_data[str.GetLength() * 2];
+			auto encoded_length = GetEncodedLength(str);
+
+			auto encoded_data = std::make_shared<ov::Data>(encoded_length);
+			encoded_data->SetLength(encoded_length);
+
+			auto out_data = encoded_data->GetWritableDataAs<uint8_t>();
 			size_t out_data_size = 0;
 
+			auto data = reinterpret_cast<const uint8_t *>(str.CStr());
+			auto length = str.GetLength();
+
+			// The longest code is 30 bits, so the buffer never overflows with less than 8 bits remaining
 			uint64_t bit_buffer = 0;
 			size_t bit_buffer_length = 0;
-			size_t length = str.GetLength();
+
 			for (size_t i = 0; i < length; i++)
 			{
-				uint8_t c = str[i];
-				auto [code, code_bit_length] = _map[c];
-				
+				const auto &code = _codes[data[i]];
+
 				// Append the code to the bit buffer
-				bit_buffer <<= code_bit_length;
-				bit_buffer |= code;
-				bit_buffer_length += code_bit_length;
+				bit_buffer = (bit_buffer << code.length) | code.code;
+				bit_buffer_length += code.length;
 
-				// If the bit buffer is over 8 bits, flush it to the output buffer
+				// Flush the completed octets to the output buffer
 				while (bit_buffer_length >= 8)
 				{
-					uint8_t byte = static_cast<uint8_t>(bit_buffer >> (bit_buffer_length - 8));
 					bit_buffer_length -= 8;
-					out_data[out_data_size] = byte;
-					out_data_size ++;
+					out_data[out_data_size++] = static_cast<uint8_t>(bit_buffer >> bit_buffer_length);
 				}
 			}
-			
+
 			// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
 			// As the Huffman-encoded data doesn't always end at an octet boundary,
 			// some padding is inserted after it, up to the next octet boundary.  To
 			// prevent this padding from being misinterpreted as part of the string
 			// literal, the most significant bits of the code corresponding to the
 			// EOS (end-of-string) symbol are used.
-
-			// Append EOS
 			if (bit_buffer_length > 0)
 			{
-				auto byte = bit_buffer << (8 - bit_buffer_length);
-				// Append EOS(0xFF) to the end of the bit buffer
-				// bit_buffer is always less than 8 bits
-				byte |= 0xFF >> bit_buffer_length;
-
-				out_data[out_data_size] = byte;
-				out_data_size ++;
+				// The MSBs of EOS are all 1
+				out_data[out_data_size++] = static_cast<uint8_t>((bit_buffer << (8 - bit_buffer_length)) | (0xFF >> bit_buffer_length));
 			}
-			
-			return std::make_shared<ov::Data>(&out_data[0], out_data_size);
+
+			OV_ASSERT2(out_data_size == encoded_length);
+
+			return encoded_data;
 		}
 
 		bool HuffmanCodec::Decode(const std::shared_ptr<const ov::Data> &data, ov::String &str)
 		{
-			auto reader = std::make_shared<BitReader>(data->GetDataAs<uint8_t>(), data->GetLength());
-			auto node = _tree;
+			auto in_data = data->GetDataAs<uint8_t>();
+			auto length = data->GetLength();
+
+			// The shortest code is 5 bits
+			str.SetCapacity(str.GetLength() + ((length * 8) / 5) + 1);
 
-			while (reader->BytesRemained() > 0)
+			uint8_t state = 0;
+			// An empty string is valid
+			bool accepted = true;
+
+			for (size_t i = 0; i < length; i++)
 			{
-				auto b = reader->ReadBit();
-				if (b == 1)
+				for (auto bits : {static_cast<uint8_t>(in_data[i] >> 4), static_cast<uint8_t>(in_data[i] & 0x0F)})
 				{
-					node = node->GetRight();
-					if (node == nullptr)
-					{
-						return false;
-					}
-				}
-				else
-				{
-					node = node->GetLeft();
-					if (node == nullptr)
+					const auto &entry = _decoding_table[state][bits];
+
+					if (entry.flags & DecodingFlag::Failed)
 					{
+						// A Huffman-encoded string literal containing the EOS symbol MUST be treated as a decoding error.
 						return false;
 					}
-				}
 
-				if (node->IsLeaf())
-				{
-					if (node->GetValue() == 256)
+					if (entry.flags & DecodingFlag::Symbol)
 					{
-						// EOS
-						return false;
+						str.Append(static_cast<char>(entry.symbol));
 					}
 
-					str.Append(static_cast<uint8_t>(node->GetValue()));
-					node = _tree;
-
-					// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
-					// As the Huffman-encoded data doesn't always end at an octet boundary,
-					// some padding is inserted after it, up to the next octet boundary.  To
-					// prevent this padding from being misinterpreted as part of the string
-					// literal, the most significant bits of the code corresponding to the
-					// EOS (end-of-string) symbol are used.
-
-					// So, the symbol (1111111) corresponding to EOS may be included in the 
-					// last 7 bits or less. In this case, no processing is done because it will 
-					// terminate without reaching the leaf naturally.
+					state = entry.next_state;
+					accepted = entry.flags & DecodingFlag::Accepted;
 				}
 			}
 
-			return true;
+			// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
+			// A padding strictly longer than 7 bits MUST be treated as a decoding error.
+			// A padding not corresponding to the most significant bits of the code for the EOS symbol MUST be treated as a decoding error.
+			return accepted;
+		}
+
+		void HuffmanCodec::Build(uint32_t code, uint8_t length, uint16_t symbol)
+		{
+			_codes[symbol].code = code;
+			_codes[symbol].length = length;
 		}
 
-		void HuffmanCodec::BuildTree(uint32_t code, uint8_t length, uint16_t symbol)
+		void HuffmanCodec::BuildDecodingTable()
 		{
-			//TODO(Getroot): If needed, apply faster algorithm
-			auto node = _tree;
+			struct TreeNode
+			{
+				int32_t children[2] = {-1, -1};
+				int32_t symbol = -1;
+			};
 
-			for (uint16_t i = 0; i < length; i++)
+			// Build the Huffman tree from the codes
+			std::vector<TreeNode> tree(1);
+
+			for (uint16_t symbol = 0; symbol < HPACK_HUFFMAN_SYMBOL_COUNT; symbol++)
 			{
-				auto bit = (code >> (length - i - 1)) & 0x1;
+				const auto &code = _codes[symbol];
+				int32_t node = 0;
 
-				if (bit == 0)
+				for (int bit_index = code.length - 1; bit_index >= 0; bit_index--)
 				{
-					node = node->GetLeft(true);
+					auto bit = (code.code >> bit_index) & 0x1;
+
+					if (tree[node].children[bit] < 0)
+					{
+						tree[node].children[bit] = tree.size();
+						tree.emplace_back();
+					}
+
+					node = tree[node].children[bit];
 				}
-				else
+
+				tree[node].symbol = symbol;
+			}
+
+			// Internal nodes are the states (the root is state 0)
+			std::vector<int32_t> state_of_node(tree.size(), -1);
+			std::vector<int32_t> node_of_state;
+
+			for (size_t node = 0; node < tree.size(); node++)
+			{
+				if (tree[node].symbol < 0)
 				{
-					node = node->GetRight(true);
+					state_of_node[node] = node_of_state.size();
+					node_of_state.push_back(node);
 				}
 			}
 
-			node->SetValue(symbol);
-		}
+			OV_ASSERT2(node_of_state.size() == 256);
 
-		void HuffmanCodec::BuildMap(uint32_t code, uint8_t length, uint16_t symbol)
-		{
-			_map[symbol] = std::make_pair(code, length);
-		}
+			// Nodes that can be reached by the padding (up to 7 bits of 1 from the root)
+			std::vector<bool> accepted(tree.size(), false);
+			for (int32_t node = 0, depth = 0; (node >= 0) && (depth <= 7); node = tree[node].children[1], depth++)
+			{
+				accepted[node] = true;
+			}
 
-		// Build Tree and Map
-		void HuffmanCodec::Build(uint32_t code, uint8_t length, uint16_t symbol)
-		{
-			BuildMap(code, length, symbol);
-			BuildTree(code, length, symbol);
+			for (size_t state = 0; state < node_of_state.size(); state++)
+			{
+				for (uint8_t bits = 0; bits < 16; bits++)
+				{
+					auto &entry = _decoding_table[state][bits];
+					int32_t node = node_of_state[state];
+
+					for (int bit_index = 3; bit_index >= 0; bit_index--)
+					{
+						node = tree[node].children[(bits >> bit_index) & 0x1];
+
+						if (tree[node].symbol == HPACK_HUFFMAN_EOS)
+						{
+							entry.flags |= DecodingFlag::Failed;
+							node = 0;
+							break;
+						}
+
+						if (tree[node].symbol >= 0)
+						{
+							entry.flags |= DecodingFlag::Symbol;
+							entry.symbol = static_cast<uint8_t>(tree[node].symbol);
+							node = 0;
+						}
+					}
+
+					entry.next_state = state_of_node[node];
+
+					if (accepted[node])
+					{
+						entry.flags |= DecodingFlag::Accepted;
+					}
+				}
+			}
 		}
 	} // namespace hpack
-} // namespace http
\ No newline at end of file
+} // namespace http
@@ -10,6 +10,10 @@
 
 #include <base/ovlibrary/ovlibrary.h>
 
+// Number of symbols including EOS
+#define HPACK_HUFFMAN_SYMBOL_COUNT 257
+#define HPACK_HUFFMAN_EOS 256
+
 namespace http
 {
 	// https://www.rfc-editor.org/rfc/rfc7541.html
@@ -20,65 +24,44 @@ namespace http
 		public:
 			HuffmanCodec();
 			std::shared_ptr<ov::Data> Encode(const ov::String &str);
+			// Returns the length of <str> after encoding
+			size_t GetEncodedLength(const ov::String &str) const;
 			bool Decode(const std::shared_ptr<const ov::Data> &data, ov::String &str);
-			
-		private:
-			// Build Tree and Map
-			void Build(uint32_t code, uint8_t length, uint16_t symbol);
-			// Build Map for encoding from symbol to code
-			void BuildMap(uint32_t code, uint8_t length, uint16_t symbol);
-			// Build Tree for decoding from code to symbol
-			void BuildTree(uint32_t code, uint8_t length, uint16_t symbol);
 
-			class Node
+		private:
+			struct Code
 			{
-			public:
-				Node* GetLeft(bool create = false)
-				{
-					if (_left == nullptr && create == true)
-					{
-						_left = new Node();
-					}
-
-					return _left;
-				}
-
-				Node* GetRight(bool create = false)
-				{
-					if (_right == nullptr && create == true)
-					{
-						_right = new Node();
-					}
-
-					return _right;
-				}
+				uint32_t code = 0;
+				uint8_t length = 0;
+			};
 
-				void SetValue(uint16_t value)
-				{
-					_value = value;
-					_is_leaf = true;
-				}
-				
-				uint16_t GetValue()
-				{
-					return _value;
-				}
+			// Decoding is done with a state machine that consumes 4 bits at a time, instead of walking a tree bit by bit.
+			// The states are the internal nodes of the Huffman tree (256 nodes for 257 symbols), and the shortest code is
+			// 5 bits long, so a transition emits at most one symbol.
+			enum DecodingFlag : uint8_t
+			{
+				// The transition emits <symbol>
+				Symbol = 0x01,
+				// The bits consumed from the last symbol can be the padding (the MSBs of EOS, up to 7 bits)
+				Accepted = 0x02,
+				// The transition decodes EOS
+				Failed = 0x04,
+			};
 
-				bool IsLeaf()
-				{
-					return _is_leaf;
-				}
-				
-			private:
-				Node* _left = nullptr;
-				Node* _right = nullptr;
-				uint16_t _value = 0;
-				bool _is_leaf = false;
+			struct DecodingEntry
+			{
+				uint8_t next_state = 0;
+				uint8_t flags = 0;
+				uint8_t symbol = 0;
 			};
 
-			// 
-			Node* _tree = new Node();
-			std::unordered_map<uint8_t, std::pair<uint32_t, uint8_t>> _map;
+			void Build(uint32_t code, uint8_t length, uint16_t symbol);
+			// Build the decoding state machine from the codes
+			void BuildDecodingTable();
+
+			Code _codes[HPACK_HUFFMAN_SYMBOL_COUNT];
+			// [state][4 bits]
+			DecodingEntry _decoding_table[256][16];
 		};
 	}
-}
\ No newline at end of file
+}
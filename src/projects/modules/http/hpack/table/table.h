@@ -76,7 +76,7 @@ namespace http
 			{
 				// If name/value pair is matched in the table, return the index number.
 				auto it = _header_field_sequence_map.find(header_field.GetKey().CStr());
-				if (it != _header_field_sequence_map.end())
+				if (it != _header_field_sequence_map.end() && IsAlive(it->second))
 				{
 					// Found {name, value} in static table
 					auto sequence_number = it->second;
@@ -87,7 +87,7 @@ namespace http
 
 				// Else if only name is matched in the table, return the index number.
 				it = _header_field_name_sequence_map.find(header_field.GetName().CStr());
-				if (it != _header_field_name_sequence_map.end())
+				if (it != _header_field_name_sequence_map.end() && IsAlive(it->second))
 				{
 					// Found {name, value} in table
 					auto sequence_number = it->second;
@@ -131,6 +131,13 @@ namespace http
 				return _header_fields_table.size();
 			}
 
+			// Increased whenever an entry is inserted or evicted,
+			// the indexes of the table are the same while this value is the same
+			uint64_t GetModificationCount() const
+			{
+				return static_cast<uint64_t>(_append_sequence) + _removed_count;
+			}
+
 			size_t PopHeaderField()
 			{
 				if (_header_fields_table.empty())
@@ -161,6 +168,12 @@ namespace http
 
 			virtual uint32_t CalcIndexNumber(uint32_t sequence, uint32_t table_size, uint32_t removed_item_count) = 0;
 
+			// Entries are evicted from the oldest, so an entry is evicted if its sequence is not greater than the removed count
+			bool IsAlive(uint32_t sequence) const
+			{
+				return sequence > _removed_count;
+			}
+
 			bool FreeUpSpace(size_t new_entry_size)
 			{
 				while (_table_usage + new_entry_size > _table_size)
@@ -73,5 +73,11 @@ namespace http
 			std::lock_guard<std::mutex> lock(_dynamic_table_lock);
 			return _dynamic_table->GetTableSize();
 		}
+
+		uint64_t TableConnector::GetDynamicTableModificationCount()
+		{
+			std::lock_guard<std::mutex> lock(_dynamic_table_lock);
+			return _dynamic_table->GetModificationCount();
+		}
 	}
 }
\ No newline at end of file
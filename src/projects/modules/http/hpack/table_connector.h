@@ -25,6 +25,7 @@ namespace http
 			std::tuple<bool, bool, uint32_t> LookupIndex(const HeaderField &header_field);
 			bool UpdateDynamicTableSize(size_t size);
 			size_t GetDynamicTableSize();
+			uint64_t GetDynamicTableModificationCount();
 			
 		private:
 			// StaticTable is singleton instance
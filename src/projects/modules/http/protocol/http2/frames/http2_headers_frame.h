@@ -79,6 +79,27 @@ namespace http
 					return _header_block_fragment;
 				}
 
+				// Priority (valid if the Priority flag is set)
+				bool HasPriority() const
+				{
+					return CHECK_HTTP2_FRAME_FLAG(Flags::Priority);
+				}
+
+				bool IsExclusive() const
+				{
+					return _is_exclusive;
+				}
+
+				uint32_t GetStreamDependency() const
+				{
+					return _stream_dependency;
+				}
+
+				uint8_t GetWeight() const
+				{
+					return _weight;
+				}
+
 				// To String
 				ov::String ToString() const override
 				{
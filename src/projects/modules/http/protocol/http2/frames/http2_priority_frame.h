@@ -41,6 +41,22 @@ namespace http
 					_weight = weight;
 				}
 
+				// Getters
+				bool IsExclusive() const
+				{
+					return _is_exclusive;
+				}
+
+				uint32_t GetStreamDependency() const
+				{
+					return _stream_dependency;
+				}
+
+				uint8_t GetWeight() const
+				{
+					return _weight;
+				}
+
 				// To String
 				ov::String ToString() const override
 				{
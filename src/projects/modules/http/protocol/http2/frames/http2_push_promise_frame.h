@@ -18,13 +18,20 @@ namespace http
 	{
 		namespace h2
 		{
-            // Not yet implemented
 			class Http2PushPromiseFrame : public Http2Frame
 			{
 			public:
+				enum class Flags : uint8_t
+				{
+					None = 0x00,
+					EndHeaders = 0x04,
+					Padded = 0x08,
+				};
+
 				// Make by itself
-				Http2PushPromiseFrame()
-					: Http2Frame(0)
+				// <stream_id> is the stream the promise is associated with (the stream of the request that triggered the push)
+				Http2PushPromiseFrame(uint32_t stream_id)
+					: Http2Frame(stream_id)
 				{
 					SetType(Http2Frame::Type::PushPromise);
 				}
@@ -34,6 +41,34 @@ namespace http
 				{
 				}
 
+				// Setters
+				void SetEndHeaders()
+				{
+					TURN_ON_HTTP2_FRAME_FLAG(Flags::EndHeaders);
+				}
+
+				void SetPromisedStreamId(uint32_t promised_stream_id)
+				{
+					_promised_stream_id = promised_stream_id & 0x7FFFFFFF;
+				}
+
+				// Set Header Block Fragment
+				void SetHeaderBlockFragment(const std::shared_ptr<const ov::Data> &data)
+				{
+					_header_block_fragment = data;
+				}
+
+				// Getters
+				uint32_t GetPromisedStreamId() const
+				{
+					return _promised_stream_id;
+				}
+
+				const std::shared_ptr<const ov::Data> &GetHeaderBlockFragment() const
+				{
+					return _header_block_fragment;
+				}
+
 				// To String
 				ov::String ToString() const override
 				{
@@ -44,7 +79,11 @@ namespace http
 					str += "\n";
 					str += "[PUSH_PROMISE Frame]\n";
 
-					str += ov::String::FormatString("Not yet implemented\n");
+					str += ov::String::FormatString("Promised Stream ID : %u\n", _promised_stream_id);
+					str += ov::String::FormatString("Header Block Fragment Length : %d\n", (_header_block_fragment != nullptr) ? _header_block_fragment->GetLength() : 0);
+					str += ov::String::FormatString("Flags : EndHeader(%s) Padded(%s)\n",
+					ov::Converter::ToString(CHECK_HTTP2_FRAME_FLAG(Flags::EndHeaders)).CStr(),
+					ov::Converter::ToString(CHECK_HTTP2_FRAME_FLAG(Flags::Padded)).CStr());
 
 					return str;
 				}
@@ -57,22 +96,32 @@ namespace http
 						return Http2Frame::GetPayload();
 					}
 
-					return nullptr;
-				}
+					auto payload = std::make_shared<ov::Data>();
+					ov::ByteStream stream(payload.get());
 
-			private:
-				bool ParsePayload() override
-				{
-					if (GetType() != Http2Frame::Type::PushPromise)
+					// R bit is reserved
+					stream.WriteBE32(_promised_stream_id & 0x7FFFFFFF);
+
+					if (_header_block_fragment != nullptr)
 					{
-						return false;
+						payload->Append(_header_block_fragment);
 					}
 
-					SetParsingState(ParsingState::Error);
+					return payload;
+				}
 
-					return true;
+			private:
+				bool ParsePayload() override
+				{
+					// https://www.rfc-editor.org/rfc/rfc7540#section-8.2
+					// A client cannot push. A PUSH_PROMISE received by the server is a connection error of type PROTOCOL_ERROR,
+					// so the frame is only made by the server and never parsed.
+					return false;
 				}
+
+				uint32_t _promised_stream_id = 0;
+				std::shared_ptr<const ov::Data> _header_block_fragment = nullptr;
 			};
 		}
 	}
-}
\ No newline at end of file
+}
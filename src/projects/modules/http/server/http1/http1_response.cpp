@@ -102,6 +102,32 @@ namespace http
 				return -1;
 			}
 
+			bool Http1Response::IsFileRegionSendable()
+			{
+				// The payload of HTTP/1.1 is sent as it is, unless it is chunked or encrypted in user space
+				auto tls_data = GetTlsData();
+
+				return ((tls_data == nullptr) || tls_data->IsKtlsSendEnabled()) && (_chunked_transfer == false);
+			}
+
+			bool Http1Response::PrepareStreamingPayload()
+			{
+				SetChunkedTransfer();
+				return true;
+			}
+
+			bool Http1Response::SendEndOfPayload()
+			{
+				if (GetMethod() == Method::Head)
+				{
+					// No payload
+					return true;
+				}
+
+				// Last chunk
+				return SendChunkedData(nullptr);
+			}
+
 			int32_t Http1Response::SendPayload()
 			{
 				bool sent = true;
@@ -109,34 +135,33 @@ namespace http
 				logtd("Trying to send datas...");
 
 				uint32_t sent_bytes = 0;
-				for (const auto &data : GetResponseDataList())
+				for (const auto &payload : GetResponsePayloadList())
 				{
-					if (_chunked_transfer)
+					if (payload.file_region != nullptr)
 					{
-						sent &= SendChunkedData(data);
-						if (sent == true)
+						if (_chunked_transfer)
 						{
-							sent_bytes += data->GetLength();
+							// Chunked transfer was set after the region was appended
+							auto data = payload.file_region->Read();
+							sent &= (data != nullptr) && SendChunkedData(data);
 						}
 						else
 						{
-							logte("Could not send chunked data : %d bytes", data->GetLength());
-							return -1;
+							sent &= SendFile(payload.file_region);
 						}
 					}
 					else
 					{
-						sent &= Send(data);
-						if (sent == true)
-						{
-							sent_bytes += data->GetLength();
-						}
-						else
-						{
-							logte("Could not send data : %d bytes", data->GetLength());
-							return -1;
-						}
+						sent &= _chunked_transfer ? SendChunkedData(payload.data) : Send(payload.data);
 					}
+
+					if (sent == false)
+					{
+						logte("Could not send %s : %zu bytes", (payload.file_region != nullptr) ? "file" : "data", payload.GetLength());
+						return -1;
+					}
+
+					sent_bytes += payload.GetLength();
 				}
 
 				ResetResponseData();
@@ -33,6 +33,11 @@ namespace http
 				int32_t SendHeader() override;
 				int32_t SendPayload() override;
 
+				bool IsFileRegionSendable() override;
+
+				bool PrepareStreamingPayload() override;
+				bool SendEndOfPayload() override;
+
 				bool _chunked_transfer = false;
 			};
 		}
@@ -0,0 +1,479 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "http2_flow_controller.h"
+
+#include "../http_server_private.h"
+#include "http2_response.h"
+
+namespace http
+{
+	namespace svr
+	{
+		namespace h2
+		{
+			bool Http2FlowController::SetInitialWindowSize(uint32_t window_size)
+			{
+				if (window_size > HTTP2_MAX_WINDOW_SIZE)
+				{
+					logte("Invalid SETTINGS_INITIAL_WINDOW_SIZE: %u", window_size);
+					return false;
+				}
+
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+
+				// https://www.rfc-editor.org/rfc/rfc7540#section-6.9.2
+				// When the value of SETTINGS_INITIAL_WINDOW_SIZE changes, a receiver MUST adjust the size of all stream
+				// flow-control windows that it maintains by the difference between the new value and the old value.
+				// (The window may become negative)
+				auto delta = static_cast<int64_t>(window_size) - _initial_window_size;
+				_initial_window_size = window_size;
+
+				for (auto &[stream_id, stream] : _stream_map)
+				{
+					stream.window_size += delta;
+				}
+
+				return (delta > 0) ? Flush() : true;
+			}
+
+			void Http2FlowController::SetPushEnabled(bool enabled)
+			{
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+				_push_enabled = enabled;
+			}
+
+			bool Http2FlowController::IsPushEnabled() const
+			{
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+				return _push_enabled;
+			}
+
+			void Http2FlowController::SetMaxConcurrentStreams(uint32_t max_concurrent_streams)
+			{
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+				_max_concurrent_streams = max_concurrent_streams;
+			}
+
+			void Http2FlowController::OpenStream(uint32_t stream_id)
+			{
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+				GetOrCreateStream(stream_id);
+			}
+
+			void Http2FlowController::ReleaseStream(uint32_t stream_id)
+			{
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+
+				auto stream_it = _stream_map.find(stream_id);
+				if (stream_it == _stream_map.end())
+				{
+					return;
+				}
+
+				stream_it->second.released = true;
+				RemoveStreamIfDone(stream_id);
+			}
+
+			void Http2FlowController::ResetStream(uint32_t stream_id)
+			{
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+
+				RemoveStream(stream_id);
+			}
+
+			void Http2FlowController::Clear()
+			{
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+				_stream_map.clear();
+				_pending_bytes = 0;
+			}
+
+			uint32_t Http2FlowController::OpenPushStream(uint32_t associated_stream_id)
+			{
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+
+				if (_push_enabled == false)
+				{
+					return 0;
+				}
+
+				// https://www.rfc-editor.org/rfc/rfc7540#section-5.1.2
+				// SETTINGS_MAX_CONCURRENT_STREAMS of the peer limits the streams that the server initiates
+				uint32_t pushed_streams = 0;
+				for (const auto &[id, stream] : _stream_map)
+				{
+					if (stream.pushed == true)
+					{
+						pushed_streams++;
+					}
+				}
+
+				if (pushed_streams >= _max_concurrent_streams)
+				{
+					return 0;
+				}
+
+				// Server-initiated streams are even-numbered
+				if (_next_push_stream_id > HTTP2_MAX_WINDOW_SIZE)
+				{
+					return 0;
+				}
+
+				auto stream_id = _next_push_stream_id;
+				_next_push_stream_id += 2;
+
+				auto &stream = GetOrCreateStream(stream_id);
+				stream.pushed = true;
+
+				// https://www.rfc-editor.org/rfc/rfc7540#section-5.3.5
+				// Pushed streams initially depend on their associated stream
+				SetDependency(stream_id, associated_stream_id, false);
+
+				return stream_id;
+			}
+
+			void Http2FlowController::SetPriority(uint32_t stream_id, uint32_t stream_dependency, uint8_t weight, bool exclusive)
+			{
+				if (stream_id == 0 || stream_id == stream_dependency)
+				{
+					// A stream cannot depend on itself
+					return;
+				}
+
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+
+				if ((_stream_map.find(stream_id) == _stream_map.end()) && (_stream_map.size() >= HTTP2_MAX_PRIORITIZED_STREAMS))
+				{
+					return;
+				}
+
+				auto &stream = GetOrCreateStream(stream_id);
+				stream.weight = static_cast<uint32_t>(weight) + 1;
+
+				SetDependency(stream_id, stream_dependency, exclusive);
+			}
+
+			bool Http2FlowController::OnWindowUpdate(uint32_t stream_id, uint32_t window_size_increment)
+			{
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+
+				if (stream_id == 0)
+				{
+					if (_connection_window_size + window_size_increment > HTTP2_MAX_WINDOW_SIZE)
+					{
+						logte("Connection flow-control window overflows: %lld + %u", _connection_window_size, window_size_increment);
+						return false;
+					}
+
+					_connection_window_size += window_size_increment;
+				}
+				else
+				{
+					auto stream_it = _stream_map.find(stream_id);
+					if (stream_it == _stream_map.end())
+					{
+						// The stream is already closed
+						return true;
+					}
+
+					auto &stream = stream_it->second;
+					if (stream.window_size + window_size_increment > HTTP2_MAX_WINDOW_SIZE)
+					{
+						logte("Stream(%u) flow-control window overflows: %lld + %u", stream_id, stream.window_size, window_size_increment);
+						return false;
+					}
+
+					stream.window_size += window_size_increment;
+				}
+
+				return Flush();
+			}
+
+			bool Http2FlowController::SendData(const std::shared_ptr<Http2Response> &response, uint32_t stream_id, const std::shared_ptr<const ov::Data> &data, bool end_stream)
+			{
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+
+				// Streams are opened by OpenStream() and OpenPushStream(), so a missing one has been reset by the client
+				auto stream_it = _stream_map.find(stream_id);
+				if ((stream_it == _stream_map.end()) || response->IsStreamReset())
+				{
+					logtd("Stream(%u) has been reset, DATA frame is dropped", stream_id);
+					return false;
+				}
+
+				if ((_pending_bytes + data->GetLength()) > HTTP2_MAX_PENDING_BYTES)
+				{
+					logtw("Too many DATA frames are waiting for the flow-control windows (%zu bytes), stream(%u) is dropped", _pending_bytes, stream_id);
+					RemoveStream(stream_id);
+					return false;
+				}
+
+				auto &stream = stream_it->second;
+
+				if (stream.pending_data_list.empty())
+				{
+					// The stream starts competing for the connection from now
+					stream.virtual_finish_time = std::max(stream.virtual_finish_time, _virtual_time);
+				}
+
+				if (_pending_bytes == 0)
+				{
+					_last_progress_time_ms = ov::Clock::NowMSec();
+				}
+
+				stream.pending_data_list.push_back({response, data, end_stream});
+				_pending_bytes += data->GetLength();
+
+				return Flush(stream_id);
+			}
+
+			bool Http2FlowController::IsStalled() const
+			{
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+
+				return (_pending_bytes > 0) && ((ov::Clock::NowMSec() - _last_progress_time_ms) > HTTP2_FLOW_CONTROL_STALL_TIMEOUT);
+			}
+
+			ov::String Http2FlowController::ToString() const
+			{
+				std::lock_guard<decltype(_mutex)> lock(_mutex);
+
+				return ov::String::FormatString("<Http2FlowController: %p, window: %lld, initial window: %lld, streams: %zu, pending: %zu bytes>",
+												this, _connection_window_size, _initial_window_size, _stream_map.size(), _pending_bytes);
+			}
+
+			Http2FlowController::Stream &Http2FlowController::GetOrCreateStream(uint32_t stream_id)
+			{
+				auto stream_it = _stream_map.find(stream_id);
+				if (stream_it != _stream_map.end())
+				{
+					return stream_it->second;
+				}
+
+				auto &stream = _stream_map[stream_id];
+				stream.window_size = _initial_window_size;
+				stream.virtual_finish_time = _virtual_time;
+
+				return stream;
+			}
+
+			void Http2FlowController::RemoveStreamIfDone(uint32_t stream_id)
+			{
+				auto stream_it = _stream_map.find(stream_id);
+				if (stream_it == _stream_map.end())
+				{
+					return;
+				}
+
+				auto &stream = stream_it->second;
+				if (stream.released == false || stream.pending_data_list.empty() == false)
+				{
+					return;
+				}
+
+				RemoveStream(stream_id);
+			}
+
+			void Http2FlowController::RemoveStream(uint32_t stream_id)
+			{
+				auto stream_it = _stream_map.find(stream_id);
+				if (stream_it == _stream_map.end())
+				{
+					return;
+				}
+
+				auto &stream = stream_it->second;
+
+				for (const auto &pending_data : stream.pending_data_list)
+				{
+					_pending_bytes -= pending_data.data->GetLength();
+				}
+
+				// Keep the dependency tree of the other streams
+				auto stream_dependency = stream.stream_dependency;
+				for (auto &[id, other] : _stream_map)
+				{
+					if (other.stream_dependency == stream_id)
+					{
+						other.stream_dependency = stream_dependency;
+					}
+				}
+
+				_stream_map.erase(stream_it);
+			}
+
+			void Http2FlowController::SetDependency(uint32_t stream_id, uint32_t stream_dependency, bool exclusive)
+			{
+				auto &stream = _stream_map[stream_id];
+				auto old_dependency = stream.stream_dependency;
+
+				// https://www.rfc-editor.org/rfc/rfc7540#section-5.3.3
+				// If a stream is made dependent on one of its own dependencies, the formerly dependent stream is
+				// first moved to be dependent on the reprioritized stream's previous parent.
+				auto ancestor_id = stream_dependency;
+				for (size_t depth = 0; (ancestor_id != 0) && (depth < _stream_map.size()); depth++)
+				{
+					auto ancestor_it = _stream_map.find(ancestor_id);
+					if (ancestor_it == _stream_map.end())
+					{
+						break;
+					}
+
+					if (ancestor_it->second.stream_dependency == stream_id)
+					{
+						ancestor_it->second.stream_dependency = old_dependency;
+						break;
+					}
+
+					ancestor_id = ancestor_it->second.stream_dependency;
+				}
+
+				if (exclusive)
+				{
+					// The stream becomes the sole dependency of its parent, the other dependencies become dependent on the stream
+					for (auto &[id, other] : _stream_map)
+					{
+						if ((id != stream_id) && (other.stream_dependency == stream_dependency))
+						{
+							other.stream_dependency = stream_id;
+						}
+					}
+				}
+
+				stream.stream_dependency = stream_dependency;
+			}
+
+			bool Http2FlowController::IsSendable(const Stream &stream) const
+			{
+				if (stream.pending_data_list.empty())
+				{
+					return false;
+				}
+
+				// Empty DATA frames (END_STREAM) are not subject to flow control
+				if (stream.pending_data_list.front().data->IsEmpty())
+				{
+					return true;
+				}
+
+				return (stream.window_size > 0) && (_connection_window_size > 0);
+			}
+
+			bool Http2FlowController::IsBlockedByDependency(const Stream &stream) const
+			{
+				auto ancestor_id = stream.stream_dependency;
+
+				for (size_t depth = 0; (ancestor_id != 0) && (depth < _stream_map.size()); depth++)
+				{
+					auto ancestor_it = _stream_map.find(ancestor_id);
+					if (ancestor_it == _stream_map.end())
+					{
+						break;
+					}
+
+					// https://www.rfc-editor.org/rfc/rfc7540#section-5.3.1
+					// A dependent stream SHOULD only be allocated resources if all of the streams that it depends on are closed
+					// or it is not possible to make progress on them.
+					if (IsSendable(ancestor_it->second))
+					{
+						return true;
+					}
+
+					ancestor_id = ancestor_it->second.stream_dependency;
+				}
+
+				return false;
+			}
+
+			bool Http2FlowController::Flush(uint32_t stream_id)
+			{
+				bool result = true;
+
+				while (true)
+				{
+					// Select the stream that finishes first in the weighted fair queue
+					uint32_t selected_stream_id = 0;
+					Stream *selected_stream = nullptr;
+
+					for (auto &[stream_id, stream] : _stream_map)
+					{
+						if ((IsSendable(stream) == false) || IsBlockedByDependency(stream))
+						{
+							continue;
+						}
+
+						if ((selected_stream == nullptr) || (stream.virtual_finish_time < selected_stream->virtual_finish_time))
+						{
+							selected_stream_id = stream_id;
+							selected_stream = &stream;
+						}
+					}
+
+					if (selected_stream == nullptr)
+					{
+						break;
+					}
+
+					auto pending_data = std::move(selected_stream->pending_data_list.front());
+					selected_stream->pending_data_list.pop_front();
+
+					auto response = pending_data.response;
+					auto data = pending_data.data;
+					auto end_stream = pending_data.end_stream;
+					auto length = static_cast<int64_t>(data->GetLength());
+					auto sendable_length = std::min({length, selected_stream->window_size, _connection_window_size});
+
+					if (sendable_length < length)
+					{
+						// Send as much as the windows allow, the rest is sent after WINDOW_UPDATE
+						pending_data.data = data->Subdata(sendable_length);
+						selected_stream->pending_data_list.push_front(std::move(pending_data));
+
+						data = data->Subdata(0, sendable_length);
+						end_stream = false;
+					}
+
+					selected_stream->window_size -= data->GetLength();
+					_connection_window_size -= data->GetLength();
+					_pending_bytes -= data->GetLength();
+
+					_virtual_time = selected_stream->virtual_finish_time;
+					selected_stream->virtual_finish_time += (data->GetLength() * HTTP2_DEFAULT_WEIGHT) / selected_stream->weight;
+
+					RemoveStreamIfDone(selected_stream_id);
+
+					auto frame = std::make_shared<prot::h2::Http2DataFrame>(selected_stream_id);
+					frame->SetData(data);
+					if (end_stream)
+					{
+						frame->SetEndStream();
+					}
+
+					if (response->Send(frame) == false)
+					{
+						logtd("Failed to send DATA frame of stream(%u), the queued frames of the stream are discarded", selected_stream_id);
+
+						// Usually the stream has been reset, the other streams are still sent
+						RemoveStream(selected_stream_id);
+
+						if (selected_stream_id == stream_id)
+						{
+							result = false;
+						}
+
+						continue;
+					}
+
+					_last_progress_time_ms = ov::Clock::NowMSec();
+				}
+
+				return result;
+			}
+		}  // namespace h2
+	}  // namespace svr
+}  // namespace http
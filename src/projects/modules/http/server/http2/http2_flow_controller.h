@@ -0,0 +1,147 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <deque>
+#include <map>
+#include <mutex>
+
+// https://www.rfc-editor.org/rfc/rfc7540#section-6.9.2
+#define HTTP2_DEFAULT_WINDOW_SIZE 65535
+#define HTTP2_MAX_WINDOW_SIZE 0x7FFFFFFF
+// https://www.rfc-editor.org/rfc/rfc7540#section-5.3.5
+#define HTTP2_DEFAULT_WEIGHT 16
+// Limits the number of streams whose priority is kept (PRIORITY frames may refer to idle streams)
+#define HTTP2_MAX_PRIORITIZED_STREAMS 1024
+// Limits the bytes of DATA frames of a connection waiting for the flow-control windows
+#define HTTP2_MAX_PENDING_BYTES (16 * 1024 * 1024)
+// Queued DATA frames that cannot be sent for this time (milliseconds) stall the connection, see IsStalled()
+#define HTTP2_FLOW_CONTROL_STALL_TIMEOUT (10 * 1000)
+
+namespace http
+{
+	namespace svr
+	{
+		namespace h2
+		{
+			class Http2Response;
+
+			// Sends DATA frames of a connection within the flow-control windows of the peer
+			//
+			// DATA frames that do not fit in the windows are queued, and are sent when WINDOW_UPDATE is received.
+			// When several streams have queued frames, they are scheduled by the priority of the streams
+			// (a stream is sent after the stream it depends on, and siblings share the connection by their weights).
+			class Http2FlowController
+			{
+			public:
+				/////////////////////////////////////
+				// Settings of the peer
+				/////////////////////////////////////
+
+				// Returns false if <window_size> exceeds the maximum window size (FLOW_CONTROL_ERROR)
+				bool SetInitialWindowSize(uint32_t window_size);
+				void SetPushEnabled(bool enabled);
+				bool IsPushEnabled() const;
+				void SetMaxConcurrentStreams(uint32_t max_concurrent_streams);
+
+				/////////////////////////////////////
+				// Streams
+				/////////////////////////////////////
+
+				void OpenStream(uint32_t stream_id);
+				// The response of the stream is completed, the stream is removed when its queued frames are sent
+				void ReleaseStream(uint32_t stream_id);
+				// RST_STREAM, queued frames of the stream are discarded
+				void ResetStream(uint32_t stream_id);
+				// Connection closed
+				void Clear();
+
+				// Returns the stream ID for a new pushed stream, or 0 if the stream cannot be pushed
+				uint32_t OpenPushStream(uint32_t associated_stream_id);
+
+				// <weight> is the value of the frame (0~255), the actual weight is <weight> + 1
+				void SetPriority(uint32_t stream_id, uint32_t stream_dependency, uint8_t weight, bool exclusive);
+
+				// Returns false if the window overflows (FLOW_CONTROL_ERROR)
+				bool OnWindowUpdate(uint32_t stream_id, uint32_t window_size_increment);
+
+				// Sends <data> as DATA frames of <response>'s stream, queues it if the windows are not enough.
+				// Returns false if the stream has been reset, or the queue of the connection exceeds HTTP2_MAX_PENDING_BYTES
+				// (the queued frames of the stream are discarded).
+				bool SendData(const std::shared_ptr<Http2Response> &response, uint32_t stream_id, const std::shared_ptr<const ov::Data> &data, bool end_stream);
+
+				// Whether queued DATA frames have not been sent for HTTP2_FLOW_CONTROL_STALL_TIMEOUT
+				// (the peer doesn't open the windows)
+				bool IsStalled() const;
+
+				ov::String ToString() const;
+
+			private:
+				struct PendingData
+				{
+					std::shared_ptr<Http2Response> response;
+					std::shared_ptr<const ov::Data> data;
+					bool end_stream = false;
+				};
+
+				struct Stream
+				{
+					int64_t window_size = HTTP2_DEFAULT_WINDOW_SIZE;
+
+					uint32_t stream_dependency = 0;
+					uint32_t weight = HTTP2_DEFAULT_WEIGHT;
+
+					// Weighted fair queueing among the streams
+					uint64_t virtual_finish_time = 0;
+
+					std::deque<PendingData> pending_data_list;
+
+					bool pushed = false;
+					bool released = false;
+				};
+
+				Stream &GetOrCreateStream(uint32_t stream_id);
+				void RemoveStreamIfDone(uint32_t stream_id);
+				// Removes the stream with its queued frames, the streams depending on it depend on its parent
+				void RemoveStream(uint32_t stream_id);
+				void SetDependency(uint32_t stream_id, uint32_t stream_dependency, bool exclusive);
+
+				// Whether the stream has a frame that can be sent now
+				bool IsSendable(const Stream &stream) const;
+				// Whether the stream must wait for a stream it depends on
+				bool IsBlockedByDependency(const Stream &stream) const;
+
+				// Sends the queued frames as long as the windows allow.
+				// A stream whose frame cannot be sent (the stream is reset or the connection is closed) is removed,
+				// returns false if it is <stream_id>.
+				bool Flush(uint32_t stream_id = 0);
+
+				mutable std::recursive_mutex _mutex;
+
+				int64_t _connection_window_size = HTTP2_DEFAULT_WINDOW_SIZE;
+				int64_t _initial_window_size = HTTP2_DEFAULT_WINDOW_SIZE;
+
+				bool _push_enabled = true;
+				uint32_t _max_concurrent_streams = UINT32_MAX;
+				uint32_t _next_push_stream_id = 2;
+
+				uint64_t _virtual_time = 0;
+
+				// Bytes of the queued DATA frames
+				size_t _pending_bytes = 0;
+				// The last time a queued DATA frame is sent, or the queue becomes non-empty
+				uint64_t _last_progress_time_ms = 0;
+
+				// Stream ID : Stream
+				std::map<uint32_t, Stream> _stream_map;
+			};
+		}  // namespace h2
+	}  // namespace svr
+}  // namespace http
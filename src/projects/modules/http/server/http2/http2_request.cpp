@@ -23,6 +23,20 @@ namespace http
 				_hpack_decoder = hpack_decoder;
 			}
 
+			void Http2Request::SetHeaderFields(const std::vector<hpack::HeaderField> &header_fields)
+			{
+				_headers.clear();
+
+				for (const auto &header_field : header_fields)
+				{
+					_headers.emplace(header_field.GetName(), header_field.GetValue());
+				}
+
+				_parse_status = StatusCode::OK;
+
+				PostHeaderParsedProcess();
+			}
+
 			/////////////////////////////////////
 			// Implementation of HttpRequest
 			/////////////////////////////////////
@@ -24,7 +24,8 @@ namespace http
 				// Constructor
 				Http2Request(const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Decoder> &hpack_decoder);
 
-				
+				// Sets the header fields without decoding (the request that the server promised by PUSH_PROMISE)
+				void SetHeaderFields(const std::vector<hpack::HeaderField> &header_fields);
 
 				/////////////////////////////////////
 				// Implementation of HttpRequest
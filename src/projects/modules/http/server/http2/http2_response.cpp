@@ -16,15 +16,22 @@ namespace http
 		namespace h2
 		{
 			// Constructor
-			Http2Response::Http2Response(uint32_t stream_id, const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Encoder> &hpack_encoder)
+			Http2Response::Http2Response(uint32_t stream_id, const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Encoder> &hpack_encoder, const std::shared_ptr<Http2FlowController> &flow_controller)
 				: HttpResponse(client_socket)
 			{
 				_stream_id = stream_id;
 				_hpack_encoder = hpack_encoder;
+				_flow_controller = flow_controller;
 			}
 
 			bool Http2Response::Send(const std::shared_ptr<prot::h2::Http2Frame> &frame)
 			{
+				if (IsStreamReset())
+				{
+					logtd("Stream(%u) has been reset, the frame is not sent : %s", _stream_id, frame->ToString().CStr());
+					return false;
+				}
+
 				return HttpResponse::Send(frame->ToData());
 			}
 
@@ -33,38 +40,53 @@ namespace http
 				_keep_stream = keep_stream;
 			}
 			
+			void Http2Response::SetStreamReset()
+			{
+				_stream_reset = true;
+			}
+
+			bool Http2Response::IsStreamReset() const
+			{
+				return _stream_reset;
+			}
+
 			bool Http2Response::Send(const std::shared_ptr<prot::h2::Http2DataFrame> &data_frame, bool end_stream)
 			{
-				auto frame = std::make_shared<prot::h2::Http2DataFrame>(_stream_id);
-				frame->SetData(data_frame->GetData());
-				if (end_stream == true)
+				if (IsStreamReset())
 				{
-					frame->SetEndStream();
+					return false;
 				}
 
-				return Send(frame);
+				return _flow_controller->SendData(GetSharedPtrAs<Http2Response>(), _stream_id, data_frame->GetData(), end_stream);
 			}
 
 			int32_t Http2Response::SendHeader()
 			{
-				std::shared_ptr<ov::Data> header_block = std::make_shared<ov::Data>(65535);
 				size_t sent_size = 0;
+				std::vector<hpack::HeaderField> header_fields;
 
 				// :status header field is must on top
-				auto header_field = _hpack_encoder->Encode({":status", ov::Converter::ToString(static_cast<uint16_t>(GetStatusCode()))}, hpack::Encoder::EncodingType::LiteralWithIndexing);
-				header_block->Append(header_field);
+				header_fields.emplace_back(":status", ov::Converter::ToString(static_cast<uint16_t>(GetStatusCode())));
 
 				for (const auto &[name, values] : GetResponseHeaderList())
 				{
+					// https://httpwg.org/http2-spec/draft-ietf-httpbis-http2bis.html#section-8.2
+					// Field names MUST be converted to lowercase when constructing an HTTP/2 message.
+					auto lower_case_name = name.LowerCaseString();
+
 					for (const auto &value : values)
 					{
-						// https://httpwg.org/http2-spec/draft-ietf-httpbis-http2bis.html#section-8.2
-						// Field names MUST be converted to lowercase when constructing an HTTP/2 message.
-						auto header_field = _hpack_encoder->Encode({name.LowerCaseString(), value}, hpack::Encoder::EncodingType::LiteralWithIndexing);
-						header_block->Append(header_field);
+						header_fields.emplace_back(lower_case_name, value);
 					}
 				}
 
+				auto header_block = _hpack_encoder->EncodeHeaderBlock(header_fields);
+				if (header_block == nullptr)
+				{
+					logte("Failed to encode header block of stream(%u)", _stream_id);
+					return -1;
+				}
+
 				logtd("[Http2Response] Send header block : size(%u)", header_block->GetLength());
 
 				std::shared_ptr<ov::Data> head_block_fragment;
@@ -136,24 +158,57 @@ namespace http
 				return sent_size;
 			}
 
+			bool Http2Response::PrepareStreamingPayload()
+			{
+				// END_STREAM is sent by SendEndOfPayload()
+				SetKeepStream(true);
+				return true;
+			}
+
+			bool Http2Response::SendEndOfPayload()
+			{
+				if (IsStreamReset())
+				{
+					return false;
+				}
+
+				// An empty DATA frame with END_STREAM, it is sent after the queued frames of the stream
+				return _flow_controller->SendData(GetSharedPtrAs<Http2Response>(), _stream_id, std::make_shared<ov::Data>(), true);
+			}
+
 			int32_t Http2Response::SendPayload()
 			{
 				logtd("Trying to send datas...");
 
+				if (IsStreamReset())
+				{
+					ResetResponseData();
+					return -1;
+				}
+
 				uint32_t sent_bytes = 0;
+				auto self = GetSharedPtrAs<Http2Response>();
 
-				for (const auto &data : GetResponseDataList())
+				const auto &payload_list = GetResponsePayloadList();
+				for (const auto &payload : payload_list)
 				{
+					// File regions are read into memory since they are framed in user space
+					auto data = (payload.file_region != nullptr) ? payload.file_region->Read() : payload.data;
+					if (data == nullptr)
+					{
+						logte("Could not read file : %zu bytes", payload.GetLength());
+						ResetResponseData();
+						return -1;
+					}
+
 					size_t offset = 0;
 					auto data_fragment = data;
 					while (offset + MAX_HTTP2_DATA_SIZE < data->GetLength())
 					{
 						data_fragment = data->Subdata(offset, MAX_HTTP2_DATA_SIZE);
 
-						auto payload_frame = std::make_shared<prot::h2::Http2DataFrame>(_stream_id);
-						payload_frame->SetData(data_fragment);
-
-						if (Send(payload_frame) == false)
+						// The fragment is queued if the flow-control windows of the peer are not enough
+						if (_flow_controller->SendData(self, _stream_id, data_fragment, false) == false)
 						{
 							logte("Failed to send payload");
 							ResetResponseData();
@@ -164,17 +219,12 @@ namespace http
 					}
 
 					// Last fragment
-					auto payload_frame = std::make_shared<prot::h2::Http2DataFrame>(_stream_id);
 					data_fragment = data->Subdata(offset);
-					payload_frame->SetData(data_fragment);
 
 					// End Stream
-					if (_keep_stream == false && (&data == &GetResponseDataList().back()))
-					{
-						payload_frame->SetEndStream();
-					}
+					bool end_stream = (_keep_stream == false && (&payload == &payload_list.back()));
 
-					if (Send(payload_frame) == false)
+					if (_flow_controller->SendData(self, _stream_id, data_fragment, end_stream) == false)
 					{
 						logte("Failed to send payload");
 						ResetResponseData();
@@ -9,9 +9,12 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "../http_response.h"
 #include "../../protocol/http2/frames/http2_frames.h"
 #include "../../hpack/encoder.h"
+#include "http2_flow_controller.h"
 
 #define MAX_HTTP2_HEADER_SIZE (1024 * 1024)
 #define MAX_HTTP2_DATA_SIZE (16384)
@@ -26,14 +29,19 @@ namespace http
 			{
 			public:
 				// Constructor
-				Http2Response(uint32_t stream_id, const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Encoder> &hpack_encoder);
+				Http2Response(uint32_t stream_id, const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Encoder> &hpack_encoder, const std::shared_ptr<Http2FlowController> &flow_controller);
 
 				bool Send(const std::shared_ptr<prot::h2::Http2Frame> &frame);
 
 				// After Response(), EndStream flag is not sent.
 				void SetKeepStream(bool keep_stream);
+				// DATA frames are sent within the flow-control windows of the peer
 				bool Send(const std::shared_ptr<prot::h2::Http2DataFrame> &data_frame, bool end_stream);
 
+				// RST_STREAM is received, no more frames are sent on the stream
+				void SetStreamReset();
+				bool IsStreamReset() const;
+
 			protected:
 				using HttpResponse::Send;
 
@@ -41,9 +49,14 @@ namespace http
 				int32_t SendHeader() override;
 				int32_t SendPayload() override;
 
+				bool PrepareStreamingPayload() override;
+				bool SendEndOfPayload() override;
+
 				uint32_t _stream_id = 0;
 				bool _keep_stream = false;
+				std::atomic<bool> _stream_reset = false;
 				std::shared_ptr<hpack::Encoder> _hpack_encoder;
+				std::shared_ptr<Http2FlowController> _flow_controller;
 			};
 		}
 	}
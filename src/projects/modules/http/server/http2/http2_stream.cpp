@@ -24,7 +24,7 @@ namespace http
 				_request->SetConnectionType(ConnectionType::Http20);
 				_request->SetTlsData(GetConnection()->GetTlsData());
 
-				_response = std::make_shared<Http2Response>(stream_id, GetConnection()->GetSocket(), GetConnection()->GetHpackEncoder());
+				_response = std::make_shared<Http2Response>(stream_id, GetConnection()->GetSocket(), GetConnection()->GetHpackEncoder(), GetConnection()->GetHttp2FlowController());
 				_response->SetTlsData(GetConnection()->GetTlsData());
 				_response->SetHeader("server", "OvenMediaEngine");
 				_response->SetHeader("content-type", "text/html");
@@ -52,6 +52,58 @@ namespace http
 				return _stream_id;
 			}
 
+			std::shared_ptr<HttpExchange> HttpStream::Push(const ov::String &path)
+			{
+				auto connection = GetConnection();
+				auto flow_controller = connection->GetHttp2FlowController();
+
+				auto promised_stream_id = flow_controller->OpenPushStream(_stream_id);
+				if (promised_stream_id == 0)
+				{
+					// Disabled by SETTINGS_ENABLE_PUSH or SETTINGS_MAX_CONCURRENT_STREAMS
+					return nullptr;
+				}
+
+				// https://www.rfc-editor.org/rfc/rfc7540#section-8.2
+				// Promised requests MUST be cacheable and safe, and MUST NOT include a request body
+				std::vector<hpack::HeaderField> header_fields{
+					{":method", "GET"},
+					{":scheme", (connection->GetTlsData() != nullptr) ? "https" : "http"},
+					{":authority", _request->GetHost()},
+					{":path", path}};
+
+				auto header_block = connection->GetHpackEncoder()->EncodeHeaderBlock(header_fields);
+				if (header_block == nullptr)
+				{
+					flow_controller->ResetStream(promised_stream_id);
+					return nullptr;
+				}
+
+				auto push_promise_frame = std::make_shared<Http2PushPromiseFrame>(_stream_id);
+				push_promise_frame->SetPromisedStreamId(promised_stream_id);
+				push_promise_frame->SetHeaderBlockFragment(header_block);
+				push_promise_frame->SetEndHeaders();
+
+				if (_response->Send(push_promise_frame) == false)
+				{
+					flow_controller->ResetStream(promised_stream_id);
+					return nullptr;
+				}
+
+				logtd("Promised stream(%u) on stream(%u) : %s", promised_stream_id, _stream_id, path.CStr());
+
+				auto pushed_stream = std::make_shared<HttpStream>(connection, promised_stream_id);
+				pushed_stream->_request->SetHeaderFields(header_fields);
+				pushed_stream->_response->SetMethod(Method::Get);
+				pushed_stream->SetKeepAlive(true);
+				pushed_stream->SetStatus(Status::Moved);
+
+				// The client may reset the promised stream (RST_STREAM), the frames of the stream are delivered to it
+				connection->AddPushedStream(pushed_stream);
+
+				return pushed_stream;
+			}
+
 			bool HttpStream::OnEndHeaders()
 			{
 				// Header Completed
@@ -150,6 +202,22 @@ namespace http
 			{
 				std::shared_ptr<const Http2Frame> parsed_frame = frame;
 				bool result = false;
+
+				if (frame->GetStreamId() != _stream_id)
+				{
+					// Frames of the closed streams (or pushed streams) are delivered to the control stream
+					switch (frame->GetType())
+					{
+						case Http2Frame::Type::Priority:
+						case Http2Frame::Type::RstStream:
+						case Http2Frame::Type::WindowUpdate:
+							break;
+						default:
+							logtd("Ignore the frame of the closed stream : %s", frame->ToString().CStr());
+							return true;
+					}
+				}
+
 				switch (frame->GetType())
 				{
 					case Http2Frame::Type::Data:
@@ -184,8 +252,9 @@ namespace http
 					}
 					case Http2Frame::Type::PushPromise:
 					{
-						// No need to parse server side
-						break;
+						// Rejected by HttpConnection, a client cannot push
+						logte("PUSH_PROMISE received from the client : %s", frame->ToString().CStr());
+						return false;
 					}
 					case Http2Frame::Type::Ping:
 					{
@@ -232,6 +301,11 @@ namespace http
 				_header_block->Append(frame->GetHeaderBlockFragment());
 				_headers_frame = frame;
 
+				if (frame->HasPriority())
+				{
+					GetConnection()->GetHttp2FlowController()->SetPriority(_stream_id, frame->GetStreamDependency(), frame->GetWeight(), frame->IsExclusive());
+				}
+
 				if (frame->IS_HTTP2_FRAME_FLAG_ON(Http2HeadersFrame::Flags::EndHeaders))
 				{
 					return OnEndHeaders();
@@ -254,14 +328,25 @@ namespace http
 
 			bool HttpStream::OnPriorityFrameReceived(const std::shared_ptr<const Http2PriorityFrame> &frame)
 			{
-				// Nothing to do yet, just ignore
+				// Frames that are sent after this stream take the priority into account
+				GetConnection()->GetHttp2FlowController()->SetPriority(frame->GetStreamId(), frame->GetStreamDependency(), frame->GetWeight(), frame->IsExclusive());
 				return true;
 			}
 
 			bool HttpStream::OnRstStreamFrameReceived(const std::shared_ptr<const Http2RstStreamFrame> &frame)
 			{
 				logtd("%s", frame->ToString().CStr());
-				SetStatus(HttpExchange::Status::Error);
+
+				// Discard DATA frames waiting for the flow-control window
+				GetConnection()->GetHttp2FlowController()->ResetStream(frame->GetStreamId());
+
+				if (frame->GetStreamId() == _stream_id)
+				{
+					// The stream is closed, HEADERS/DATA must not be sent on it anymore
+					_response->SetStreamReset();
+					SetStatus(HttpExchange::Status::Error);
+				}
+
 				return true;
 			}
 
@@ -276,6 +361,26 @@ namespace http
 						auto hpack_encoder = GetConnection()->GetHpackEncoder();
 						hpack_encoder->UpdateDynamicTableSize(std::min(size, MAX_HEADER_TABLE_SIZE));
 					}
+
+					auto flow_controller = GetConnection()->GetHttp2FlowController();
+
+					std::tie(exist, size) = frame->GetParameter(Http2SettingsFrame::Parameters::InitialWindowSize);
+					if (exist && flow_controller->SetInitialWindowSize(size) == false)
+					{
+						return false;
+					}
+
+					std::tie(exist, size) = frame->GetParameter(Http2SettingsFrame::Parameters::EnablePush);
+					if (exist)
+					{
+						flow_controller->SetPushEnabled(size == 1);
+					}
+
+					std::tie(exist, size) = frame->GetParameter(Http2SettingsFrame::Parameters::MaxConcurrentStreams);
+					if (exist)
+					{
+						flow_controller->SetMaxConcurrentStreams(size);
+					}
 					
 					// Settings Frame
 					auto settings_frame = std::make_shared<Http2SettingsFrame>();
@@ -308,8 +413,8 @@ namespace http
 
 			bool HttpStream::OnWindowUpdateFrameReceived(const std::shared_ptr<const Http2WindowUpdateFrame> &frame)
 			{
-				// Nothing to do yet, just ignore
-				return true;
+				// Sends DATA frames waiting for the window
+				return GetConnection()->GetHttp2FlowController()->OnWindowUpdate(frame->GetStreamId(), frame->GetWindowSizeIncrement());
 			}
 
 			bool HttpStream::OnGoAwayFrameReceived(const std::shared_ptr<const Http2GoAwayFrame> &frame)
@@ -34,6 +34,10 @@ namespace http
 				std::shared_ptr<HttpRequest> GetRequest() const override;
 				std::shared_ptr<HttpResponse> GetResponse() const override;
 
+				// Implement HttpExchange
+				// Sends PUSH_PROMISE on this stream and returns the exchange of the promised stream
+				std::shared_ptr<HttpExchange> Push(const ov::String &path) override;
+
 				// Get Stream ID
 				uint32_t GetStreamId() const;
 				bool OnFrameReceived(const std::shared_ptr<Http2Frame> &frame);
@@ -100,6 +100,12 @@ namespace http
 						logti("Client(%s - %s) has timed out", StringFromConnectionType(_connection_type).CStr(), _client_socket->ToString().CStr());
 						Close(PhysicalPortDisconnectReason::Disconnect);
 					}
+					else if ((_http2_flow_controller != nullptr) && _http2_flow_controller->IsStalled())
+					{
+						// The client keeps the connection alive, but doesn't open the flow-control windows
+						logti("Client(%s - %s) has not opened the flow-control windows: %s", StringFromConnectionType(_connection_type).CStr(), _client_socket->ToString().CStr(), _http2_flow_controller->ToString().CStr());
+						Close(PhysicalPortDisconnectReason::Disconnect);
+					}
 					break;
 				case ConnectionType::WebSocket:
 					// In websocket, if Pong does not arrive for a certain period of time, timeout should be processed. (It takes a very long time to check disconnected by ping transmission because it can be mistaken for sending a ping to a dead client.)
@@ -125,6 +131,10 @@ namespace http
 					// Lock
 					std::unique_lock<std::mutex> lock(_http_stream_map_guard);
 					_http_stream_map.erase(http2_stream->GetStreamId());
+					lock.unlock();
+
+					// The stream is closed after the DATA frames waiting for the window are sent
+					_http2_flow_controller->ReleaseStream(http2_stream->GetStreamId());
 					break;
 				}
 				case ConnectionType::Http10:
@@ -199,6 +209,17 @@ namespace http
 			return _hpack_decoder;
 		}
 
+		std::shared_ptr<h2::Http2FlowController> HttpConnection::GetHttp2FlowController() const
+		{
+			return _http2_flow_controller;
+		}
+
+		void HttpConnection::AddPushedStream(const std::shared_ptr<h2::HttpStream> &stream)
+		{
+			std::unique_lock<std::mutex> lock(_http_stream_map_guard);
+			_http_stream_map.emplace(stream->GetStreamId(), stream);
+		}
+
 		// Find Interceptor
 		std::shared_ptr<RequestInterceptor> HttpConnection::FindInterceptor(const std::shared_ptr<HttpExchange> &exchange)
 		{
@@ -275,6 +296,12 @@ namespace http
 			_http_stream_map.clear();
 			map_guard.unlock();
 
+			if (_http2_flow_controller != nullptr)
+			{
+				// Releases the responses waiting for the flow-control window
+				_http2_flow_controller->Clear();
+			}
+
 			if (reason != PhysicalPortDisconnectReason::Disconnected)
 			{
 				_client_socket->Close();
@@ -473,6 +500,15 @@ namespace http
 			if (_http2_frame->GetParsingState() == Http2Frame::ParsingState::Completed)
 			{
 				logtd("HTTP/2 Frame Received : %s", _http2_frame->ToString().CStr());
+
+				if (_http2_frame->GetType() == Http2Frame::Type::PushPromise)
+				{
+					// https://www.rfc-editor.org/rfc/rfc7540#section-8.2
+					// A client cannot push, a PUSH_PROMISE is a connection error of type PROTOCOL_ERROR
+					logte("%s : PUSH_PROMISE received from the client", ToString().CStr());
+					Close(PhysicalPortDisconnectReason::Error);
+					return -1;
+				}
 				
 				// lock
 				std::unique_lock<std::mutex> lock(_http_stream_map_guard);
@@ -482,16 +518,30 @@ namespace http
 				{
 					stream = stream_it->second;
 				}
-				else
+				else if (_http2_frame->GetType() == Http2Frame::Type::Headers)
 				{
 					stream = std::make_shared<h2::HttpStream>(GetSharedPtr(), _http2_frame->GetStreamId());
 					_http_stream_map.emplace(_http2_frame->GetStreamId(), stream);
+					_http2_flow_controller->OpenStream(_http2_frame->GetStreamId());
 					logtd("%s : Streams [%u]", ToString().CStr(), _http_stream_map.size());
 				}
+				else
+				{
+					// Frames of the completed streams (WINDOW_UPDATE, RST_STREAM, PRIORITY, ...) are handled by the control stream
+					stream = _http_stream_map[0];
+				}
 				lock.unlock();
 
 				stream->OnFrameReceived(_http2_frame);
 
+				if ((_http2_frame->GetType() == Http2Frame::Type::RstStream) && (_http2_frame->GetStreamId() != 0))
+				{
+					// The stream is closed by the client, it does not receive frames anymore
+					lock.lock();
+					_http_stream_map.erase(_http2_frame->GetStreamId());
+					lock.unlock();
+				}
+
 				_http2_frame.reset();
 			}
 
@@ -504,6 +554,7 @@ namespace http
 
 			_hpack_encoder = std::make_shared<hpack::Encoder>();
 			_hpack_decoder = std::make_shared<hpack::Decoder>();
+			_http2_flow_controller = std::make_shared<h2::Http2FlowController>();
 
 			// Control Stream (stream id : 0) is always open
 			std::unique_lock<std::mutex> lock(_http_stream_map_guard);
@@ -63,6 +63,10 @@ namespace http
 			// Get HPACK Codec
 			std::shared_ptr<hpack::Encoder> GetHpackEncoder() const;
 			std::shared_ptr<hpack::Decoder> GetHpackDecoder() const;
+			// Get HTTP/2 flow controller
+			std::shared_ptr<h2::Http2FlowController> GetHttp2FlowController() const;
+			// Registers the stream promised by PUSH_PROMISE, so it receives the frames of the client (RST_STREAM, WINDOW_UPDATE, ...)
+			void AddPushedStream(const std::shared_ptr<h2::HttpStream> &stream);
 
 			// To string
 			virtual ov::String ToString() const;
@@ -122,6 +126,8 @@ namespace http
 			// HTTP/2 HPACK Codec
 			std::shared_ptr<hpack::Encoder> _hpack_encoder = nullptr;
 			std::shared_ptr<hpack::Decoder> _hpack_decoder = nullptr;
+			// HTTP/2 flow-control windows and priorities of the peer
+			std::shared_ptr<h2::Http2FlowController> _http2_flow_controller = nullptr;
 
 			///////////////////////
 			// For Websocket
@@ -24,7 +24,7 @@ namespace http
 
 		HttpExchange::HttpExchange(const std::shared_ptr<HttpExchange> &exchange)
 		{
-			_status = exchange->_status;
+			_status = exchange->_status.load();
 			_connection = exchange->_connection;
 			_extra = exchange->_extra;
 			_keep_alive = exchange->_keep_alive;
@@ -108,6 +108,12 @@ namespace http
 			return false;
 		}
 
+		std::shared_ptr<HttpExchange> HttpExchange::Push(const ov::String &path)
+		{
+			// Only HTTP/2 supports server push
+			return nullptr;
+		}
+
 		bool HttpExchange::IsWebSocketUpgradeRequest()
 		{
 			// RFC6455 - 4.2.1.  Reading the Client's Opening Handshake
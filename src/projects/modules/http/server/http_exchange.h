@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include <atomic>
 #include <mutex>
 
 #include "http_request.h"
@@ -83,6 +84,11 @@ namespace http
 			bool IsWebSocketUpgradeRequest();
 			bool IsHttp2UpgradeRequest();
 
+			// HTTP/2 server push
+			// Promises a GET request of <path> to the client, and returns the exchange to respond to it.
+			// Returns nullptr if the connection does not support server push (HTTP/1.x, or disabled by the client)
+			virtual std::shared_ptr<HttpExchange> Push(const ov::String &path);
+
 		protected:
 			bool AcceptWebSocketUpgrade();
 			void SetConnectionPolicyByRequest();
@@ -95,7 +101,8 @@ namespace http
 
 		private:
 			std::shared_ptr<HttpConnection> _connection = nullptr;
-			Status _status = Status::None;
+			// Set to Error by the connection thread when the client resets the HTTP/2 stream
+			std::atomic<Status> _status = Status::None;
 			bool _keep_alive = true; // HTTP/1.1 default
 			std::any _extra;
 			std::shared_ptr<RequestInterceptor> _interceptor = nullptr; // Cached interceptor
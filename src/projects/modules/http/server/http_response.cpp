@@ -41,8 +41,9 @@ namespace http
 			_status_code = http_response->_status_code;
 			_reason = http_response->_reason;
 			_is_header_sent = http_response->_is_header_sent;
+			_is_streaming_response = http_response->_is_streaming_response;
 			_response_header = http_response->_response_header;
-			_response_data_list = http_response->_response_data_list;
+			_response_payload_list = http_response->_response_payload_list;
 			_response_data_size = http_response->_response_data_size;
 			_default_value = http_response->_default_value;
 			_created_time = http_response->_created_time;
@@ -88,6 +89,12 @@ namespace http
 			return _if_none_match;
 		}
 
+		void HttpResponse::SetEtag(const ov::String &etag)
+		{
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+			_etag = etag;
+		}
+
 		StatusCode HttpResponse::GetStatusCode() const
 		{
 			return _status_code;
@@ -191,6 +198,11 @@ namespace http
 
 		ov::String HttpResponse::GetEtag()
 		{
+			if (_etag.IsEmpty() == false)
+			{
+				return _etag;
+			}
+
 			if (_response_hash == nullptr)
 			{
 				return "";
@@ -210,20 +222,54 @@ namespace http
 
 			auto cloned_data = data->Clone();
 
-			_response_data_list.push_back(cloned_data);
+			_response_payload_list.push_back({cloned_data, nullptr});
 			_response_data_size += cloned_data->GetLength();
 
-			if (_etag_enabled_by_config == false)
+			UpdateResponseHash(cloned_data);
+
+			return true;
+		}
+
+		bool HttpResponse::AppendFileRegion(const std::shared_ptr<const ov::FileRegion> &file_region)
+		{
+			if (file_region == nullptr)
+			{
+				return false;
+			}
+
+			if (IsFileRegionSendable() == false)
+			{
+				// Fallback - the region is sent in the same way as other data
+				return AppendData(file_region->Read());
+			}
+
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			_response_payload_list.push_back({nullptr, file_region});
+			_response_data_size += file_region->GetLength();
+
+			if (file_region->GetIdentity().IsEmpty() == false)
+			{
+				// Hash the identity of the region instead of reading the contents of the file
+				UpdateResponseHash(file_region->GetIdentity().ToData(false));
+			}
+
+			return true;
+		}
+
+		void HttpResponse::UpdateResponseHash(const std::shared_ptr<const ov::Data> &data)
+		{
+			if ((_etag_enabled_by_config == false) || (_etag.IsEmpty() == false))
 			{
-				return true;
+				return;
 			}
 
-			auto md5 = ov::MessageDigest::ComputeDigest(ov::CryptoAlgorithm::Md5, cloned_data);
+			auto md5 = ov::MessageDigest::ComputeDigest(ov::CryptoAlgorithm::Md5, data);
 			if (md5 == nullptr || md5->GetLength() != 16)
 			{
 				// Could not compute MD5
 				OV_ASSERT2(md5->GetLength() == 16);
-				return true;
+				return;
 			}
 
 			if (_response_hash == nullptr)
@@ -239,8 +285,6 @@ namespace http
 					ptr[i] ^= md5->At(i);
 				}
 			}
-
-			return true;
 		}
 
 		bool HttpResponse::AppendString(const ov::String &string)
@@ -250,8 +294,7 @@ namespace http
 
 		bool HttpResponse::AppendFile(const ov::String &filename)
 		{
-			OV_ASSERT(false, "Not implemented");
-			return false;
+			return AppendFileRegion(ov::FileRegion::Open(filename));
 		}
 
 		bool HttpResponse::IsHeaderSent() const
@@ -265,10 +308,10 @@ namespace http
 			return _response_data_size;
 		}
 
-		// Get Response Data List
-		const std::vector<std::shared_ptr<const ov::Data>> &HttpResponse::GetResponseDataList() const
+		// Get Response Payload List
+		const std::vector<HttpResponse::ResponsePayload> &HttpResponse::GetResponsePayloadList() const
 		{
-			return _response_data_list;
+			return _response_payload_list;
 		}
 
 		// Get Response Header
@@ -279,7 +322,7 @@ namespace http
 
 		void HttpResponse::ResetResponseData()
 		{
-			_response_data_list.clear();
+			_response_payload_list.clear();
 			_response_data_size = 0ULL;
 		}
 
@@ -315,7 +358,8 @@ namespace http
 				auto date = ov::Converter::ToRFC7231String(_response_time);
 				SetHeader("Date", date);
 
-				if (_etag_enabled_by_config == true)
+				// The payload of a streaming response is not known yet when the header is sent
+				if (((_etag_enabled_by_config == true) || (_etag.IsEmpty() == false)) && (_is_streaming_response == false))
 				{
 					// IF-NONE-MATCH check
 					auto if_none_match = GetIfNoneMatch();
@@ -328,7 +372,7 @@ namespace http
 						}
 					}
 
-					if (GetStatusCode() == StatusCode::OK || GetStatusCode() == StatusCode::NotModified)
+					if (GetStatusCode() == StatusCode::OK || GetStatusCode() == StatusCode::PartialContent || GetStatusCode() == StatusCode::NotModified)
 					{
 						auto etag_value = GetEtag();
 						if (etag_value.IsEmpty() == false)
@@ -371,11 +415,72 @@ namespace http
 			return sent_size;
 		}	
 
+		bool HttpResponse::StartStreamingResponse()
+		{
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			if (IsHeaderSent())
+			{
+				logtw("Cannot start streaming response: Header is sent: %s", _client_socket->ToString().CStr());
+				return false;
+			}
+
+			if (PrepareStreamingPayload() == false)
+			{
+				return false;
+			}
+
+			_is_streaming_response = true;
+
+			return true;
+		}
+
+		bool HttpResponse::IsStreamingResponse() const
+		{
+			return _is_streaming_response;
+		}
+
+		int32_t HttpResponse::EndStreamingResponse()
+		{
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			if (_is_streaming_response == false)
+			{
+				return -1;
+			}
+
+			auto sent_size = Response();
+			if (sent_size < 0)
+			{
+				return -1;
+			}
+
+			if (SendEndOfPayload() == false)
+			{
+				logte("Could not send the end of the payload: %s", _client_socket->ToString().CStr());
+				return -1;
+			}
+
+			_is_streaming_response = false;
+
+			return sent_size;
+		}
+
 		int32_t HttpResponse::SendHeader()
 		{
 			return -1;
 		}
 
+		bool HttpResponse::PrepareStreamingPayload()
+		{
+			return false;
+		}
+
+		bool HttpResponse::SendEndOfPayload()
+		{
+			return false;
+		}
+
 		int32_t HttpResponse::SendPayload()
 		{
 			return 0;
@@ -400,6 +505,13 @@ namespace http
 			{
 				send_data = data->Clone();
 			}
+			else if (_tls_data->IsKtlsSendEnabled())
+			{
+				// The kernel encrypts the data
+				std::lock_guard<std::mutex> lock(_tls_data->GetSequentialSendMutex());
+
+				return _client_socket->Send(data);
+			}
 			else
 			{
 				std::lock_guard<std::mutex> lock(_tls_data->GetSequentialSendMutex());
@@ -424,6 +536,39 @@ namespace http
 			return _client_socket->Send(send_data);
 		}
 
+		bool HttpResponse::SendFile(const std::shared_ptr<const ov::FileRegion> &file_region)
+		{
+			if (file_region == nullptr)
+			{
+				OV_ASSERT2(file_region != nullptr);
+				return false;
+			}
+
+			if (_tls_data == nullptr)
+			{
+				return _client_socket->SendFile(file_region);
+			}
+
+			if (_tls_data->IsKtlsSendEnabled())
+			{
+				// The kernel encrypts the region while sending it
+				std::lock_guard<std::mutex> lock(_tls_data->GetSequentialSendMutex());
+
+				return _client_socket->SendFile(file_region);
+			}
+
+			// The region must be encrypted in user space
+			auto data = file_region->Read();
+
+			return (data != nullptr) && Send(data);
+		}
+
+		bool HttpResponse::IsFileRegionSendable()
+		{
+			// Protocols that frame the payload (such as HTTP/2) cannot use sendfile()
+			return false;
+		}
+
 		bool HttpResponse::Close()
 		{
 			OV_ASSERT2(_client_socket != nullptr);
@@ -40,6 +40,10 @@ namespace http
 			void SetIfNoneMatch(const ov::String &etag);
 			const ov::String &GetIfNoneMatch() const;
 
+			// Strong validator of the payload given by the caller (e.g. a cached segment).
+			// The payload is not hashed and the ETag header is sent even if ETag is disabled by config
+			void SetEtag(const ov::String &etag);
+
 			// reason = default
 			void SetStatusCode(StatusCode status_code);
 			// custom reason
@@ -57,10 +61,22 @@ namespace http
 			// Can be used for response with content-length
 			bool AppendData(const std::shared_ptr<const ov::Data> &data);
 			bool AppendString(const ov::String &string);
+			// Enqueue a region of a file. It is sent using sendfile() if possible, otherwise it is read into memory.
+			// Data and file regions are sent in the order they are enqueued
+			bool AppendFileRegion(const std::shared_ptr<const ov::FileRegion> &file_region);
 			bool AppendFile(const ov::String &filename);
 
 			int32_t Response();
 
+			// Streaming response - the payload is sent progressively without Content-Length
+			// (HTTP/1.1: chunked transfer coding, HTTP/2: DATA frames without END_STREAM).
+			// Response() sends the data appended since the last call, and EndStreamingResponse() completes the payload.
+			// Returns false if the header is already sent or the protocol does not support it
+			bool StartStreamingResponse();
+			bool IsStreamingResponse() const;
+			// Sends the remaining data and the end of the payload, returns the number of bytes sent or -1
+			int32_t EndStreamingResponse();
+
 			// Get Created Time
 			std::chrono::system_clock::time_point GetCreatedTime() const;
 			// Get Response Time
@@ -75,10 +91,22 @@ namespace http
 			bool Close();
 
 		protected:
+			// An item of the payload, either data or a region of a file
+			struct ResponsePayload
+			{
+				std::shared_ptr<const ov::Data> data;
+				std::shared_ptr<const ov::FileRegion> file_region;
+
+				size_t GetLength() const
+				{
+					return (file_region != nullptr) ? file_region->GetLength() : data->GetLength();
+				}
+			};
+
 			bool IsHeaderSent() const;
 			
-			// Get Response Data List
-			const std::vector<std::shared_ptr<const ov::Data>> &GetResponseDataList() const;
+			// Get Response Payload List (in the order they are enqueued)
+			const std::vector<ResponsePayload> &GetResponsePayloadList() const;
 			// Get Response Header
 			const std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &GetResponseHeaderList() const;
 			void ResetResponseData();
@@ -91,12 +119,21 @@ namespace http
 			}
 			virtual bool Send(const void *data, size_t length);
 			virtual bool Send(const std::shared_ptr<const ov::Data> &data);
-			
+			virtual bool SendFile(const std::shared_ptr<const ov::FileRegion> &file_region);
+
+			// Whether a file region can be sent using sendfile() (without encryption/framing in user space)
+			virtual bool IsFileRegionSendable();
+
+			// Streaming response of each protocol
+			virtual bool PrepareStreamingPayload();
+			virtual bool SendEndOfPayload();
+
 		private:
 			virtual int32_t SendHeader();
 			virtual int32_t SendPayload();
 
 			ov::String GetEtag();
+			void UpdateResponseHash(const std::shared_ptr<const ov::Data> &data);
 
 			std::shared_ptr<ov::ClientSocket> _client_socket;
 			std::shared_ptr<ov::TlsServerData> _tls_data;
@@ -105,6 +142,7 @@ namespace http
 			ov::String _reason = StringFromStatusCode(StatusCode::OK);
 
 			bool _is_header_sent = false;
+			bool _is_streaming_response = false;
 			
 			// FIXME(dimiden): It is supposed to be synchronized whenever a packet is sent, but performance needs to be improved
 			std::recursive_mutex _response_mutex;
@@ -122,7 +160,7 @@ namespace http
 
 			// So _response_header is a map of case insentitive header key and value
 			std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> _response_header;
-			std::vector<std::shared_ptr<const ov::Data>> _response_data_list;
+			std::vector<ResponsePayload> _response_payload_list;
 			size_t _response_data_size = 0;
 
 			std::vector<ov::String> _default_value{};
@@ -138,6 +176,8 @@ namespace http
 			bool _etag_enabled_by_config = false;
 			ov::String _if_none_match = "";
 			std::shared_ptr<ov::Data> _response_hash = nullptr;
+			// Set by SetEtag()
+			ov::String _etag;
 		};
 	}  // namespace svr
 }  // namespace http
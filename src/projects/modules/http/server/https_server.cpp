@@ -8,6 +8,8 @@
 //==============================================================================
 #include "https_server.h"
 
+#include "config/config_manager.h"
+
 #include "./http_server_private.h"
 
 // Reference: https://wiki.mozilla.org/Security/Server_Side_TLS
@@ -122,6 +124,19 @@ namespace http
 				return remote->Send(data, length) ? length : -1L;
 			});
 
+			const auto &module_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules();
+
+			if (module_config.GetKTLS().IsEnabled())
+			{
+				tls_data->EnableKtls(
+					[remote](const void *crypto_info) -> bool {
+						return remote->EnableKtlsSend(crypto_info);
+					},
+					[remote](uint8_t record_type, const void *data, size_t length) -> bool {
+						return remote->SendKtlsRecord(record_type, std::make_shared<ov::Data>(data, length));
+					});
+			}
+
 			client->SetTlsData(tls_data);
 		}
 
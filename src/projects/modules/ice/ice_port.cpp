@@ -239,13 +239,11 @@ bool IcePort::Close()
 
 ov::String IcePort::GenerateUfrag()
 {
-	std::shared_lock<std::shared_mutex> lock(_ice_sessions_with_ufrag_lock);
-
 	while (true)
 	{
 		ov::String ufrag = ov::Random::GenerateString(6);
 
-		if (_ice_sessions_with_ufrag.find(ufrag) == _ice_sessions_with_ufrag.end())
+		if (_ice_sessions_with_ufrag.Find(ufrag) == nullptr)
 		{
 			logtd("Generated ufrag: %s", ufrag.CStr());
 
@@ -256,77 +254,32 @@ ov::String IcePort::GenerateUfrag()
 
 bool IcePort::AddIceSession(session_id_t session_id, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-	auto item = _ice_seesions_with_id.find(session_id);
-	if (item == _ice_seesions_with_id.end())
-	{
-		_ice_seesions_with_id.emplace(session_id, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_id.Add(session_id, ice_session);
 }
 
 bool IcePort::AddIceSession(const ov::String &local_ufrag, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_ufrag_lock);
-	auto item = _ice_sessions_with_ufrag.find(local_ufrag);
-	if (item == _ice_sessions_with_ufrag.end())
-	{
-		_ice_sessions_with_ufrag.emplace(local_ufrag, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_ufrag.Add(local_ufrag, ice_session);
 }
 
 bool IcePort::AddIceSession(const ov::SocketAddressPair &address_pair, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_sessions_with_address_pair.find(address_pair);
-	if (item == _ice_sessions_with_address_pair.end())
-	{
-		_ice_sessions_with_address_pair.emplace(address_pair, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_address_pair.Add(address_pair, ice_session);
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(session_id_t session_id)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_seesions_with_id.find(session_id);
-	if (item != _ice_seesions_with_id.end())
-	{
-		return item->second;
-	}
-
-	return nullptr;
+	return _ice_sessions_with_id.Find(session_id);
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(const ov::String &local_ufrag)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_ufrag_lock);
-	auto item = _ice_sessions_with_ufrag.find(local_ufrag);
-	if (item != _ice_sessions_with_ufrag.end())
-	{
-		return item->second;
-	}
-
-	return nullptr;
+	return _ice_sessions_with_ufrag.Find(local_ufrag);
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(const ov::SocketAddressPair &socket_address_pair)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_sessions_with_address_pair.find(socket_address_pair);
-	if (item != _ice_sessions_with_address_pair.end())
-	{
-		return item->second;
-	}
-
-	return nullptr;
+	return _ice_sessions_with_address_pair.Find(socket_address_pair);
 }
 
 session_id_t IcePort::IssueUniqueSessionId()
@@ -392,33 +345,17 @@ bool IcePort::RemoveSession(session_id_t session_id)
 		return false;
 	}
 
-	size_t ice_sessions_with_id_size = 0;
-	size_t ice_sessions_with_ufrag_size = 0;
-	size_t ice_sessions_with_address_pair_size = 0;
-
 	// Remove from _ice_sessions_with_id
-	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-		_ice_seesions_with_id.erase(session_id);
-		ice_sessions_with_id_size = _ice_seesions_with_id.size();
-	}
+	_ice_sessions_with_id.Remove(session_id);
 
 	// Remove from _ice_sessions_with_ufrag
-	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_ufrag_lock);
-		_ice_sessions_with_ufrag.erase(ice_session->GetLocalUfrag());
-		ice_sessions_with_ufrag_size = _ice_sessions_with_ufrag.size();
-	}
+	_ice_sessions_with_ufrag.Remove(ice_session->GetLocalUfrag());
 
 	// Remove from _ice_sessions_with_address_pair if it exists
+	auto connected_candidate_pair = ice_session->GetConnectedCandidatePair();
+	if (connected_candidate_pair != nullptr)
 	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-		auto connected_candidate_pair = ice_session->GetConnectedCandidatePair();
-		if (connected_candidate_pair != nullptr)
-		{
-			_ice_sessions_with_address_pair.erase(connected_candidate_pair->GetAddressPair());
-		}
-		ice_sessions_with_address_pair_size = _ice_sessions_with_address_pair.size();
+		_ice_sessions_with_address_pair.Remove(connected_candidate_pair->GetAddressPair());
 	}
 
 	{
@@ -433,7 +370,7 @@ bool IcePort::RemoveSession(session_id_t session_id)
 		}
 	}
 
-	logti("Removed session(%u) from ICEPort | ice_seesions_with_id count(%d) ice_sessions_with_ufrag(%d) ice_sessions_with_address_pair(%d) ", session_id, ice_sessions_with_id_size, ice_sessions_with_ufrag_size, ice_sessions_with_address_pair_size);
+	logti("Removed session(%u) from ICEPort | ice_seesions_with_id count(%zu) ice_sessions_with_ufrag(%zu) ice_sessions_with_address_pair(%zu) ", session_id, _ice_sessions_with_id.GetCount(), _ice_sessions_with_ufrag.GetCount(), _ice_sessions_with_address_pair.GetCount());
 
 	return true;
 }
@@ -500,18 +437,14 @@ void IcePort::CheckTimedOut()
 
 	// Collect terminated sessions for thread safety
 	std::vector<std::shared_ptr<IceSession>> terminated_session_list;
-	{
-		std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-
-		for (const auto &item : _ice_seesions_with_id)
+	_ice_sessions_with_id.ForEach([&terminated_session_list](const session_id_t &session_id, const std::shared_ptr<IceSession> &session) {
+		if (session->IsExpired() || session->GetState() == IceConnectionState::Disconnecting)
 		{
-			auto session = item.second;
-			if (session->IsExpired() || session->GetState() == IceConnectionState::Disconnecting)
-			{
-				terminated_session_list.push_back(session);
-			}
+			terminated_session_list.push_back(session);
 		}
-	}
+	});
+
+	ReportBatchSendStats();
 
 	// Remove terminated sessions and notify
 	for (auto &terminated_session : terminated_session_list)
@@ -536,6 +469,43 @@ void IcePort::CheckTimedOut()
 	}
 }
 
+void IcePort::ReportBatchSendStats()
+{
+	if (_batch_stats_report_watch.IsStart() == false)
+	{
+		_batch_stats_report_watch.Start();
+		return;
+	}
+
+	if (_batch_stats_report_watch.IsElapsed(ICE_BATCH_STATS_REPORT_INTERVAL_MS) == false)
+	{
+		return;
+	}
+
+	_batch_stats_report_watch.Update();
+
+	std::lock_guard<std::recursive_mutex> lock_guard(_physical_port_list_mutex);
+
+	for (const auto &physical_port : _physical_port_list)
+	{
+		auto socket = physical_port->GetSocket();
+		if ((socket == nullptr) || (socket->GetType() != ov::SocketType::Udp))
+		{
+			continue;
+		}
+
+		auto stats = socket->GetBatchSendStats();
+		if (stats.syscall_count == 0)
+		{
+			continue;
+		}
+
+		logtd("Batched egress of %s - syscalls: %" PRIu64 ", packets: %" PRIu64 " (GSO: %" PRIu64 "), packets per syscall: %.2f",
+			  physical_port->GetAddress().ToString().CStr(),
+			  stats.syscall_count, stats.datagram_count, stats.gso_datagram_count, stats.GetDatagramsPerSyscall());
+	}
+}
+
 bool IcePort::Send(session_id_t session_id, const std::shared_ptr<RtpPacket> &packet)
 {
 	return Send(session_id, packet->GetData());
@@ -595,6 +565,46 @@ bool IcePort::Send(session_id_t session_id, const std::shared_ptr<const ov::Data
 	return remote->SendFromTo(connected_candidate_pair->GetAddressPair(), send_data);
 }
 
+bool IcePort::SendBatch(session_id_t session_id, const std::shared_ptr<const ov::Data> &data, const std::vector<size_t> &segment_lengths)
+{
+	std::shared_ptr<IceSession> ice_session = FindIceSession(session_id);
+	if (ice_session == nullptr || ice_session->GetState() != IceConnectionState::Connected)
+	{
+		logtd("IcePort::SendBatch - Could not find session: %d", session_id);
+		return false;
+	}
+
+	auto remote = ice_session->GetConnectedSocket();
+	if (remote == nullptr)
+	{
+		logte("IcePort::SendBatch - Could not find connected remote socket: %d", session_id);
+		return false;
+	}
+
+	// TURN proxied packets need to be wrapped one by one, so send them separately
+	if ((ice_session->IsTurnClient() == true) || (remote->GetType() != ov::SocketType::Udp))
+	{
+		off_t offset = 0;
+		bool result = true;
+
+		for (const auto &length : segment_lengths)
+		{
+			result = Send(session_id, data->Subdata(offset, length)) && result;
+			offset += length;
+		}
+
+		return result;
+	}
+
+	auto connected_candidate_pair = ice_session->GetConnectedCandidatePair();
+	if (connected_candidate_pair == nullptr)
+	{
+		return false;
+	}
+
+	return remote->SendBatchFromTo(connected_candidate_pair->GetAddressPair(), data, segment_lengths);
+}
+
 void IcePort::OnConnected(const std::shared_ptr<ov::Socket> &remote)
 {
 	// called when TURN client connected to the turn server with TCP
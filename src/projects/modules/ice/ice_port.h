@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ice_session.h"
+#include "ice_session_table.h"
 #include "ice_port_observer.h"
 #include "ice_tcp_demultiplexer.h"
 #include "modules/ice/stun/stun_message.h"
@@ -34,6 +35,8 @@
 
 #define OV_ICE_PORT_PUBLIC_IP "${PublicIP}"
 
+#define ICE_BATCH_STATS_REPORT_INTERVAL_MS (60 * 1000)
+
 class RtcIceCandidate;
 
 class IcePort : protected PhysicalPortObserver
@@ -59,6 +62,8 @@ public:
 	bool Send(session_id_t session_id, const std::shared_ptr<RtpPacket> &packet);
 	bool Send(session_id_t session_id, const std::shared_ptr<RtcpPacket> &packet);
 	bool Send(session_id_t session_id, const std::shared_ptr<const ov::Data> &data);
+	// Sends several packets at once. <data> contains the packets back-to-back, and each item of <segment_lengths> is the length of one packet.
+	bool SendBatch(session_id_t session_id, const std::shared_ptr<const ov::Data> &data, const std::vector<size_t> &segment_lengths);
 
 	ov::String ToString() const;
 
@@ -158,6 +163,7 @@ private:
 	bool RemoveTransaction(const ov::String &transaction_id);
 
 	void CheckTimedOut();
+	void ReportBatchSendStats();
 
 	void OnPacketReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddressPair &address_pair,
 						  GateInfo &packet_info, const std::shared_ptr<const ov::Data> &data);
@@ -208,17 +214,14 @@ private:
 	// Mapping table containing related information until STUN binding.
 	// Once binding is complete, there is no need because it can be found by destination ip & port.
 	// key: offer ufrag
-	std::shared_mutex _ice_sessions_with_ufrag_lock;
-	std::map<const ov::String, std::shared_ptr<IceSession>> _ice_sessions_with_ufrag;
+	IceSessionTable<ov::String> _ice_sessions_with_ufrag;
 	
 	// Find IceSession with connected CandidatePair, used when receiving TURN channel data and application data
 	// key: SocketAddressPair
-	std::shared_mutex _ice_sessions_with_address_pair_lock;
-	std::map<ov::SocketAddressPair, std::shared_ptr<IceSession>> _ice_sessions_with_address_pair;
+	IceSessionTable<ov::SocketAddressPair> _ice_sessions_with_address_pair;
 	
 	// Find IceSession with peer's session id, used for sending application data 
-	std::shared_mutex _ice_sessions_with_id_lock;
-	std::map<session_id_t, std::shared_ptr<IceSession>> _ice_seesions_with_id;
+	IceSessionTable<session_id_t> _ice_sessions_with_id;
 
 	// Insert item when send stun binding request
 	// Remove item when receive stun binding response or timed out
@@ -232,4 +235,7 @@ private:
 	std::map<int, std::shared_ptr<IceTcpDemultiplexer>> _demultiplexers;
 
 	ov::DelayQueue _timer{"ICETmout"};
+
+	// Used to report packets per syscall of the batched egress path
+	ov::StopWatch _batch_stats_report_watch;
 };
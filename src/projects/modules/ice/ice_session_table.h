@@ -0,0 +1,176 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/epoch_reclaimer.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#define ICE_SESSION_TABLE_SHARD_BITS 8
+#define ICE_SESSION_TABLE_SHARD_COUNT (1 << ICE_SESSION_TABLE_SHARD_BITS)
+
+class IceSession;
+
+// Read-mostly table of IceSessions, looked up for every packet sent or received
+//
+// The table is split into shards by the hash of the key. Each shard publishes an immutable map through
+// an atomic pointer, and a writer (adding or removing a session) replaces the map with a modified copy
+// and retires the old one to ov::EpochReclaimer. Lookups take no lock and write no shared memory.
+template <typename Tkey>
+class IceSessionTable
+{
+public:
+	using Map = std::unordered_map<Tkey, std::shared_ptr<IceSession>>;
+
+	IceSessionTable() = default;
+
+	~IceSessionTable()
+	{
+		for (auto &shard : _shards)
+		{
+			ov::EpochReclaimer::Retire(shard.map.exchange(nullptr));
+		}
+	}
+
+	std::shared_ptr<IceSession> Find(const Tkey &key) const
+	{
+		auto &shard = GetShard(key);
+		ov::EpochReclaimer::ReadGuard guard;
+
+		auto map = shard.map.load(std::memory_order_acquire);
+		if (map == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto item = map->find(key);
+		if (item == map->end())
+		{
+			return nullptr;
+		}
+
+		return item->second;
+	}
+
+	// Returns false if the key already exists
+	bool Add(const Tkey &key, const std::shared_ptr<IceSession> &ice_session)
+	{
+		auto &shard = GetShard(key);
+		std::lock_guard<std::mutex> lock(shard.writer_lock);
+
+		auto old_map = shard.map.load(std::memory_order_relaxed);
+
+		if ((old_map != nullptr) && (old_map->find(key) != old_map->end()))
+		{
+			return false;
+		}
+
+		auto new_map = (old_map != nullptr) ? new Map(*old_map) : new Map();
+		new_map->emplace(key, ice_session);
+
+		shard.map.store(new_map, std::memory_order_release);
+		ov::EpochReclaimer::Retire(old_map);
+
+		_count++;
+
+		return true;
+	}
+
+	bool Remove(const Tkey &key)
+	{
+		auto &shard = GetShard(key);
+		std::lock_guard<std::mutex> lock(shard.writer_lock);
+
+		auto old_map = shard.map.load(std::memory_order_relaxed);
+
+		if ((old_map == nullptr) || (old_map->find(key) == old_map->end()))
+		{
+			return false;
+		}
+
+		auto new_map = new Map(*old_map);
+		new_map->erase(key);
+
+		shard.map.store(new_map, std::memory_order_release);
+		ov::EpochReclaimer::Retire(old_map);
+
+		_count--;
+
+		return true;
+	}
+
+	// The function is called outside of the read guard (the items of each shard are copied first),
+	// so it may add or remove sessions. Sessions added or removed during the iteration may not be visited.
+	template <typename Tfunction>
+	void ForEach(Tfunction function) const
+	{
+		std::vector<std::pair<Tkey, std::shared_ptr<IceSession>>> items;
+
+		for (const auto &shard : _shards)
+		{
+			items.clear();
+
+			{
+				ov::EpochReclaimer::ReadGuard guard;
+
+				auto map = shard.map.load(std::memory_order_acquire);
+				if ((map == nullptr) || map->empty())
+				{
+					continue;
+				}
+
+				items.assign(map->begin(), map->end());
+			}
+
+			for (const auto &item : items)
+			{
+				function(item.first, item.second);
+			}
+		}
+	}
+
+	size_t GetCount() const
+	{
+		return _count;
+	}
+
+private:
+	// Each shard is aligned to a cache line so that the map pointer of a shard doesn't share a cache line with another one
+	struct alignas(64) Shard
+	{
+		// Serializes the writers of the shard
+		std::mutex writer_lock;
+		// nullptr if no session has been added yet
+		std::atomic<const Map *> map{nullptr};
+	};
+	const Shard &GetShard(const Tkey &key) const
+	{
+		return _shards[GetShardIndex(key)];
+	}
+
+	Shard &GetShard(const Tkey &key)
+	{
+		return _shards[GetShardIndex(key)];
+	}
+
+	static size_t GetShardIndex(const Tkey &key)
+	{
+		// The hashes of integers and socket addresses are not well distributed in the upper bits,
+		// so they are mixed (Fibonacci hashing) before the shard is selected
+		uint64_t hash = static_cast<uint64_t>(std::hash<Tkey>{}(key)) * 0x9E3779B97F4A7C15ULL;
+		return static_cast<size_t>(hash >> (64 - ICE_SESSION_TABLE_SHARD_BITS));
+	}
+
+	std::array<Shard, ICE_SESSION_TABLE_SHARD_COUNT> _shards;
+	std::atomic<size_t> _count{0};
+};
@@ -95,4 +95,48 @@ namespace serdes
 
 		return value;
 	}
+
+	Json::Value JsonFromMemoryPoolStats(const ov::MemoryPool::Stats &stats)
+	{
+		Json::Value value;
+
+		SetInt64(value, "hit", stats.hit_count);
+		SetInt64(value, "miss", stats.miss_count);
+		SetInt64(value, "bypass", stats.bypass_count);
+		SetInt64(value, "bytesInUse", stats.bytes_in_use);
+		SetInt64(value, "bytesCached", stats.bytes_cached);
+
+		return value;
+	}
+
+	Json::Value JsonFromChunklistCacheStats(const mon::ServerMetrics::ChunklistCacheStats &stats)
+	{
+		Json::Value value;
+
+		SetInt64(value, "hit", stats.hit_count);
+		SetInt64(value, "miss", stats.miss_count);
+		SetFloat(value, "hitRatio", static_cast<float>(stats.GetHitRatio()));
+
+		return value;
+	}
+
+	Json::Value JsonFromLogStats(const mon::ServerMetrics::LogStats &stats)
+	{
+		Json::Value value;
+
+		SetInt64(value, "dropped", stats.dropped_count);
+
+		return value;
+	}
+
+	Json::Value JsonFromKtlsStats(const mon::ServerMetrics::KtlsStats &stats)
+	{
+		Json::Value value;
+
+		SetInt64(value, "requested", stats.requested_count);
+		SetInt64(value, "enabled", stats.enabled_count);
+		SetInt64(value, "fallback", stats.fallback_count);
+
+		return value;
+	}
 }  // namespace serdes
\ No newline at end of file
@@ -15,4 +15,8 @@ namespace serdes
 	Json::Value JsonFromMetrics(const std::shared_ptr<const mon::CommonMetrics> &metrics);
 	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics);
 	Json::Value JsonFromQueueMetrics(const std::shared_ptr<const mon::QueueMetrics> &metrics);
+	Json::Value JsonFromMemoryPoolStats(const ov::MemoryPool::Stats &stats);
+	Json::Value JsonFromChunklistCacheStats(const mon::ServerMetrics::ChunklistCacheStats &stats);
+	Json::Value JsonFromLogStats(const mon::ServerMetrics::LogStats &stats);
+	Json::Value JsonFromKtlsStats(const mon::ServerMetrics::KtlsStats &stats);
 }  // namespace serdes
\ No newline at end of file
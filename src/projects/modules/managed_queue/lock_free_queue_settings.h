@@ -0,0 +1,83 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "base/ovlibrary/ovlibrary.h"
+
+namespace ov
+{
+	// Which managed queues use the lock-free ring (<Modules><LockFreeQueue>)
+	//
+	// The settings are passed in by the caller that loads the configuration, before the queues are created,
+	// so ManagedQueue doesn't depend on the config module.
+	class LockFreeQueueSettings
+	{
+	public:
+		static void Set(bool enabled, int capacity, const std::vector<ov::String> &urn_pattern_list)
+		{
+			std::shared_ptr<Settings> settings;
+
+			if (enabled)
+			{
+				settings = std::make_shared<Settings>();
+				settings->capacity = static_cast<size_t>(std::max(capacity, 2));
+
+				for (const auto &pattern : urn_pattern_list)
+				{
+					settings->regex_list.push_back(ov::Regex::CompiledRegex(ov::Regex::WildCardRegex(pattern)));
+				}
+			}
+
+			std::lock_guard lock_guard(_mutex);
+			_settings = std::move(settings);
+		}
+
+		// Returns true if the lock-free ring is enabled and one of the URN patterns matches the URN
+		static bool IsRequested(const ov::String &urn, size_t *capacity)
+		{
+			std::shared_ptr<const Settings> settings;
+
+			{
+				std::lock_guard lock_guard(_mutex);
+				settings = _settings;
+			}
+
+			if (settings == nullptr)
+			{
+				return false;
+			}
+
+			for (const auto &regex : settings->regex_list)
+			{
+				if (regex.Matches(urn.CStr()).IsMatched())
+				{
+					*capacity = settings->capacity;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+	private:
+		struct Settings
+		{
+			size_t capacity = 0;
+			std::vector<ov::Regex> regex_list;
+		};
+
+		static inline std::mutex _mutex;
+		// nullptr if the lock-free ring is disabled
+		static inline std::shared_ptr<const Settings> _settings;
+	};
+}  // namespace ov
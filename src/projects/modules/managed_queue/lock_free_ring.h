@@ -0,0 +1,145 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace ov
+{
+	// Bounded multi-producer/multi-consumer ring (D. Vyukov's algorithm)
+	//
+	// Every slot carries a sequence number that tells producers and consumers whether the slot
+	// is free for the current lap, so neither side needs a lock. TryPush() fails instead of
+	// blocking when the ring is full; the caller decides what to do with the item.
+	template <typename T>
+	class LockFreeRing
+	{
+	private:
+		struct Cell
+		{
+			std::atomic<size_t> sequence;
+			T data;
+		};
+
+	public:
+		// capacity is rounded up to the next power of two (minimum 2)
+		explicit LockFreeRing(size_t capacity)
+		{
+			size_t rounded = 2;
+
+			while (rounded < capacity)
+			{
+				rounded <<= 1;
+			}
+
+			_mask = rounded - 1;
+			_cells = std::make_unique<Cell[]>(rounded);
+
+			for (size_t index = 0; index < rounded; index++)
+			{
+				_cells[index].sequence.store(index, std::memory_order_relaxed);
+			}
+		}
+
+		LockFreeRing(const LockFreeRing &) = delete;
+		LockFreeRing &operator=(const LockFreeRing &) = delete;
+
+		size_t GetCapacity() const
+		{
+			return _mask + 1;
+		}
+
+		// item is moved only when the push succeeds
+		bool TryPush(T &item)
+		{
+			Cell *cell;
+			size_t position = _enqueue_position.load(std::memory_order_relaxed);
+
+			while (true)
+			{
+				cell = &_cells[position & _mask];
+
+				auto sequence = cell->sequence.load(std::memory_order_acquire);
+				auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+				if (diff == 0)
+				{
+					if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					// Full
+					return false;
+				}
+				else
+				{
+					position = _enqueue_position.load(std::memory_order_relaxed);
+				}
+			}
+
+			cell->data = std::move(item);
+			cell->sequence.store(position + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		bool TryPop(T &item)
+		{
+			Cell *cell;
+			size_t position = _dequeue_position.load(std::memory_order_relaxed);
+
+			while (true)
+			{
+				cell = &_cells[position & _mask];
+
+				auto sequence = cell->sequence.load(std::memory_order_acquire);
+				auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+				if (diff == 0)
+				{
+					if (_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					// Empty
+					return false;
+				}
+				else
+				{
+					position = _dequeue_position.load(std::memory_order_relaxed);
+				}
+			}
+
+			item = std::move(cell->data);
+			// Release whatever the moved-from slot still holds (e.g. std::any)
+			cell->data = T();
+			cell->sequence.store(position + _mask + 1, std::memory_order_release);
+
+			return true;
+		}
+
+	private:
+		std::unique_ptr<Cell[]> _cells;
+		size_t _mask = 0;
+
+		// Producers and consumers hammer different cache lines
+		alignas(64) std::atomic<size_t> _enqueue_position{0};
+		alignas(64) std::atomic<size_t> _dequeue_position{0};
+	};
+}  // namespace ov
@@ -11,17 +11,24 @@
 
 #include <monitoring/monitoring.h>
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <optional>
 #include <queue>
 #include <shared_mutex>
 
 #include "base/info/managed_queue.h"
 #include "base/ovlibrary/ovlibrary.h"
+#include "lock_free_queue_settings.h"
+#include "lock_free_ring.h"
 
 #define MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC 1000
 #define MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC 5000
 
+// In ring mode, only every Nth item is timestamped and triggers a metrics update
+#define MANAGED_QUEUE_RING_SAMPLE_INTERVAL 32
+
 // Deactivated as it is no longer used
 #define SKIP_MESSAGE_ENABLED false
 #define SKIP_MESSAGE_CHECK_INTERVAL 500					 // 0.5 sec
@@ -52,6 +59,13 @@ namespace ov
 			}
 		};
 
+		// Slot of the lock-free ring. _start is left at epoch unless the item was sampled
+		struct RingNode
+		{
+			T data{};
+			std::chrono::high_resolution_clock::time_point _start{};
+		};
+
 	public:
 		ManagedQueue()
 			: ManagedQueue(nullptr) {}
@@ -67,6 +81,8 @@ namespace ov
 		{
 			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
 
+			SelectImplementation();
+
 			// Register to the server metrics
 			// If the Unique id is duplicated or memory allocation failed, retry
 			while (true)
@@ -88,10 +104,14 @@ namespace ov
 			MonitorInstance->GetServerMetrics()->OnQueueDeleted(*this);
 		}
 
+		// The implementation (linked list or lock-free ring) is selected here, so the URN must be set
+		// before any producer/consumer thread starts using the queue
 		void SetUrn(std::shared_ptr<info::ManagedQueue::URN> urn)
 		{
 			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
 
+			SelectImplementation();
+
 			MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this, true);
 		}
 
@@ -105,6 +125,12 @@ namespace ov
 		// Urgent item will be inserted at the front of the queue
 		void Enqueue(const T& item, bool urgent = false, int timeout = Infinite)
 		{
+			if (_ring != nullptr)
+			{
+				RingEnqueue(T(item), urgent);
+				return;
+			}
+
 			auto node = new ManagedQueueNode(item, urgent);
 			EnqeuePos pos = urgent ? EnqeuePos::EnqueuFrontPos : EnqeuePos::EnqueuBackPos;
 
@@ -114,14 +140,27 @@ namespace ov
 		// Urgent item will be inserted at the front of the queue
 		void Enqueue(T&& item, bool urgent = false, int timeout = Infinite)
 		{
+			if (_ring != nullptr)
+			{
+				RingEnqueue(std::move(item), urgent);
+				return;
+			}
+
 			auto node = new ManagedQueueNode(item, urgent);
 			EnqeuePos pos = urgent ? EnqeuePos::EnqueuFrontPos : EnqeuePos::EnqueuBackPos;
 
 			EnqueueInternal(node, timeout, pos);
 		}
 
+		// Not supported in ring mode (the ring cannot be inspected without popping)
 		std::optional<T> Front(int timeout = Infinite)
 		{
+			if (_ring != nullptr)
+			{
+				OV_ASSERT(false, "Front() is not supported by the lock-free ring: %s", ToString().CStr());
+				return {};
+			}
+
 			auto unique_lock = std::unique_lock(_mutex);
 
 			if (_stop)
@@ -149,13 +188,26 @@ namespace ov
 		// How long the first message has been buffered
 		int32_t GetBufferedTimeMs()
 		{
+			if (_ring != nullptr)
+			{
+				// Buffering delay is never used in ring mode
+				return 0;
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			return GetBufferedTimeMsInternal();
 		}
 
+		// Not supported in ring mode (the ring cannot be inspected without popping)
 		std::optional<T> Back(int timeout = Infinite)
 		{
+			if (_ring != nullptr)
+			{
+				OV_ASSERT(false, "Back() is not supported by the lock-free ring: %s", ToString().CStr());
+				return {};
+			}
+
 			auto unique_lock = std::unique_lock(_mutex);
 
 			if (_stop)
@@ -182,6 +234,11 @@ namespace ov
 
 		std::optional<T> Dequeue(int timeout = Infinite)
 		{
+			if (_ring != nullptr)
+			{
+				return RingDequeue(timeout);
+			}
+
 			auto unique_lock = std::unique_lock(_mutex);
 
 			if (_stop)
@@ -261,6 +318,11 @@ namespace ov
 
 		bool IsEmpty() const
 		{
+			if (_ring != nullptr)
+			{
+				return (_ring_size.load() <= 0);
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			return (_size == 0);
@@ -269,6 +331,12 @@ namespace ov
 		// Cleared all items in the queue
 		void Clear()
 		{
+			if (_ring != nullptr)
+			{
+				RingClear();
+				return;
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			while (_front_node != nullptr)
@@ -289,6 +357,11 @@ namespace ov
 
 		size_t Size() const
 		{
+			if (_ring != nullptr)
+			{
+				return static_cast<size_t>(std::max<int64_t>(_ring_size.load(), 0));
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			return _size;
@@ -321,6 +394,8 @@ namespace ov
 		void SetExceedWaitEnable(bool enable)
 		{
 			_exceed_threshold_and_wait_enabled = enable;
+
+			SelectImplementation();
 		}
 
 		bool IsExceedWaitEnable()
@@ -332,9 +407,238 @@ namespace ov
 		void SetBufferingDelay(int delay_ms)
 		{
 			_buffering_delay = delay_ms;
+
+			SelectImplementation();
+		}
+
+		bool IsLockFree() const
+		{
+			return (_ring != nullptr);
 		}
 
 	private:
+		// Returns true if the lock-free ring is enabled (see LockFreeQueueSettings) for the URN
+		static bool IsLockFreeQueueRequested(const std::shared_ptr<info::ManagedQueue::URN>& urn, size_t* capacity)
+		{
+			if (urn == nullptr)
+			{
+				return false;
+			}
+
+			return LockFreeQueueSettings::IsRequested(urn->ToString(), capacity);
+		}
+
+		// Choose between the linked list and the lock-free ring.
+		// Buffering delay and exceed-wait need to inspect the queue under a lock, so those queues stay on the linked list.
+		void SelectImplementation()
+		{
+			size_t capacity = 0;
+			bool use_ring = (_buffering_delay == 0) &&
+							(_exceed_threshold_and_wait_enabled == false) &&
+							IsLockFreeQueueRequested(_urn, &capacity);
+
+			if (use_ring == (_ring != nullptr))
+			{
+				return;
+			}
+
+			if (Size() > 0)
+			{
+				logw(LOG_TAG, "[%u] Cannot switch the implementation of %s while it has items", GetId(), ToString().CStr());
+				return;
+			}
+
+			if (use_ring)
+			{
+				_ring = std::make_unique<LockFreeRing<RingNode>>(capacity);
+				logd(LOG_TAG, "[%u] %s uses a lock-free ring (capacity: %zu)", GetId(), ToString().CStr(), _ring->GetCapacity());
+			}
+			else
+			{
+				_ring.reset();
+			}
+		}
+
+		// Ring mode
+		//
+		// Normal items go to the lock-free ring. When the ring is full, the item is dropped and counted
+		// in the drop count of the queue, as the linked list does when it cannot wait for room.
+		// Urgent items go to _ring_urgent_items and are dequeued first.
+		// The consumer sleeps on _condition only when everything is empty.
+		void RingEnqueue(T&& item, bool urgent)
+		{
+			RingNode node;
+			node.data = std::move(item);
+
+			auto input_count = _ring_input_count.fetch_add(1) + 1;
+			bool sampled = ((input_count % MANAGED_QUEUE_RING_SAMPLE_INTERVAL) == 0);
+
+			if (sampled)
+			{
+				node._start = std::chrono::high_resolution_clock::now();
+			}
+
+			if (urgent)
+			{
+				auto lock_guard = std::lock_guard(_ring_side_mutex);
+				_ring_urgent_items.push_front(std::move(node));
+				_ring_urgent_count++;
+			}
+			else if (_ring->TryPush(node) == false)
+			{
+				RingDrop();
+				return;
+			}
+
+			auto size = _ring_size.fetch_add(1) + 1;
+
+			auto peak = _ring_peak.load(std::memory_order_relaxed);
+			while ((peak < size) && (_ring_peak.compare_exchange_weak(peak, size, std::memory_order_relaxed) == false))
+			{
+			}
+
+			if (_ring_waiting_consumers.load() > 0)
+			{
+				auto lock_guard = std::lock_guard(_mutex);
+				_condition.notify_all();
+			}
+
+			if (sampled)
+			{
+				RingUpdateMetrics();
+			}
+		}
+
+		bool RingTryPop(RingNode& node)
+		{
+			if (_ring_urgent_count.load() > 0)
+			{
+				auto lock_guard = std::lock_guard(_ring_side_mutex);
+
+				if (_ring_urgent_items.empty() == false)
+				{
+					node = std::move(_ring_urgent_items.front());
+					_ring_urgent_items.pop_front();
+					_ring_urgent_count--;
+
+					return true;
+				}
+			}
+
+			return _ring->TryPop(node);
+		}
+
+		void RingDrop()
+		{
+			auto drop_count = _ring_drop_count.fetch_add(1) + 1;
+
+			auto now = ov::Time::GetTimestampInMs();
+			auto last_log_time = _ring_drop_last_log_time.load(std::memory_order_relaxed);
+
+			if (((now - last_log_time) >= MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC) &&
+				_ring_drop_last_log_time.compare_exchange_strong(last_log_time, now, std::memory_order_relaxed))
+			{
+				auto shared_lock = std::shared_lock(_name_mutex);
+				loge(LOG_TAG, "[%u] %s is full. An item is dropped. capacity: %zu, dropped: %" PRId64, GetId(), ToString().CStr(), _ring->GetCapacity(), drop_count);
+			}
+
+			RingUpdateMetrics();
+		}
+
+		std::optional<T> RingDequeue(int timeout)
+		{
+			if (_stop)
+			{
+				return {};	// Stop is requested
+			}
+
+			RingNode node;
+
+			if (RingTryPop(node) == false)
+			{
+				std::chrono::system_clock::time_point expire = (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
+
+				// Publish the (now empty) state while the consumer is idle
+				RingUpdateMetrics();
+
+				while (RingTryPop(node) == false)
+				{
+					auto unique_lock = std::unique_lock(_mutex);
+
+					_ring_waiting_consumers++;
+					auto result = _condition.wait_until(unique_lock, expire, [this]() -> bool {
+						return ((_ring_size.load() > 0) || _stop);
+					});
+					_ring_waiting_consumers--;
+
+					if (!result || _stop)
+					{
+						return {};	// timed out / Stop is requested
+					}
+				}
+			}
+
+			_ring_size--;
+			auto output_count = _ring_output_count.fetch_add(1) + 1;
+
+			if (node._start.time_since_epoch().count() != 0)
+			{
+				auto waiting_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - node._start).count();
+				_ring_waiting_time_in_us.store(waiting_time);
+			}
+
+			if ((output_count % MANAGED_QUEUE_RING_SAMPLE_INTERVAL) == 0)
+			{
+				RingUpdateMetrics();
+			}
+
+			return std::move(node.data);
+		}
+
+		void RingClear()
+		{
+			RingNode node;
+
+			while (RingTryPop(node))
+			{
+				_ring_size--;
+			}
+
+			auto lock_guard = std::lock_guard(_ring_metrics_mutex);
+
+			_ring_peak = 0;
+			_ring_input_count = 0;
+			_ring_output_count = 0;
+			_size = 0;
+
+			ClearMetrics();
+		}
+
+		// Copy the atomic counters into info::ManagedQueue and run the regular metrics update.
+		// Skipped if another thread is already doing it.
+		void RingUpdateMetrics()
+		{
+			auto unique_lock = std::unique_lock(_ring_metrics_mutex, std::try_to_lock);
+
+			if (unique_lock.owns_lock() == false)
+			{
+				return;
+			}
+
+			_size = static_cast<size_t>(std::max<int64_t>(_ring_size.load(), 0));
+			_peak = std::max(_peak, static_cast<size_t>(std::max<int64_t>(_ring_peak.load(), 0)));
+			_input_message_count = _ring_input_count.load();
+			_output_message_count = _ring_output_count.load();
+			_drop_message_count = static_cast<uint64_t>(_ring_drop_count.load());
+
+			auto waiting_time = _ring_waiting_time_in_us.exchange(-1);
+			if (waiting_time >= 0)
+			{
+				_waiting_time_in_us = _waiting_time_in_us * 0.9 + waiting_time * 0.1;
+			}
+
+			UpdateMetrics();
+		}
 
 		int32_t GetBufferedTimeMsInternal()
 		{
@@ -633,7 +937,24 @@ namespace ov
 		std::condition_variable _condition;
 
 		// Stop flag
-		bool _stop;
+		std::atomic<bool> _stop;
+
+		// Lock-free ring (ring mode only)
+		std::unique_ptr<LockFreeRing<RingNode>> _ring;
+		// Guards _ring_urgent_items
+		std::mutex _ring_side_mutex;
+		std::deque<RingNode> _ring_urgent_items;
+		std::atomic<size_t> _ring_urgent_count{0};
+		std::atomic<int64_t> _ring_drop_count{0};
+		std::atomic<int64_t> _ring_drop_last_log_time{0};
+		std::atomic<int64_t> _ring_size{0};
+		std::atomic<int64_t> _ring_peak{0};
+		std::atomic<int64_t> _ring_input_count{0};
+		std::atomic<int64_t> _ring_output_count{0};
+		// Latest sampled waiting time, -1 if already folded into _waiting_time_in_us
+		std::atomic<int64_t> _ring_waiting_time_in_us{-1};
+		std::atomic<int> _ring_waiting_consumers{0};
+		std::mutex _ring_metrics_mutex;
 
 		// Use to print logs when the peak value of the queue is increased.
 		size_t _last_logged_peak = 0;
@@ -148,7 +148,7 @@ bool OvtDepacketizer::AppendMediaPacket(const std::shared_ptr<OvtPacket> &packet
 			return false;
 		}
 
-		auto media_packet = std::make_shared<MediaPacket>(
+		auto media_packet = ov::MakePooledShared<MediaPacket>(
 			0,
 			media_type, track_id,
 			_media_packet_buffer.Subdata(MEDIA_PACKET_HEADER_SIZE),
@@ -77,7 +77,9 @@ bool PhysicalPort::Create(const char *name,
 						  bool thread_per_socket,
 						  int send_buffer_size,
 						  int recv_buffer_size,
-						  const OnSocketCreated on_socket_created)
+						  const OnSocketCreated on_socket_created,
+						  bool reuse_port,
+						  bool cpu_affinity)
 {
 	if ((_server_socket != nullptr) || (_datagram_socket != nullptr))
 	{
@@ -87,10 +89,11 @@ bool PhysicalPort::Create(const char *name,
 
 	_name = name;
 
-	logtd("Trying to start physical port [%s] on %s/%s (worker: %d, send_buffer_size: %d, recv_buffer_size: %d)...",
+	logtd("Trying to start physical port [%s] on %s/%s (worker: %d, send_buffer_size: %d, recv_buffer_size: %d, reuse_port: %s)...",
 		  name,
 		  address.ToString().CStr(), ov::StringFromSocketType(type),
-		  worker_count, send_buffer_size, recv_buffer_size);
+		  worker_count, send_buffer_size, recv_buffer_size,
+		  reuse_port ? "true" : "false");
 
 	bool result = false;
 
@@ -98,11 +101,11 @@ bool PhysicalPort::Create(const char *name,
 	{
 		case ov::SocketType::Srt:
 		case ov::SocketType::Tcp:
-			result = CreateServerSocket(name, type, address, worker_count, thread_per_socket, send_buffer_size, recv_buffer_size, on_socket_created);
+			result = CreateServerSocket(name, type, address, worker_count, thread_per_socket, send_buffer_size, recv_buffer_size, on_socket_created, reuse_port);
 			break;
 
 		case ov::SocketType::Udp:
-			result = CreateDatagramSocket(name, type, address, worker_count, thread_per_socket, on_socket_created);
+			result = CreateDatagramSocket(name, type, address, worker_count, thread_per_socket, on_socket_created, reuse_port);
 			break;
 
 		case ov::SocketType::Unknown:
@@ -110,9 +113,27 @@ bool PhysicalPort::Create(const char *name,
 			break;
 	}
 
+	if (result && cpu_affinity && (thread_per_socket == false))
+	{
+		// Failure to pin the threads is not fatal
+		_socket_pool->SetCpuAffinity();
+	}
+
 	return result;
 }
 
+PhysicalPort::OnSocketCreated PhysicalPort::MakeReusePortCallback(const OnSocketCreated on_socket_created)
+{
+	return [on_socket_created](const std::shared_ptr<ov::Socket> &socket) -> std::shared_ptr<ov::Error> {
+		if (socket->SetSockOpt<int>(SOL_SOCKET, SO_REUSEPORT, 1) == false)
+		{
+			return ov::Error::CreateErrorFromErrno();
+		}
+
+		return (on_socket_created != nullptr) ? on_socket_created(socket) : nullptr;
+	};
+}
+
 bool PhysicalPort::CreateServerSocket(
 	const char *name,
 	ov::SocketType type,
@@ -121,7 +142,8 @@ bool PhysicalPort::CreateServerSocket(
 	bool thread_per_socket,
 	int send_buffer_size,
 	int recv_buffer_size,
-	const OnSocketCreated on_socket_created)
+	const OnSocketCreated on_socket_created,
+	bool reuse_port)
 {
 	_socket_pool = ov::SocketPool::Create(GetSocketPoolName(type, name, address), type, thread_per_socket);
 
@@ -129,26 +151,50 @@ bool PhysicalPort::CreateServerSocket(
 	{
 		if (_socket_pool->Initialize(worker_count))
 		{
-			auto socket = _socket_pool->AllocSocket<ov::ServerSocket>(address.GetFamily(), _socket_pool);
+			auto socket_count = reuse_port ? _socket_pool->GetWorkerCount() : 1;
+			auto callback = reuse_port ? MakeReusePortCallback(on_socket_created) : on_socket_created;
+			std::vector<std::shared_ptr<ov::ServerSocket>> socket_list;
 
-			if (socket != nullptr)
+			for (int index = 0; index < socket_count; index++)
 			{
+				auto socket = reuse_port
+								  ? _socket_pool->AllocSocketOnWorker<ov::ServerSocket>(index, address.GetFamily(), _socket_pool)
+								  : _socket_pool->AllocSocket<ov::ServerSocket>(address.GetFamily(), _socket_pool);
+
+				if (socket == nullptr)
+				{
+					break;
+				}
+
 				if (socket->Prepare(
 						address,
-						on_socket_created,
+						callback,
 						std::bind(&PhysicalPort::OnClientConnectionStateChanged, this,
 								  std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
 						std::bind(&PhysicalPort::OnClientData, this,
 								  std::placeholders::_1, std::placeholders::_2),
-						send_buffer_size, recv_buffer_size, 4096))
+						send_buffer_size, recv_buffer_size, 4096) == false)
 				{
-					_type = type;
-					_server_socket = socket;
-					_address = address;
-
-					return true;
+					_socket_pool->ReleaseSocket(socket);
+					break;
 				}
 
+				socket_list.push_back(socket);
+			}
+
+			if (static_cast<int>(socket_list.size()) == socket_count)
+			{
+				_type = type;
+				_server_socket = socket_list.front();
+				_server_socket_list = std::move(socket_list);
+				_address = address;
+
+				return true;
+			}
+
+			// Rollback
+			for (auto &socket : socket_list)
+			{
 				_socket_pool->ReleaseSocket(socket);
 			}
 
@@ -169,7 +215,8 @@ bool PhysicalPort::CreateDatagramSocket(
 	const ov::SocketAddress &address,
 	int worker_count,
 	bool thread_per_socket,
-	const OnSocketCreated on_socket_created)
+	const OnSocketCreated on_socket_created,
+	bool reuse_port)
 {
 	_socket_pool = ov::SocketPool::Create(GetSocketPoolName(type, name, address), type, thread_per_socket);
 
@@ -177,23 +224,51 @@ bool PhysicalPort::CreateDatagramSocket(
 	{
 		if (_socket_pool->Initialize(worker_count))
 		{
-			auto socket = _socket_pool->AllocSocket<ov::DatagramSocket>(address.GetFamily());
+			auto socket_count = reuse_port ? _socket_pool->GetWorkerCount() : 1;
+			auto callback = reuse_port ? MakeReusePortCallback(on_socket_created) : on_socket_created;
+			std::vector<std::shared_ptr<ov::DatagramSocket>> socket_list;
 
-			if (socket != nullptr)
+			for (int index = 0; index < socket_count; index++)
 			{
-				if (socket->Prepare(
-							 address,
-							 on_socket_created,
-							 std::bind(&PhysicalPort::OnDatagram, this,
-									   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)))
+				auto socket = reuse_port
+								  ? _socket_pool->AllocSocketOnWorker<ov::DatagramSocket>(index, address.GetFamily())
+								  : _socket_pool->AllocSocket<ov::DatagramSocket>(address.GetFamily());
+
+				if (socket == nullptr)
 				{
-					_type = type;
-					_datagram_socket = socket;
-					_address = address;
+					break;
+				}
+
+				socket->SetDatagramBatchCallback(
+					std::bind(&PhysicalPort::OnDatagrams, this,
+							  std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
 
-					return true;
+				if (socket->Prepare(
+						address,
+						callback,
+						std::bind(&PhysicalPort::OnDatagram, this,
+								  std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)) == false)
+				{
+					_socket_pool->ReleaseSocket(socket);
+					break;
 				}
 
+				socket_list.push_back(socket);
+			}
+
+			if (static_cast<int>(socket_list.size()) == socket_count)
+			{
+				_type = type;
+				_datagram_socket = socket_list.front();
+				_datagram_socket_list = std::move(socket_list);
+				_address = address;
+
+				return true;
+			}
+
+			// Rollback
+			for (auto &socket : socket_list)
+			{
 				_socket_pool->ReleaseSocket(socket);
 			}
 
@@ -285,18 +360,32 @@ void PhysicalPort::OnDatagram(const std::shared_ptr<ov::DatagramSocket> &client,
 	}
 }
 
-bool PhysicalPort::Close()
+void PhysicalPort::OnDatagrams(const std::shared_ptr<ov::DatagramSocket> &client, const ov::Datagram *datagrams, size_t count)
 {
-	auto socket = GetSocket();
+	// Notify observers
+	for (auto &observer : _observer_list)
+	{
+		observer->OnDatagramsReceived(client, datagrams, count);
+	}
+}
 
-	if (socket != nullptr)
+bool PhysicalPort::Close()
+{
+	for (auto &socket : _server_socket_list)
 	{
 		_socket_pool->ReleaseSocket(socket);
+	}
 
-		_server_socket = nullptr;
-		_datagram_socket = nullptr;
+	for (auto &socket : _datagram_socket_list)
+	{
+		_socket_pool->ReleaseSocket(socket);
 	}
 
+	_server_socket_list.clear();
+	_datagram_socket_list.clear();
+	_server_socket = nullptr;
+	_datagram_socket = nullptr;
+
 	_socket_pool->Uninitialize();
 	_socket_pool = nullptr;
 
@@ -383,6 +472,11 @@ ov::String PhysicalPort::ToString() const
 		description.AppendFormat(", socket: %s", _server_socket->ToString().CStr());
 	}
 
+	if (GetSocketCount() > 1)
+	{
+		description.AppendFormat(", reuse_port: %zu sockets", GetSocketCount());
+	}
+
 	description.Append('>');
 
 	return description;
@@ -43,7 +43,9 @@ public:
 				bool thread_per_socket,
 				int send_buffer_size,
 				int recv_buffer_size,
-				const OnSocketCreated on_socket_created);
+				const OnSocketCreated on_socket_created,
+				bool reuse_port = false,
+				bool cpu_affinity = false);
 
 	bool Close();
 
@@ -82,6 +84,12 @@ public:
 		return _socket_pool->GetWorkerCount();
 	}
 
+	// Number of listening sockets (greater than 1 if SO_REUSEPORT is used)
+	size_t GetSocketCount() const
+	{
+		return (_type == ov::SocketType::Udp) ? _datagram_socket_list.size() : _server_socket_list.size();
+	}
+
 	bool AddObserver(PhysicalPortObserver *observer);
 
 	bool RemoveObserver(PhysicalPortObserver *observer);
@@ -96,14 +104,19 @@ protected:
 							bool thread_per_socket,
 							int send_buffer_size,
 							int recv_buffer_size,
-							const OnSocketCreated on_socket_created);
+							const OnSocketCreated on_socket_created,
+							bool reuse_port);
 
 	bool CreateDatagramSocket(const char *name,
 							  ov::SocketType type,
 							  const ov::SocketAddress &address,
 							  int worker_count,
 							  bool thread_per_socket,
-							  const OnSocketCreated on_socket_created);
+							  const OnSocketCreated on_socket_created,
+							  bool reuse_port);
+
+	// Wraps on_socket_created to set SO_REUSEPORT before the socket is bound
+	static OnSocketCreated MakeReusePortCallback(const OnSocketCreated on_socket_created);
 
 	// For TCP physical port
 	void OnClientConnectionStateChanged(const std::shared_ptr<ov::ClientSocket> &client, ov::SocketConnectionState state, const std::shared_ptr<ov::Error> &error);
@@ -111,6 +124,7 @@ protected:
 
 	// For UDP physical port
 	void OnDatagram(const std::shared_ptr<ov::DatagramSocket> &client, const ov::SocketAddressPair &address_pair, const std::shared_ptr<ov::Data> &data);
+	void OnDatagrams(const std::shared_ptr<ov::DatagramSocket> &client, const ov::Datagram *datagrams, size_t count);
 
 	ov::String _name;
 	std::shared_ptr<ov::SocketPool> _socket_pool;
@@ -118,9 +132,14 @@ protected:
 	ov::SocketType _type = ov::SocketType::Unknown;
 	ov::SocketAddress _address;
 
+	// The first socket of the list (_server_socket_list or _datagram_socket_list)
 	std::shared_ptr<ov::ServerSocket> _server_socket;
 	std::shared_ptr<ov::DatagramSocket> _datagram_socket;
 
+	// If SO_REUSEPORT is used, each worker of _socket_pool has its own listening socket
+	std::vector<std::shared_ptr<ov::ServerSocket>> _server_socket_list;
+	std::vector<std::shared_ptr<ov::DatagramSocket>> _datagram_socket_list;
+
 	std::atomic<int> _ref_count{0};
 
 	// Because the life cycle of PhysicalPort is the same as that of the OME now, we do not need to use mutex for _observer_list
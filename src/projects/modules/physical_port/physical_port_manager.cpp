@@ -8,6 +8,8 @@
 //==============================================================================
 #include "physical_port_manager.h"
 
+#include <config/config.h>
+
 #include "physical_port_private.h"
 
 PhysicalPortManager::PhysicalPortManager()
@@ -40,9 +42,26 @@ std::shared_ptr<PhysicalPort> PhysicalPortManager::CreatePort(const char *name,
 
 	if (item == _port_list.end())
 	{
+		bool reuse_port = false;
+		bool cpu_affinity = false;
+
+		// SO_REUSEPORT is only meaningful when several workers share a TCP/UDP port
+		if ((type != ov::SocketType::Srt) && (thread_per_socket == false) && (worker_count > 1))
+		{
+			auto server_config = cfg::ConfigManager::GetInstance()->GetServer();
+
+			if (server_config != nullptr)
+			{
+				auto &reuse_port_config = server_config->GetModules().GetReusePort();
+
+				reuse_port = reuse_port_config.IsEnabled();
+				cpu_affinity = reuse_port && reuse_port_config.IsCpuAffinityEnabled();
+			}
+		}
+
 		port = std::make_shared<PhysicalPort>(PhysicalPort::PrivateToken{nullptr});
 
-		if (port->Create(name, type, address, worker_count, thread_per_socket, send_buffer_size, recv_buffer_size, on_socket_created))
+		if (port->Create(name, type, address, worker_count, thread_per_socket, send_buffer_size, recv_buffer_size, on_socket_created, reuse_port, cpu_affinity))
 		{
 			_port_list[key] = port;
 		}
@@ -48,6 +48,16 @@ public:
 	// Called when the packet is received (Only used when UDP)
 	virtual void OnDatagramReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddressPair &address_pair, const std::shared_ptr<const ov::Data> &data) {}
 
+	// Called with the datagrams received by a single recvmmsg() (Only used when UDP)
+	// By default, OnDatagramReceived() is called for each datagram
+	virtual void OnDatagramsReceived(const std::shared_ptr<ov::Socket> &remote, const ov::Datagram *datagrams, size_t count)
+	{
+		for (size_t index = 0; index < count; index++)
+		{
+			OnDatagramReceived(remote, datagrams[index].address_pair, datagrams[index].data);
+		}
+	}
+
 	// Called when the client is disconnected
 	virtual void OnDisconnected(const std::shared_ptr<ov::Socket> &remote, PhysicalPortDisconnectReason reason, const std::shared_ptr<const ov::Error> &error) {}
 
@@ -9,7 +9,7 @@ RtcpSRGenerator::RtcpSRGenerator(uint32_t ssrc, uint32_t codec_rate)
     _last_generated_time = std::chrono::system_clock::now();
 }
 
-void RtcpSRGenerator::AddRTPPacketInfo(const std::shared_ptr<RtpPacket> &rtp_packet)
+void RtcpSRGenerator::AddRTPPacketInfo(const std::shared_ptr<const RtpPacket> &rtp_packet)
 {
     _packet_count ++;
     _octec_count += rtp_packet->PayloadSize();
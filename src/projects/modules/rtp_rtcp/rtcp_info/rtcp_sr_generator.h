@@ -9,7 +9,7 @@ class RtcpSRGenerator
 public:
     RtcpSRGenerator(uint32_t ssrc, uint32_t codec_rate);
 
-	void AddRTPPacketInfo(const std::shared_ptr<RtpPacket> &rtp_packet);
+	void AddRTPPacketInfo(const std::shared_ptr<const RtpPacket> &rtp_packet);
 	bool IsAvailableRtcpSRPacket() const;
 	std::shared_ptr<RtcpPacket> PopRtcpSRPacket();
 	
@@ -1,67 +1,76 @@
 #include "rtp_history.h"
 
 RtpHistory::RtpHistory(uint8_t origin_payload_type, uint8_t rtx_payload_type, uint32_t rtx_ssrc, uint32_t max_history_size)
+	// Slot is not movable, so the slots are created here
+	: _slots(std::max<uint32_t>(max_history_size, 1))
 {
 	_origin_paylod_type = origin_payload_type;
 	_rtx_paylod_type = rtx_payload_type;
 	_rtx_ssrc = rtx_ssrc;
-	_max_history_size = max_history_size;
-
-	_history.reserve(_max_history_size);
+	_max_history_size = std::max<uint32_t>(max_history_size, 1);
 }
 
-// Converting to RtxRtpPacket
-bool RtpHistory::StoreRtpPacket(const std::shared_ptr<RtpPacket> &packet)
+bool RtpHistory::StoreRtpPacket(const std::shared_ptr<const RtpPacket> &packet)
 {
-	std::lock_guard<std::shared_mutex> guard(_history_lock);
+	auto &slot = _slots[GetIndex(packet->SequenceNumber())];
+
+	// The old packets are released after the lock is released
+	std::shared_ptr<const RtpPacket> old_packet;
+	std::shared_ptr<const RtxRtpPacket> old_rtx_packet;
+
+	{
+		std::lock_guard<std::mutex> lock_guard(slot.lock);
+
+		// The RTX packet of the previous packet is not valid anymore
+		old_packet = std::move(slot.packet);
+		old_rtx_packet = std::move(slot.rtx_packet);
 
-	_history[GetIndex(packet->SequenceNumber())] = packet;
+		slot.packet = packet;
+	}
 
 	return true;
 }
 
-std::shared_ptr<RtxRtpPacket> RtpHistory::GetRtxRtpPacket(uint16_t seq_no)
+std::shared_ptr<const RtxRtpPacket> RtpHistory::GetRtxRtpPacket(uint16_t seq_no)
 {
-	auto index = GetIndex(seq_no);
+	auto &slot = _slots[GetIndex(seq_no)];
+
+	std::shared_ptr<const RtpPacket> rtp_packet;
+	std::shared_ptr<const RtxRtpPacket> rtx_packet;
+
+	{
+		std::lock_guard<std::mutex> lock_guard(slot.lock);
+
+		rtp_packet = slot.packet;
+		rtx_packet = slot.rtx_packet;
+	}
+
+	// now, I consider all requests are valid because webrtc player doesn't ask for too old packet anyway
+	if ((rtp_packet == nullptr) || (rtp_packet->SequenceNumber() != seq_no))
+	{
+		return nullptr;
+	}
+
 	// First, look in the cache
-	std::shared_lock<std::shared_mutex> cache_read_guard(_history_cache_lock);
-	auto cache_item = _history_cache.find(index);
-	if(cache_item != _history_cache.end())
+	if ((rtx_packet != nullptr) && (rtx_packet->GetOriginalSequenceNumber() == seq_no))
 	{
-		// Found!
-		auto rtx_packet = cache_item->second;
-		
-		if(rtx_packet->GetOriginalSequenceNumber() == seq_no)// && ov::Clock::GetElapsedMiliSecondsFromNow(rtx_packet->GetCreatedTime()) < VALID_TIME_MS_STORED_RTP_PACKET)
-		{
-			return rtx_packet;
-		}
+		return rtx_packet;
 	}
-	cache_read_guard.unlock();
 
-	// find in rtp history
-	std::shared_lock<std::shared_mutex> history_guard(_history_lock);
-	auto rtp_item = _history.find(index);
-	if(rtp_item != _history.end())
+	// Create Rtx Packet outside of the lock, and store it if the slot still has the packet.
+	// If several sessions request it at the same time, the last one is kept.
+	rtx_packet = std::make_shared<const RtxRtpPacket>(GetRtxSsrc(), GetRtxPayloadType(), *rtp_packet);
+
 	{
-		auto rtp_packet = rtp_item->second;
-		history_guard.unlock();
+		std::lock_guard<std::mutex> lock_guard(slot.lock);
 
-		// now, I consider all requests are valid because webrtc player doesn't ask for too old packet anyway 
-		//auto elapsed_ms = ov::Clock::GetElapsedMiliSecondsFromNow(rtp_packet->GetCreatedTime());
-		//if(elapsed_ms < VALID_TIME_MS_STORED_RTP_PACKET)
-		if(rtp_packet->SequenceNumber() == seq_no)
+		if (slot.packet == rtp_packet)
 		{
-			// Create Rtx Packet and store it
-			auto rtx_packet = std::make_shared<RtxRtpPacket>(GetRtxSsrc(), GetRtxPayloadType(), *rtp_packet);
-
-			std::lock_guard<std::shared_mutex> cache_write_guard(_history_cache_lock);
-			_history_cache[index] = rtx_packet;
-			
-			return rtx_packet;
+			slot.rtx_packet = rtx_packet;
 		}
 	}
 
-	return nullptr;
+	return rtx_packet;
 }
 
 uint8_t	RtpHistory::GetOriginPayloadType()
@@ -82,4 +91,4 @@ uint8_t RtpHistory::GetRtxPayloadType()
 uint16_t RtpHistory::GetIndex(uint16_t seq_no)
 {
 	return seq_no % _max_history_size;
-}
\ No newline at end of file
+}
@@ -13,9 +13,9 @@ class RtpHistory
 public:
 	RtpHistory(uint8_t origin_payload_type, uint8_t rtx_payload_type, uint32_t rtx_ssrc, uint32_t max_history_size = DEFAULT_MAX_HISTORY_CAPACITY);
 
-	// Converting to RtxRtpPacket
-	bool StoreRtpPacket(const std::shared_ptr<RtpPacket> &packet);
-	std::shared_ptr<RtxRtpPacket> GetRtxRtpPacket(uint16_t seq_no);
+	// The packet is stored by reference (it is shared with the sessions), it is converted to RtxRtpPacket when requested
+	bool StoreRtpPacket(const std::shared_ptr<const RtpPacket> &packet);
+	std::shared_ptr<const RtxRtpPacket> GetRtxRtpPacket(uint16_t seq_no);
 
 	uint8_t	GetOriginPayloadType();
 	uint32_t GetRtxSsrc();
@@ -23,30 +23,34 @@ public:
 
 private:
 	uint16_t GetIndex(uint16_t seq_no);
-	
-	// This map maps a hash(made with "origin sequence number" % max_history_size) and an RtpPacket.
-	// And this map never erases items for performance reason. 
-
-	// Yes, this map will have a collision once per max_history_size. 
-	// However, the default value of 9600 is a very large value, and collision packets 
-	// with 9600 sequence number differences are very old packets. 
-	// Since RTP packets have a creation time, old packets may not be used. 
-	// This can avoid collision. Therefore, set max_history_size to a large value as possible.
-	std::shared_mutex	_history_lock;
-	std::unordered_map<uint16_t, std::shared_ptr<RtpPacket>> _history;
-
-	// Creating RtxRtpPacket requires computing resources, but not all of them are used
-	// (only for packets requested by the session with NACK). 
-	// Therefore, it is unnecessary to create all packets with RtxRtpPacket in advance. 
-	// It is also wasteful to create another RtxRtpPacket once created. 
-	// When GetRtxRtpPacket() is called, it first looks for a packet in the cache and 
-	// checks if it is valid (by creation time). 
-	// If it is not valid, a new RtxRtpPacket is created, cached, and returned.
-	std::shared_mutex	_history_cache_lock;
-	std::unordered_map<uint16_t, std::shared_ptr<RtxRtpPacket>> _history_cache;
+
+	// Fixed-capacity ring indexed by "origin sequence number" % max_history_size.
+	// A slot is overwritten by the packet max_history_size packets later, so the sequence number of the packet
+	// is compared with the requested one. Set max_history_size to a large value to keep packets longer.
+	//
+	// The packets are stored by one thread (the packetizer) and looked up by many sessions (NACK),
+	// so each slot has its own lock, held only to copy the pointers. A packet and a NACK contend only when
+	// they hit the same slot.
+	//
+	// A seqlock cannot be used here: a reader copying the shared_ptr while the slot is overwritten would
+	// increase the reference count of a packet that the writer may have already released. Publishing
+	// immutable entries through atomic pointers (ov::EpochReclaimer) would need a retirement (and a
+	// process-wide memory barrier) for every stored packet, which costs far more than an uncontended lock.
+	struct Slot
+	{
+		std::mutex lock;
+		std::shared_ptr<const RtpPacket> packet;
+
+		// Creating RtxRtpPacket requires computing resources, but not all of them are used
+		// (only for packets requested by the session with NACK).
+		// Therefore, it is created when GetRtxRtpPacket() is called for the first time,
+		// and the same RtxRtpPacket is shared by all sessions requesting the packet.
+		std::shared_ptr<const RtxRtpPacket> rtx_packet;
+	};
+	std::vector<Slot> _slots;
 
 	uint8_t		_origin_paylod_type;
 	uint32_t	_rtx_ssrc;
 	uint8_t		_rtx_paylod_type;
 	uint32_t	_max_history_size;
-};
\ No newline at end of file
+};
@@ -112,6 +112,30 @@ bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
 		return false;
 	}
 
+	UpdateSenderReportInternal(rtp_packet);
+
+	// Send RTP
+	_last_sent_rtp_packet = rtp_packet;
+	return SendDataToNextNode(NodeType::Rtp, rtp_packet->GetData());
+}
+
+bool RtpRtcp::UpdateSenderReport(const std::shared_ptr<const RtpPacket> &rtp_packet)
+{
+	std::shared_lock<std::shared_mutex> lock(_state_lock);
+	// nothing to do before node start
+	if(GetNodeState() != ov::Node::NodeState::Started)
+	{
+		logtd("Node has not started, so the received data has been canceled.");
+		return false;
+	}
+
+	UpdateSenderReportInternal(rtp_packet);
+
+	return true;
+}
+
+void RtpRtcp::UpdateSenderReportInternal(const std::shared_ptr<const RtpPacket> &rtp_packet)
+{
 	// RTCP(SR + SR + SDES + SDES)
 	auto it = _rtcp_sr_generators.find(rtp_packet->Ssrc());
     if(it != _rtcp_sr_generators.end())
@@ -155,10 +179,6 @@ bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
 			logd("RTCP", "Send RTCP succeed : pt(%d) ssrc(%u) length(%d)", rtp_packet->PayloadType(), rtp_packet->Ssrc(), compound_rtcp_data->GetLength());
 		}
 	}
-
-	// Send RTP
-	_last_sent_rtp_packet = rtp_packet;
-	return SendDataToNextNode(NodeType::Rtp, rtp_packet->GetData());
 }
 
 bool RtpRtcp::SendPLI(uint32_t track_id)
@@ -62,6 +62,9 @@ public:
 	bool Stop() override;
 
 	bool SendRtpPacket(const std::shared_ptr<RtpPacket> &packet);
+	// For the RTP packets that the caller assembles and sends without this node (e.g. the packet is shared by many sessions).
+	// Counts the packet in the sender report and sends RTCP SR/SDES to the next node when it is time.
+	bool UpdateSenderReport(const std::shared_ptr<const RtpPacket> &packet);
 	bool SendPLI(uint32_t track_id);
 	bool SendFIR(uint32_t track_id);
 
@@ -84,6 +87,9 @@ private:
 	bool OnRtpReceived(NodeType from_node, const std::shared_ptr<const ov::Data> &data);
 	bool OnRtcpReceived(NodeType from_node, const std::shared_ptr<const ov::Data> &data);
 
+	// _state_lock must be held
+	void UpdateSenderReportInternal(const std::shared_ptr<const RtpPacket> &rtp_packet);
+
 	std::shared_ptr<RtpFrameJitterBuffer> GetJitterBuffer(uint8_t payload_type);
 
 	std::shared_ptr<RtcpPacket> GenerateTransportCcFeedbackIfNeeded();
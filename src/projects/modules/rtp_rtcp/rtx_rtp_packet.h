@@ -24,11 +24,11 @@ public:
 	RtxRtpPacket(uint32_t rtx_ssrc, uint8_t rtx_payload_type, const RtpPacket &src);
 	RtxRtpPacket(const RtxRtpPacket &src);
 
-	uint8_t GetOriginalPayloadType()
+	uint8_t GetOriginalPayloadType() const
 	{
 		return _origin_payload_type;
 	}
-	uint16_t GetOriginalSequenceNumber()
+	uint16_t GetOriginalSequenceNumber() const
 	{
 		return _origin_seq_no;
 	}
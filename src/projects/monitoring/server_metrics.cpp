@@ -1,5 +1,6 @@
 #include "server_metrics.h"
 
+#include <base/ovcrypto/ovcrypto.h>
 #include <malloc.h>
 #include <orchestrator/orchestrator.h>
 
@@ -211,4 +212,51 @@ namespace mon
 
 		return _queues[queue_info.GetId()];
 	}
+
+	ov::MemoryPool::Stats ServerMetrics::GetMemoryPoolStats() const
+	{
+		return ov::MemoryPool::GetInstance()->GetStats();
+	}
+
+	void ServerMetrics::OnChunklistCacheHit()
+	{
+		_chunklist_cache_hit_count++;
+	}
+
+	void ServerMetrics::OnChunklistCacheMiss()
+	{
+		_chunklist_cache_miss_count++;
+	}
+
+	ServerMetrics::ChunklistCacheStats ServerMetrics::GetChunklistCacheStats() const
+	{
+		ChunklistCacheStats stats;
+
+		stats.hit_count = _chunklist_cache_hit_count;
+		stats.miss_count = _chunklist_cache_miss_count;
+
+		return stats;
+	}
+
+	ServerMetrics::LogStats ServerMetrics::GetLogStats() const
+	{
+		LogStats stats;
+
+		stats.dropped_count = ::ov_log_get_dropped_count();
+
+		return stats;
+	}
+
+	ServerMetrics::KtlsStats ServerMetrics::GetKtlsStats() const
+	{
+		KtlsStats stats;
+
+		auto ktls_stats = ov::TlsServerData::GetKtlsStats();
+
+		stats.requested_count = ktls_stats.requested_count;
+		stats.enabled_count = ktls_stats.enabled_count;
+		stats.fallback_count = ktls_stats.fallback_count;
+
+		return stats;
+	}
 }  // namespace mon
\ No newline at end of file
@@ -50,5 +50,57 @@ namespace mon
 	protected:
 		std::shared_mutex _queue_map_guard;
 		std::map<uint32_t, std::shared_ptr<QueueMetrics>> _queues;
+
+		// Memory pool metrics
+	public:
+		// Hit/miss/bytes-in-use counters of ov::MemoryPool (ov::Data buffers, MediaPacket)
+		ov::MemoryPool::Stats GetMemoryPoolStats() const;
+
+		// LL-HLS chunklist cache metrics
+	public:
+		struct ChunklistCacheStats
+		{
+			uint64_t hit_count = 0;
+			uint64_t miss_count = 0;
+
+			double GetHitRatio() const
+			{
+				auto total = hit_count + miss_count;
+				return (total > 0) ? (static_cast<double>(hit_count) / static_cast<double>(total)) : 0.0;
+			}
+		};
+
+		// A chunklist request is served from the rendered variants of the chunklist (hit) or rendered (miss)
+		void OnChunklistCacheHit();
+		void OnChunklistCacheMiss();
+		ChunklistCacheStats GetChunklistCacheStats() const;
+
+	protected:
+		std::atomic<uint64_t> _chunklist_cache_hit_count{0};
+		std::atomic<uint64_t> _chunklist_cache_miss_count{0};
+
+		// Logger metrics
+	public:
+		struct LogStats
+		{
+			// Number of logs discarded because the queue of the asynchronous logger was full
+			uint64_t dropped_count = 0;
+		};
+
+		LogStats GetLogStats() const;
+
+		// kTLS (kernel TLS) metrics of the TLS connections
+	public:
+		struct KtlsStats
+		{
+			// Number of connections that requested kTLS
+			uint64_t requested_count = 0;
+			// Number of connections whose records are encrypted by the kernel
+			uint64_t enabled_count = 0;
+			// Number of connections that fell back to user space encryption
+			uint64_t fallback_count = 0;
+		};
+
+		KtlsStats GetKtlsStats() const;
 	};
 }  // namespace mon
\ No newline at end of file
@@ -340,6 +340,39 @@ namespace pvd
 		PushProvider::OnDataReceived(channel_id, data);
 	}
 
+	void MpegTsProvider::OnDatagramsReceived(const std::shared_ptr<ov::Socket> &remote,
+											 const ov::Datagram *datagrams,
+											 size_t count)
+	{
+		auto local_port = remote->GetLocalAddress()->Port();
+		auto channel_id = remote->GetNativeHandle();
+
+		// The port is looked up once for the batch
+		auto stream_port_item = GetStreamPortItem(local_port);
+		if (stream_port_item == nullptr)
+		{
+			logtc("Could not find StreamPortItem matching");  // %s", remote->ToString().CStr());
+			return;
+		}
+
+		// Each datagram is passed as is (without joining), so every datagram is attributed to its own sender
+		for (size_t index = 0; index < count; index++)
+		{
+			const auto &datagram = datagrams[index];
+
+			// UDP
+			if (stream_port_item->IsClientConnected() == false)
+			{
+				if (OnConnected(remote, datagram.address_pair.GetRemoteAddress()) == false)
+				{
+					continue;
+				}
+			}
+
+			PushProvider::OnDataReceived(channel_id, datagram.data);
+		}
+	}
+
 	void MpegTsProvider::OnTimedOut(const std::shared_ptr<PushStream> &channel)
 	{
 		auto mpegts_stream = std::dynamic_pointer_cast<MpegTsStream>(channel);
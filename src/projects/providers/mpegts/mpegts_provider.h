@@ -176,6 +176,9 @@ namespace pvd
 		void OnDatagramReceived(const std::shared_ptr<ov::Socket> &remote,
 								const ov::SocketAddressPair &address_pair,
 								const std::shared_ptr<const ov::Data> &data) override;
+		void OnDatagramsReceived(const std::shared_ptr<ov::Socket> &remote,
+								 const ov::Datagram *datagrams,
+								 size_t count) override;
 
 		void OnDisconnected(const std::shared_ptr<ov::Socket> &remote,
 							PhysicalPortDisconnectReason reason,
@@ -1688,7 +1688,7 @@ namespace pvd
 			}
 
 			auto data		 = std::make_shared<ov::Data>(flv_video.Payload(), flv_video.PayloadLength());
-			auto video_frame = std::make_shared<MediaPacket>(GetMsid(),
+			auto video_frame = ov::MakePooledShared<MediaPacket>(GetMsid(),
 															 cmn::MediaType::Video,
 															 RTMP_VIDEO_TRACK_ID,
 															 data,
@@ -1875,7 +1875,7 @@ namespace pvd
 				}
 			}
 
-			auto frame = std::make_shared<MediaPacket>(GetMsid(),
+			auto frame = ov::MakePooledShared<MediaPacket>(GetMsid(),
 													   cmn::MediaType::Audio,
 													   RTMP_AUDIO_TRACK_ID,
 													   data,
@@ -47,7 +47,7 @@ namespace pvd::rtmp
 		cmn::PacketType packet_type,
 		bool is_key_frame)
 	{
-		auto media_packet = std::make_shared<MediaPacket>(
+		auto media_packet = ov::MakePooledShared<MediaPacket>(
 			_stream->GetMsid(),
 			GetMediaType(),
 			_track_id,
@@ -1090,7 +1090,7 @@ namespace pvd
 		logtd("Channel(%d) Payload Type(%d) Ssrc(%u) Timestamp(%u) PTS(%lld) Time scale(%f) Adjust Timestamp(%f)",
 			  channel, first_rtp_packet->PayloadType(), first_rtp_packet->Ssrc(), first_rtp_packet->Timestamp(), adjusted_timestamp, track->GetTimeBase().GetExpr(), static_cast<double>(adjusted_timestamp) * track->GetTimeBase().GetExpr());
 
-		auto frame = std::make_shared<MediaPacket>(GetMsid(),
+		auto frame = ov::MakePooledShared<MediaPacket>(GetMsid(),
 												   track->GetMediaType(),
 												   track->GetId(),
 												   bitstream,
@@ -1106,7 +1106,7 @@ namespace pvd
 		// Send SPS/PPS if stream is H264
 		if (_sent_sequence_header == false && track->GetCodecId() == cmn::MediaCodecId::H264 && _h264_extradata_nalu != nullptr)
 		{
-			auto media_packet = std::make_shared<MediaPacket>(GetMsid(),
+			auto media_packet = ov::MakePooledShared<MediaPacket>(GetMsid(),
 															  track->GetMediaType(),
 															  track->GetId(),
 															  _h264_extradata_nalu,
@@ -1122,7 +1122,7 @@ namespace pvd
 		// Send VPS/SPS/PPS if stream is H265
 		else if (_sent_sequence_header == false && track->GetCodecId() == cmn::MediaCodecId::H265 && _h265_extradata_nalu != nullptr)
 		{
-			auto media_packet = std::make_shared<MediaPacket>(GetMsid(),
+			auto media_packet = ov::MakePooledShared<MediaPacket>(GetMsid(),
 															  track->GetMediaType(),
 															  track->GetId(),
 															  _h265_extradata_nalu,
@@ -36,7 +36,22 @@ void HlsMediaPlaylist::AddMediaTrackInfo(const std::shared_ptr<MediaTrack> &trac
 
 void HlsMediaPlaylist::SetEndList()
 {
+	std::lock_guard<std::shared_mutex> lock(_segments_mutex);
+
 	_end_list = true;
+	UpdateRevision();
+}
+
+void HlsMediaPlaylist::UpdateRevision()
+{
+	_revision++;
+	_last_modified_time = std::chrono::system_clock::now();
+}
+
+uint64_t HlsMediaPlaylist::GetRevision() const
+{
+	std::shared_lock<std::shared_mutex> lock(_segments_mutex);
+	return _revision;
 }
 
 bool HlsMediaPlaylist::OnSegmentCreated(const std::shared_ptr<mpegts::Segment> &segment)
@@ -53,6 +68,7 @@ bool HlsMediaPlaylist::OnSegmentCreated(const std::shared_ptr<mpegts::Segment> &
 	}
 
 	_segments.emplace(segment->GetNumber(), segment);
+	UpdateRevision();
 
 	return true;
 }
@@ -71,14 +87,26 @@ bool HlsMediaPlaylist::OnSegmentDeleted(const std::shared_ptr<mpegts::Segment> &
 	}
 
 	_segments.erase(it);
+	UpdateRevision();
 
 	return true;
 }
 
 ov::String HlsMediaPlaylist::ToString(bool rewind) const
+{
+	uint64_t revision;
+	std::chrono::system_clock::time_point last_modified_time;
+
+	return ToString(rewind, revision, last_modified_time);
+}
+
+ov::String HlsMediaPlaylist::ToString(bool rewind, uint64_t &revision, std::chrono::system_clock::time_point &last_modified_time) const
 {
 	std::shared_lock<std::shared_mutex> lock(_segments_mutex);
 
+	revision = _revision;
+	last_modified_time = _last_modified_time;
+
 	ov::String result = "#EXTM3U\n";
 
 	result += ov::String::FormatString("#EXT-X-VERSION:%d\n", 3);
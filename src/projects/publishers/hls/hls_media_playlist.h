@@ -48,6 +48,10 @@ public:
 	ov::String GetCodecsString() const;
 
 	ov::String ToString(bool rewind) const;
+	// <revision> and <last_modified_time> are of the returned playlist
+	ov::String ToString(bool rewind, uint64_t &revision, std::chrono::system_clock::time_point &last_modified_time) const;
+	// Increased whenever the playlist is changed
+	uint64_t GetRevision() const;
 	ov::String MakeSegmentString(const std::shared_ptr<mpegts::Segment> &segment) const;
 	std::shared_ptr<mpegts::Segment> GetLatestSegment() const;
 
@@ -71,4 +75,11 @@ private:
 	int64_t _wallclock_offset_ms = INT64_MIN;
 
 	bool _end_list = false;
+
+	// Protected by _segments_mutex
+	uint64_t _revision = 0;
+	std::chrono::system_clock::time_point _last_modified_time = std::chrono::system_clock::now();
+
+	// Must be called with _segments_mutex held exclusively
+	void UpdateRevision();
 };
\ No newline at end of file
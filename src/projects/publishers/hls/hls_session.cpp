@@ -331,12 +331,11 @@ void HlsSession::ResponseMasterPlaylist(const std::shared_ptr<http::svr::HttpExc
 
 	bool rewind_option = GetRewindOptionValue(request_url);
 
-	auto [result, master_playlist] = stream->GetMasterPlaylistData(playlist, rewind_option);
+	auto [result, master_playlist] = stream->GetMasterPlaylistResponse(playlist, rewind_option);
 	if (result == HlsStream::RequestResult::Success)
 	{
-		response->SetStatusCode(http::StatusCode::OK);
-		response->SetHeader("Content-Type", "application/vnd.apple.mpegurl");
-		response->AppendData(master_playlist);
+		ResponseCachedData(exchange, "application/vnd.apple.mpegurl", master_playlist);
+		return;
 	}
 	else if (result == HlsStream::RequestResult::NotFound)
 	{
@@ -362,12 +361,11 @@ void HlsSession::ResponseMediaPlaylist(const std::shared_ptr<http::svr::HttpExch
 	auto request_url = request->GetParsedUri();
 	auto response = exchange->GetResponse();
 	bool rewind_option = GetRewindOptionValue(request_url);
-	auto [result, media_playlist] = stream->GetMediaPlaylistData(variant_name, rewind_option);
+	auto [result, media_playlist] = stream->GetMediaPlaylistResponse(variant_name, rewind_option);
 	if (result == HlsStream::RequestResult::Success)
 	{
-		response->SetStatusCode(http::StatusCode::OK);
-		response->SetHeader("Content-Type", "application/vnd.apple.mpegurl");
-		response->AppendData(media_playlist);
+		ResponseCachedData(exchange, "application/vnd.apple.mpegurl", media_playlist);
+		return;
 	}
 	else if (result == HlsStream::RequestResult::NotFound)
 	{
@@ -391,12 +389,35 @@ void HlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange>
 
 	auto response = exchange->GetResponse();
 
-	auto [result, segment] = stream->GetSegmentData(variant_name, number);
+	// Segments in memory are shared by all sessions
+	auto [cached_result, cached_segment] = stream->GetCachedSegmentResponse(variant_name, number);
+	if (cached_result == HlsStream::RequestResult::Success)
+	{
+		ResponseCachedData(exchange, "video/mp2t", cached_segment);
+		return;
+	}
+
+	// Segments stored on disk are sent from the file without being loaded into memory
+	auto file_region = stream->GetSegmentFileRegion(variant_name, number);
+	if (file_region != nullptr)
+	{
+		auto segment = std::make_shared<HlsStream::CachedResponse>();
+		segment->etag = stream->GetSegmentEtag(variant_name, number, file_region->GetLength());
+
+		ResponseCachedData(exchange, "video/mp2t", segment, file_region);
+		return;
+	}
+
+	// Segments that are not cached (e.g. retained after deletion)
+	auto [result, segment_data] = stream->GetSegmentData(variant_name, number);
 	if (result == HlsStream::RequestResult::Success)
 	{
-		response->SetStatusCode(http::StatusCode::OK);
-		response->SetHeader("Content-Type", "video/mp2t");
-		response->AppendData(segment);
+		auto segment = std::make_shared<HlsStream::CachedResponse>();
+		segment->data = segment_data;
+		segment->etag = stream->GetSegmentEtag(variant_name, number, segment_data->GetLength());
+
+		ResponseCachedData(exchange, "video/mp2t", segment);
+		return;
 	}
 	else if (result == HlsStream::RequestResult::NotFound)
 	{
@@ -410,6 +431,195 @@ void HlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange>
 	ResponseData(exchange);
 }
 
+void HlsSession::ResponseCachedData(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &content_type,
+									const std::shared_ptr<const HlsStream::CachedResponse> &cached, const std::shared_ptr<const ov::FileRegion> &file_region)
+{
+	auto request = exchange->GetRequest();
+	auto response = exchange->GetResponse();
+
+	response->SetHeader("Content-Type", content_type);
+	// The payload is not hashed for each request
+	response->SetEtag(cached->etag);
+	if (cached->last_modified.IsEmpty() == false)
+	{
+		response->SetHeader("Last-Modified", cached->last_modified);
+	}
+
+	if (IsNotModified(request, cached))
+	{
+		response->SetStatusCode(http::StatusCode::NotModified);
+		ResponseData(exchange);
+		return;
+	}
+
+	response->SetHeader("Accept-Ranges", "bytes");
+
+	size_t length = (file_region != nullptr) ? file_region->GetLength() : cached->data->GetLength();
+	size_t offset = 0;
+	size_t range_length = length;
+
+	switch (GetRequestedRange(request, cached, length, offset, range_length))
+	{
+		case RangeResult::None:
+			response->SetStatusCode(http::StatusCode::OK);
+			break;
+
+		case RangeResult::Satisfiable:
+			response->SetStatusCode(http::StatusCode::PartialContent);
+			response->SetHeader("Content-Range", ov::String::FormatString("bytes %zu-%zu/%zu", offset, offset + range_length - 1, length));
+			break;
+
+		case RangeResult::NotSatisfiable:
+			response->SetStatusCode(http::StatusCode::RangeNotSatisfiable);
+			response->SetHeader("Content-Range", ov::String::FormatString("bytes */%zu", length));
+			ResponseData(exchange);
+			return;
+	}
+
+	// Subdata() and Subregion() share the payload
+	if (file_region != nullptr)
+	{
+		response->AppendFileRegion((range_length == length) ? file_region : file_region->Subregion(offset, range_length));
+	}
+	else
+	{
+		response->AppendData((range_length == length) ? cached->data : cached->data->Subdata(offset, range_length));
+	}
+
+	ResponseData(exchange);
+}
+
+bool HlsSession::IsNotModified(const std::shared_ptr<http::svr::HttpRequest> &request, const std::shared_ptr<const HlsStream::CachedResponse> &cached) const
+{
+	// If-Modified-Since is ignored if If-None-Match is present (RFC 9110 13.1.3)
+	auto if_none_match = request->GetHeader("If-None-Match");
+	if (if_none_match.IsEmpty() == false)
+	{
+		for (auto etag : if_none_match.Split(","))
+		{
+			etag = etag.Trim();
+
+			if (etag == "*")
+			{
+				return true;
+			}
+
+			// Weak comparison
+			if (etag.HasPrefix("W/"))
+			{
+				etag = etag.Substring(2);
+			}
+
+			if (etag == cached->etag)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	auto if_modified_since = request->GetHeader("If-Modified-Since");
+	if ((if_modified_since.IsEmpty() == false) && (cached->last_modified.IsEmpty() == false))
+	{
+		std::chrono::system_clock::time_point since;
+		if (ov::Converter::FromRFC7231String(if_modified_since, since) == false)
+		{
+			return false;
+		}
+
+		// HTTP dates have a resolution of one second
+		return std::chrono::time_point_cast<std::chrono::seconds>(cached->last_modified_time) <= since;
+	}
+
+	return false;
+}
+
+HlsSession::RangeResult HlsSession::GetRequestedRange(const std::shared_ptr<http::svr::HttpRequest> &request, const std::shared_ptr<const HlsStream::CachedResponse> &cached, size_t length, size_t &offset, size_t &range_length) const
+{
+	auto range = request->GetHeader("Range").Trim();
+	if (range.IsEmpty() || (range.HasPrefix("bytes=") == false))
+	{
+		return RangeResult::None;
+	}
+
+	// The Range header is ignored if the representation has been changed
+	auto if_range = request->GetHeader("If-Range").Trim();
+	if ((if_range.IsEmpty() == false) && (if_range != cached->etag) && (if_range != cached->last_modified))
+	{
+		return RangeResult::None;
+	}
+
+	auto range_spec = range.Substring(6).Trim();
+	auto hyphen = range_spec.IndexOf('-');
+	if ((range_spec.IndexOf(',') >= 0) || (hyphen < 0))
+	{
+		return RangeResult::None;
+	}
+
+	auto first = range_spec.Substring(0, hyphen).Trim();
+	auto last = range_spec.Substring(hyphen + 1).Trim();
+
+	auto is_number = [](const ov::String &value) -> bool {
+		if (value.IsEmpty())
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < value.GetLength(); i++)
+		{
+			if (::isdigit(static_cast<unsigned char>(value[i])) == 0)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	};
+
+	if (first.IsEmpty())
+	{
+		// bytes=-<suffix length>
+		if (is_number(last) == false)
+		{
+			return RangeResult::None;
+		}
+
+		auto suffix_length = static_cast<size_t>(::strtoull(last.CStr(), nullptr, 10));
+		if ((suffix_length == 0) || (length == 0))
+		{
+			return RangeResult::NotSatisfiable;
+		}
+
+		range_length = std::min(suffix_length, length);
+		offset = length - range_length;
+
+		return RangeResult::Satisfiable;
+	}
+
+	if ((is_number(first) == false) || ((last.IsEmpty() == false) && (is_number(last) == false)))
+	{
+		return RangeResult::None;
+	}
+
+	auto first_byte = static_cast<size_t>(::strtoull(first.CStr(), nullptr, 10));
+	if (first_byte >= length)
+	{
+		return RangeResult::NotSatisfiable;
+	}
+
+	auto last_byte = last.IsEmpty() ? (length - 1) : std::min(static_cast<size_t>(::strtoull(last.CStr(), nullptr, 10)), length - 1);
+	if (last_byte < first_byte)
+	{
+		return RangeResult::None;
+	}
+
+	offset = first_byte;
+	range_length = last_byte - first_byte + 1;
+
+	return RangeResult::Satisfiable;
+}
+
 void HlsSession::ResponseData(const std::shared_ptr<http::svr::HttpExchange> &exchange)
 {
 	auto response = exchange->GetResponse();
@@ -13,6 +13,8 @@
 
 #include <modules/access_control/access_controller.h>
 
+#include "hls_stream.h"
+
 #define MAX_PENDING_REQUESTS 10
 
 class HlsSession : public pub::Session
@@ -77,6 +79,23 @@ private:
 
 	void ResponseData(const std::shared_ptr<http::svr::HttpExchange> &exchange);
 
+	// Responds with the validators of <cached>: 304 for a conditional request, 206 for a range request.
+	// The payload is <file_region> if it is not nullptr, otherwise <cached->data>
+	void ResponseCachedData(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &content_type,
+							const std::shared_ptr<const HlsStream::CachedResponse> &cached, const std::shared_ptr<const ov::FileRegion> &file_region = nullptr);
+
+	enum class RangeResult : uint8_t
+	{
+		// No Range header or it is ignored, the whole payload is sent
+		None,
+		Satisfiable,
+		NotSatisfiable,
+	};
+
+	bool IsNotModified(const std::shared_ptr<http::svr::HttpRequest> &request, const std::shared_ptr<const HlsStream::CachedResponse> &cached) const;
+	// Only a single byte range is supported, multiple ranges are ignored (RFC 9110 14.2)
+	RangeResult GetRequestedRange(const std::shared_ptr<http::svr::HttpRequest> &request, const std::shared_ptr<const HlsStream::CachedResponse> &cached, size_t length, size_t &offset, size_t &range_length) const;
+
 	bool GetRewindOptionValue(const std::shared_ptr<ov::Url> &url) const;
 
 	// ID list of connections requesting this session
@@ -106,6 +106,8 @@ bool HlsStream::Start()
 
 	_default_option_rewind = _ts_config.GetDefaultQueryString().GetBoolValue("_HLS_rewind", kDefaultHlsRewind);
 
+	_etag_prefix = ov::String::FormatString("%x-%llx", GetId(), static_cast<unsigned long long>(ov::Clock::NowMSec()));
+
 	if (_ts_config.ShouldCreateDefaultPlaylist() == true)
 	{
 		CreateDefaultPlaylist();
@@ -163,6 +165,16 @@ bool HlsStream::Stop()
 
 	}
 
+	{
+		std::lock_guard<std::shared_mutex> lock(_segment_responses_guard);
+		_segment_responses.clear();
+	}
+
+	{
+		std::lock_guard<std::shared_mutex> lock(_media_playlist_responses_guard);
+		_media_playlist_responses.clear();
+	}
+
 	StopDumps();
 
 	return Stream::Stop();
@@ -501,6 +513,8 @@ void HlsStream::OnSegmentCreated(const ov::String &packager_id, const std::share
 		playlist->SetWallclockOffset(wallclock_offset_ms);
 	}
 
+	CacheSegmentResponse(packager_id, segment);
+
 	playlist->OnSegmentCreated(segment);
 
 	logtd("Playlist : %s", playlist->ToString(false).CStr());
@@ -518,6 +532,47 @@ void HlsStream::OnSegmentDeleted(const ov::String &packager_id, const std::share
 	}
 
 	playlist->OnSegmentDeleted(segment);
+
+	RemoveSegmentResponse(packager_id, segment->GetNumber());
+}
+
+void HlsStream::CacheSegmentResponse(const ov::String &variant_name, const std::shared_ptr<mpegts::Segment> &segment)
+{
+	auto data = segment->GetData();
+	if (data == nullptr)
+	{
+		return;
+	}
+
+	// The segment data is shared, not copied
+	auto response = std::make_shared<CachedResponse>();
+	response->data = data;
+	response->etag = GetSegmentEtag(variant_name, segment->GetNumber(), data->GetLength());
+
+	std::lock_guard<std::shared_mutex> lock(_segment_responses_guard);
+
+	auto &responses = _segment_responses[variant_name];
+	responses[segment->GetNumber()] = response;
+
+	// The packager keeps as many segments in memory as the segment count, and older segments are moved to disk (DVR) or deleted
+	auto max_count = static_cast<size_t>(std::max(_ts_config.GetSegmentCount(), 1));
+	while (responses.size() > max_count)
+	{
+		responses.erase(responses.begin());
+	}
+}
+
+void HlsStream::RemoveSegmentResponse(const ov::String &variant_name, uint32_t number)
+{
+	std::lock_guard<std::shared_mutex> lock(_segment_responses_guard);
+
+	auto it = _segment_responses.find(variant_name);
+	if (it == _segment_responses.end())
+	{
+		return;
+	}
+
+	it->second.erase(number);
 }
 
 bool HlsStream::CreatePackagers()
@@ -892,6 +947,103 @@ std::tuple<HlsStream::RequestResult, std::shared_ptr<const ov::Data>> HlsStream:
 	return std::make_tuple(RequestResult::Success, segment_data);
 }
 
+std::shared_ptr<ov::FileRegion> HlsStream::GetSegmentFileRegion(const ov::String &variant_name, uint32_t number)
+{
+	auto packager = GetPackager(variant_name);
+	if (packager == nullptr)
+	{
+		return nullptr;
+	}
+
+	return packager->GetSegmentFileRegion(number);
+}
+
+ov::String HlsStream::GetSegmentEtag(const ov::String &variant_name, uint32_t number, size_t length) const
+{
+	// A segment is never modified after it is created
+	return ov::String::FormatString("\"%s-%s-%u-%zx\"", _etag_prefix.CStr(), variant_name.CStr(), number, length);
+}
+
+std::tuple<HlsStream::RequestResult, std::shared_ptr<const HlsStream::CachedResponse>> HlsStream::GetMasterPlaylistResponse(const ov::String &playlist_name, bool rewind)
+{
+	// The master playlist is not cached because BANDWIDTH is updated with the measured bitrate
+	auto [result, data] = GetMasterPlaylistData(playlist_name, rewind);
+	if (result != RequestResult::Success)
+	{
+		return {result, nullptr};
+	}
+
+	auto response = std::make_shared<CachedResponse>();
+	response->data = data;
+	response->etag = ov::String::FormatString("\"%s-%zx-%zx\"", _etag_prefix.CStr(), std::hash<std::string_view>()(std::string_view(data->GetDataAs<char>(), data->GetLength())), data->GetLength());
+
+	return {RequestResult::Success, response};
+}
+
+std::tuple<HlsStream::RequestResult, std::shared_ptr<const HlsStream::CachedResponse>> HlsStream::GetMediaPlaylistResponse(const ov::String &variant_name, bool rewind)
+{
+	auto playlist = GetMediaPlaylist(variant_name);
+	if (playlist == nullptr)
+	{
+		return {RequestResult::NotFound, nullptr};
+	}
+
+	auto key = ov::String::FormatString("%s/%d", variant_name.CStr(), rewind);
+	auto revision = playlist->GetRevision();
+
+	{
+		std::shared_lock<std::shared_mutex> lock(_media_playlist_responses_guard);
+		auto it = _media_playlist_responses.find(key);
+		if ((it != _media_playlist_responses.end()) && (it->second.revision == revision))
+		{
+			return {RequestResult::Success, it->second.response};
+		}
+	}
+
+	// The revision of the rendered playlist may be newer than <revision>
+	std::chrono::system_clock::time_point last_modified_time;
+	auto data = playlist->ToString(rewind, revision, last_modified_time).ToData(false);
+	if (data == nullptr)
+	{
+		return {RequestResult::UnknownError, nullptr};
+	}
+
+	auto response = std::make_shared<CachedResponse>();
+	response->data = data;
+	response->etag = ov::String::FormatString("\"%s-%s-%d-%llx\"", _etag_prefix.CStr(), variant_name.CStr(), rewind, static_cast<unsigned long long>(revision));
+	response->last_modified = ov::Converter::ToRFC7231String(last_modified_time);
+	response->last_modified_time = last_modified_time;
+
+	std::lock_guard<std::shared_mutex> lock(_media_playlist_responses_guard);
+	auto &cached_playlist = _media_playlist_responses[key];
+	if ((cached_playlist.response == nullptr) || (cached_playlist.revision < revision))
+	{
+		cached_playlist.revision = revision;
+		cached_playlist.response = response;
+	}
+
+	return {RequestResult::Success, response};
+}
+
+std::tuple<HlsStream::RequestResult, std::shared_ptr<const HlsStream::CachedResponse>> HlsStream::GetCachedSegmentResponse(const ov::String &variant_name, uint32_t number)
+{
+	std::shared_lock<std::shared_mutex> lock(_segment_responses_guard);
+
+	auto responses_it = _segment_responses.find(variant_name);
+	if (responses_it == _segment_responses.end())
+	{
+		return {RequestResult::NotFound, nullptr};
+	}
+
+	auto it = responses_it->second.find(number);
+	if (it == responses_it->second.end())
+	{
+		return {RequestResult::NotFound, nullptr};
+	}
+
+	return {RequestResult::Success, it->second};
+}
+
 void HlsStream::InitializeAllDumps()
 {
 	auto dump_configs = _ts_config.GetDumps().GetDumps();
@@ -59,10 +59,34 @@ public:
 	void OnSegmentCreated(const ov::String &packager_id, const std::shared_ptr<mpegts::Segment> &segment) override;
 	void OnSegmentDeleted(const ov::String &packager_id, const std::shared_ptr<mpegts::Segment> &segment) override;
 
+	// Response shared by the sessions, it is not modified after it is created
+	struct CachedResponse
+	{
+		std::shared_ptr<const ov::Data> data;
+
+		// Strong validator (quoted)
+		ov::String etag;
+
+		// Empty if the response has no modification time
+		ov::String last_modified;
+		std::chrono::system_clock::time_point last_modified_time;
+	};
+
 	// Interface for HLS Session
 	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetMasterPlaylistData(const ov::String &playlist_name, bool rewind);
 	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetMediaPlaylistData(const ov::String &variant_name, bool rewind);
 	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetSegmentData(const ov::String &variant_name, uint32_t number);
+	// Returns the file of the segment stored on disk (DVR) to send it using sendfile(), nullptr if the segment is in memory
+	std::shared_ptr<ov::FileRegion> GetSegmentFileRegion(const ov::String &variant_name, uint32_t number);
+
+	// Responses with validators, for conditional and range requests
+	std::tuple<RequestResult, std::shared_ptr<const CachedResponse>> GetMasterPlaylistResponse(const ov::String &playlist_name, bool rewind);
+	// Rendered once per revision of the playlist
+	std::tuple<RequestResult, std::shared_ptr<const CachedResponse>> GetMediaPlaylistResponse(const ov::String &variant_name, bool rewind);
+	// Segments kept in memory by the packager are cached when they are created, NotFound if the segment is not cached
+	std::tuple<RequestResult, std::shared_ptr<const CachedResponse>> GetCachedSegmentResponse(const ov::String &variant_name, uint32_t number);
+	// The ETag of a segment is the same whether it is sent from memory or from disk
+	ov::String GetSegmentEtag(const ov::String &variant_name, uint32_t number, size_t length) const;
 
 	ov::String GetStreamId() const;
 
@@ -89,6 +113,9 @@ private:
 
 	bool CheckIfAllPlaylistReady();
 
+	void CacheSegmentResponse(const ov::String &variant_name, const std::shared_ptr<mpegts::Segment> &segment);
+	void RemoveSegmentResponse(const ov::String &variant_name, uint32_t number);
+
 	ov::Queue<std::shared_ptr<MediaPacket>> _initial_media_packet_buffer;
 
 	//////////////////////////
@@ -135,6 +162,23 @@ private:
 	std::map<ov::String, std::shared_ptr<HlsMediaPlaylist>> _media_playlists;
 	mutable std::shared_mutex _media_playlists_guard;
 
+	// Makes the ETags unique across restarts of the stream
+	ov::String _etag_prefix;
+
+	// variant name : (segment number : response)
+	// Only the segments in memory are cached, the others are sent from the packager
+	std::map<ov::String, std::map<uint32_t, std::shared_ptr<const CachedResponse>>> _segment_responses;
+	std::shared_mutex _segment_responses_guard;
+
+	struct CachedMediaPlaylist
+	{
+		uint64_t revision = 0;
+		std::shared_ptr<const CachedResponse> response;
+	};
+	// <variant name>/<rewind> : Media playlist
+	std::map<ov::String, CachedMediaPlaylist> _media_playlist_responses;
+	std::shared_mutex _media_playlist_responses_guard;
+
 	// ConcludeLive
 	// Append #EXT-X-ENDLIST all chunklists, and no more update segment and chunklist
 	bool _concluded = false;
@@ -11,6 +11,7 @@
 #include "llhls_private.h"
 #include <base/ovcrypto/base_64.h>
 #include <base/ovlibrary/zip.h>
+#include <monitoring/monitoring.h>
 
 LLHlsChunklist::LLHlsChunklist(const ov::String &url, const std::shared_ptr<const MediaTrack> &track, 
 							uint32_t segment_count, uint32_t target_duration, double part_target_duration, 
@@ -25,12 +26,14 @@ LLHlsChunklist::LLHlsChunklist(const ov::String &url, const std::shared_ptr<cons
 	_map_uri = map_uri;
 	_preload_hint_enabled = preload_hint_enabled;
 
+	_server_metrics = MonitorInstance->GetServerMetrics();
+
 	logtd("LLHLS Chunklist has been created. track(%s)", _track->GetVariantName().CStr());
 }
 
 LLHlsChunklist::~LLHlsChunklist()
 {
-	logtd("Chunklist has been deleted. %s", GetTrack()->GetVariantName().CStr());
+	logtd("Chunklist has been deleted. %s (variant cache hit ratio: %.2f%%)", GetTrack()->GetVariantName().CStr(), GetVariantCacheStats().GetHitRatio() * 100.0);
 }
 
 // Set all renditions info for ABR
@@ -65,6 +68,13 @@ void LLHlsChunklist::SetWallclockOffset(int64_t offset_ms)
 	_wallclock_offset_ms = offset_ms;
 }
 
+void LLHlsChunklist::SetDiscontinuity(uint32_t segment_sequence)
+{
+	_discontinuity_segment_sequence = segment_sequence;
+
+	InvalidateVariantCache();
+}
+
 int64_t LLHlsChunklist::GetWallclockOffset() const
 {
 	return _wallclock_offset_ms;
@@ -91,6 +101,11 @@ const ov::String& LLHlsChunklist::GetUrl() const
 	return _url;
 }
 
+double LLHlsChunklist::GetPartTargetDuration() const
+{
+	return _part_target_duration;
+}
+
 void LLHlsChunklist::SetPartHoldBack(const float &part_hold_back)
 {
 	_part_hold_back = part_hold_back;
@@ -106,6 +121,15 @@ bool LLHlsChunklist::CreateSegmentInfo(const SegmentInfo &info)
 	auto segment = std::make_shared<SegmentInfo>(info);
 	_segments.emplace(segment->GetSequence(), segment);
 
+	// Segments recovered from DVR are created as completed
+	if ((info.IsCompleted() == true) && (info.GetSequence() > _last_completed_segment_sequence))
+	{
+		_last_completed_segment_sequence = info.GetSequence();
+	}
+	lock.unlock();
+
+	InvalidateVariantCache();
+
 	return true;
 }
 
@@ -165,25 +189,111 @@ bool LLHlsChunklist::RemoveSegmentInfo(uint32_t segment_sequence)
 	SaveOldSegmentInfo(old_segment);
 
 	_segments.erase(segment_sequence);
+	lock.unlock();
+
+	InvalidateVariantCache();
 
 	return true;
 }
 
 void LLHlsChunklist::UpdateCacheForDefaultChunklist()
 {
+	InvalidateVariantCache();
+
 	// no query string, no skip, no legacy, all segments
-	ov::String chunklist = MakeChunklist("", false, false, true);
+	GetRenderedVariant("", false, false, true, true, true);
+}
+
+void LLHlsChunklist::InvalidateVariantCache()
+{
+	std::lock_guard<std::shared_mutex> lock(_variant_cache_guard);
+
+	_variant_cache_generation++;
+	_variant_cache.clear();
+}
+
+std::shared_ptr<const LLHlsChunklist::RenderedVariant> LLHlsChunklist::GetRenderedVariant(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool gzip, bool prerender) const
+{
+	auto key = ov::String::FormatString("%d%d%d|%s", skip, legacy, rewind, query_string.CStr());
+
+	uint64_t generation;
+	std::shared_ptr<const RenderedVariant> cached_variant;
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		_cached_default_chunklist = chunklist;
+		std::shared_lock<std::shared_mutex> lock(_variant_cache_guard);
+
+		generation = _variant_cache_generation;
+
+		auto it = _variant_cache.find(key);
+		if (it != _variant_cache.end())
+		{
+			cached_variant = it->second;
+		}
+	}
+
+	if ((cached_variant != nullptr) && ((gzip == false) || (cached_variant->gzip != nullptr)))
+	{
+		_variant_cache_hit_count++;
+		if (_server_metrics != nullptr)
+		{
+			_server_metrics->OnChunklistCacheHit();
+		}
+		return cached_variant;
+	}
+
+	if (prerender == false)
+	{
+		_variant_cache_miss_count++;
+		if (_server_metrics != nullptr)
+		{
+			_server_metrics->OnChunklistCacheMiss();
+		}
+	}
+
+	auto variant = std::make_shared<RenderedVariant>();
+
+	if (cached_variant != nullptr)
+	{
+		// Only the gzip encoding is missing
+		variant->text = cached_variant->text;
+	}
+	else
+	{
+		variant->text = MakeChunklist(query_string, skip, legacy, rewind);
 	}
 
+	if (gzip == true)
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		_cached_default_chunklist_gzip = ov::Zip::CompressGzip(chunklist.ToData(false));
+		variant->gzip = ov::Zip::CompressGzip(variant->text.ToData(false));
+	}
+
+	{
+		std::lock_guard<std::shared_mutex> lock(_variant_cache_guard);
+
+		// If the chunklist has been updated while rendering, the variant is not cached
+		if ((generation == _variant_cache_generation) &&
+			((_variant_cache.size() < LLHLS_CHUNKLIST_MAX_CACHED_VARIANTS) || (_variant_cache.find(key) != _variant_cache.end())))
+		{
+			_variant_cache[key] = variant;
+		}
 	}
+
+	return variant;
+}
+
+LLHlsChunklist::VariantCacheStats LLHlsChunklist::GetVariantCacheStats() const
+{
+	VariantCacheStats stats;
+
+	{
+		std::shared_lock<std::shared_mutex> lock(_variant_cache_guard);
+		stats.generation = _variant_cache_generation;
+		stats.variant_count = _variant_cache.size();
+	}
+
+	stats.hit_count = _variant_cache_hit_count;
+	stats.miss_count = _variant_cache_miss_count;
+
+	return stats;
 }
 
 bool LLHlsChunklist::SaveOldSegmentInfo(std::shared_ptr<SegmentInfo> &segment_info)
@@ -240,6 +350,44 @@ bool LLHlsChunklist::GetLastSequenceNumber(int64_t &msn, int64_t &psn) const
 	return true;
 }
 
+bool LLHlsChunklist::GetPreloadHint(int64_t &msn, int64_t &part, ov::String &url) const
+{
+	if (_preload_hint_enabled == false)
+	{
+		return false;
+	}
+
+	std::shared_lock<std::shared_mutex> lock(_segments_guard);
+
+	if (_segments.empty())
+	{
+		return false;
+	}
+
+	auto last_segment = _segments.rbegin()->second;
+	if (last_segment->GetPartialSegments().empty())
+	{
+		return false;
+	}
+
+	auto last_partial_segment = last_segment->GetPartialSegments().back();
+	if (last_partial_segment->IsCompleted())
+	{
+		// The first part of the next segment
+		msn = last_segment->GetSequence() + 1;
+		part = 0;
+	}
+	else
+	{
+		msn = last_segment->GetSequence();
+		part = last_partial_segment->GetSequence() + 1;
+	}
+
+	url = last_partial_segment->GetNextUrl();
+
+	return true;
+}
+
 ov::String LLHlsChunklist::MakeExtXKey() const
 {
 	ov::String xkey;
@@ -391,18 +539,31 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 		}
 
 		uint32_t shift_count = segment_size > _max_segment_count ? _max_segment_count : segment_size - 1;
-		auto it = _segments.find(_last_completed_segment_sequence - shift_count);
+		auto it = _segments.find(_last_completed_segment_sequence);
 		if (it == _segments.end())
 		{
 			logte("Could not find segment info. last_completed_segment_sequence(%lld) segment_count(%d)", _last_completed_segment_sequence.load(), _max_segment_count);
 			return "";
 		}
 
+		// The numbers may have a gap between the recovered segments and the live segments
+		for (uint32_t count = 0; (count < shift_count) && (it != _segments.begin()); count++)
+		{
+			it--;
+		}
+
 		first_segment = it->second;
 	}
 
 	playlist.AppendFormat("#EXT-X-MEDIA-SEQUENCE:%u\n", vod == false ? first_segment->GetSequence() : 0);
 
+	int64_t discontinuity_segment_sequence = _discontinuity_segment_sequence;
+	if ((vod == false) && (discontinuity_segment_sequence >= 0))
+	{
+		// The discontinuity is counted once the segment after it is the first one
+		playlist.AppendFormat("#EXT-X-DISCONTINUITY-SEQUENCE:%u\n", (first_segment->GetSequence() >= discontinuity_segment_sequence) ? 1 : 0);
+	}
+
 	if (_map_uri.IsEmpty() == false)
 	{
 		playlist.AppendFormat("#EXT-X-MAP:URI=\"%s", _map_uri.CStr());
@@ -451,7 +612,8 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 			continue;
 		}
 
-		if (segment->GetPartialSegmentsCount() == 0)
+		// Segments recovered from DVR have no partial segments
+		if ((segment->GetPartialSegmentsCount() == 0) && (segment->IsCompleted() == false))
 		{
 			continue;
 		}
@@ -461,6 +623,11 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 			continue;
 		}
 
+		if ((number == discontinuity_segment_sequence) && (number > first_segment->GetSequence()))
+		{
+			playlist.AppendFormat("#EXT-X-DISCONTINUITY\n");
+		}
+
 		std::chrono::system_clock::time_point tp{std::chrono::milliseconds{segment->GetStartTime()}};
 		playlist.AppendFormat("#EXT-X-PROGRAM-DATE-TIME:%s\n", ov::Converter::ToISO8601String(tp).CStr());
 
@@ -591,23 +758,16 @@ ov::String LLHlsChunklist::ToString(const ov::String &query_string, bool skip, b
 		return "";
 	}
 
-	if (query_string.IsEmpty() && skip == false && legacy == false && rewind == true && vod == false && vod_start_segment_number == 0 && !_cached_default_chunklist.IsEmpty())
+	if (vod == true || vod_start_segment_number != 0)
 	{
-		// return cached chunklist for default chunklist
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		return _cached_default_chunklist;
+		// Only used for dumps, not cached
+		return MakeChunklist(query_string, skip, legacy, rewind, vod, vod_start_segment_number);
 	}
 
-	return MakeChunklist(query_string, skip, legacy, rewind, vod, vod_start_segment_number);
+	return GetRenderedVariant(query_string, skip, legacy, rewind, false)->text;
 }
 
 std::shared_ptr<const ov::Data> LLHlsChunklist::ToGzipData(const ov::String &query_string, bool skip, bool legacy, bool rewind) const
 {
-	if (query_string.IsEmpty() && skip == false && legacy == false && _cached_default_chunklist_gzip != nullptr && rewind == true)
-	{
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		return _cached_default_chunklist_gzip;
-	}
-
-	return ov::Zip::CompressGzip(ToString(query_string, skip, legacy, rewind).ToData(false));
+	return GetRenderedVariant(query_string, skip, legacy, rewind, true)->gzip;
 }
@@ -15,6 +15,14 @@
 
 #include "modules/containers/bmff/cenc.h"
 
+namespace mon
+{
+	class ServerMetrics;
+}
+
+// Maximum number of rendered variants (query string, skip, legacy, rewind) kept per playlist update
+#define LLHLS_CHUNKLIST_MAX_CACHED_VARIANTS 128
+
 class LLHlsChunklist
 {
 public:
@@ -220,6 +228,7 @@ public:
 	void Release();
 
 	const ov::String& GetUrl() const;
+	double GetPartTargetDuration() const;
 
 	// Set all renditions info for ABR
 	void SetRenditions(const std::map<int32_t, std::shared_ptr<LLHlsChunklist>> &renditions);
@@ -240,12 +249,34 @@ public:
 
 	std::shared_ptr<SegmentInfo> GetSegmentInfo(uint32_t segment_sequence) const;
 	bool GetLastSequenceNumber(int64_t &msn, int64_t &psn) const;
+	// Returns the part that EXT-X-PRELOAD-HINT points to (the part after the last one)
+	// false if the preload hint is disabled or no part has been created yet
+	bool GetPreloadHint(int64_t &msn, int64_t &part, ov::String &url) const;
+
+	struct VariantCacheStats
+	{
+		// Increased whenever the chunklist is updated
+		uint64_t generation = 0;
+		uint64_t hit_count = 0;
+		uint64_t miss_count = 0;
+		size_t variant_count = 0;
+
+		double GetHitRatio() const
+		{
+			auto total = hit_count + miss_count;
+			return (total > 0) ? (static_cast<double>(hit_count) / static_cast<double>(total)) : 0.0;
+		}
+	};
+	VariantCacheStats GetVariantCacheStats() const;
 
 	void SetEndList();
 
 	void SetWallclockOffset(int64_t offset_ms);
 	int64_t GetWallclockOffset() const;
 
+	// The segment starts after a discontinuity (e.g. the live segments after the DVR segments recovered on restart)
+	void SetDiscontinuity(uint32_t segment_sequence);
+
 private:
 	std::shared_ptr<SegmentInfo> GetLastSegmentInfo() const;
 
@@ -253,6 +284,19 @@ private:
 
 	ov::String MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod = false, uint32_t vod_start_segment_number = 0) const;
 
+	// Chunklist of a variant rendered at a generation, shared by all sessions until the next update
+	struct RenderedVariant
+	{
+		ov::String text;
+		// nullptr until a client accepting gzip requests the variant
+		std::shared_ptr<const ov::Data> gzip;
+	};
+
+	// Returns the rendered variant of the current generation, renders it if it is not cached yet
+	std::shared_ptr<const RenderedVariant> GetRenderedVariant(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool gzip, bool prerender = false) const;
+	// Called whenever the chunklist is updated
+	void InvalidateVariantCache();
+
 	ov::String MakeExtXKey() const;
 
 	ov::String MakeMarkers(const std::vector<std::shared_ptr<Marker>> &markers) const;
@@ -287,17 +331,23 @@ private:
 	std::map<int32_t, std::shared_ptr<LLHlsChunklist>> _renditions;
 	mutable std::shared_mutex _renditions_guard;
 
-	ov::String _cached_default_chunklist;
-	mutable std::shared_mutex _cached_default_chunklist_guard;
+	// Variant key : RenderedVariant
+	mutable std::map<ov::String, std::shared_ptr<const RenderedVariant>> _variant_cache;
+	uint64_t _variant_cache_generation = 0;
+	mutable std::shared_mutex _variant_cache_guard;
 
-	std::shared_ptr<ov::Data> _cached_default_chunklist_gzip;
-	mutable std::shared_mutex _cached_default_chunklist_gzip_guard;
+	mutable std::atomic<uint64_t> _variant_cache_hit_count = 0;
+	mutable std::atomic<uint64_t> _variant_cache_miss_count = 0;
+	// Hit/miss of all chunklists (/v1/stats/current/internals/chunklistcache), nullptr if the monitoring is not running
+	std::shared_ptr<mon::ServerMetrics> _server_metrics;
 
 	bmff::CencProperty _cenc_property;
 
 	bool _end_list = false;
 
-	int64_t _wallclock_offset_ms = 0;
+	std::atomic<int64_t> _wallclock_offset_ms{0};
+
+	std::atomic<int64_t> _discontinuity_segment_sequence{-1};
 
 	std::shared_ptr<Marker> _root_marker;
 
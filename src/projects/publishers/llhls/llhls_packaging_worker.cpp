@@ -0,0 +1,124 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#include "llhls_packaging_worker.h"
+
+#include "llhls_private.h"
+
+LLHlsPackagingWorker::LLHlsPackagingWorker(const ov::String &name)
+	: _name(name),
+	  _task_queue(nullptr, MAX_LLHLS_PACKAGING_QUEUE_SIZE)
+{
+	_task_queue.SetAlias(ov::String::FormatString("LLHLS packaging queue - %s", _name.CStr()).CStr());
+}
+
+LLHlsPackagingWorker::~LLHlsPackagingWorker()
+{
+	Stop();
+}
+
+bool LLHlsPackagingWorker::Start()
+{
+	if (_stop_thread_flag == false)
+	{
+		return true;
+	}
+
+	_task_queue.Start();
+
+	_stop_thread_flag = false;
+	_worker_thread = std::thread(&LLHlsPackagingWorker::WorkerThread, this);
+	pthread_setname_np(_worker_thread.native_handle(), "LLHlsPackager");
+
+	return true;
+}
+
+bool LLHlsPackagingWorker::Stop()
+{
+	if (_stop_thread_flag == true)
+	{
+		return true;
+	}
+
+	_stop_thread_flag = true;
+	_task_queue.Stop();
+
+	if (_worker_thread.joinable())
+	{
+		_worker_thread.join();
+	}
+
+	_task_queue.Clear();
+
+	logtd("LLHLS packaging worker(%s) has been stopped", _name.CStr());
+
+	return true;
+}
+
+bool LLHlsPackagingWorker::PostTask(Task task)
+{
+	if (_stop_thread_flag == true)
+	{
+		return false;
+	}
+
+	_task_queue.Enqueue(std::move(task));
+
+	return true;
+}
+
+bool LLHlsPackagingWorker::PostSampleTask(int32_t track_id, bool key_frame, Task task)
+{
+	if (_stop_thread_flag == true)
+	{
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(_dropping_track_ids_lock);
+
+	auto dropping = (_dropping_track_ids.find(track_id) != _dropping_track_ids.end());
+
+	if ((_task_queue.Size() >= MAX_LLHLS_PACKAGING_QUEUE_SIZE) || (dropping && (key_frame == false)))
+	{
+		if (dropping == false)
+		{
+			_dropping_track_ids.insert(track_id);
+			logtw("LLHLS packaging worker(%s) is falling behind, samples of track(%d) are dropped until the next key frame (queue: %zu)", _name.CStr(), track_id, _task_queue.Size());
+		}
+
+		_dropped_sample_count++;
+		return false;
+	}
+
+	if (dropping)
+	{
+		_dropping_track_ids.erase(track_id);
+		logti("LLHLS packaging worker(%s) resumes track(%d) from a key frame (total dropped samples: %llu)", _name.CStr(), track_id, _dropped_sample_count);
+	}
+
+	_task_queue.Enqueue(std::move(task));
+
+	return true;
+}
+
+void LLHlsPackagingWorker::WorkerThread()
+{
+	ov::logger::ThreadHelper thread_helper;
+
+	while (_stop_thread_flag == false)
+	{
+		// Returns std::nullopt when Stop() is called
+		auto task = _task_queue.Dequeue();
+		if (task.has_value() == false || task.value() == nullptr)
+		{
+			continue;
+		}
+
+		task.value()();
+	}
+}
@@ -0,0 +1,59 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <thread>
+
+// max packaging workers of a stream
+#define MAX_LLHLS_PACKAGING_WORKER_COUNT	8
+// max pending tasks of a packaging worker, samples are dropped beyond it (OOM protection when packaging falls behind)
+#define MAX_LLHLS_PACKAGING_QUEUE_SIZE	500
+
+// Runs the packaging of the tracks assigned to it.
+//
+// A track is always assigned to the same worker, so its samples are packaged in order
+// and its chunklist is updated by a single thread, independently of the other renditions.
+class LLHlsPackagingWorker
+{
+public:
+	using Task = std::function<void()>;
+
+	explicit LLHlsPackagingWorker(const ov::String &name);
+	~LLHlsPackagingWorker();
+
+	bool Start();
+	// Pending tasks are discarded
+	bool Stop();
+
+	bool PostTask(Task task);
+	// Posts the packaging of a sample of the track. If the queue is full, the sample is dropped and
+	// the following samples of the track are dropped until the next key frame, so the packager resumes from a decodable frame.
+	// Returns false if the sample is dropped
+	bool PostSampleTask(int32_t track_id, bool key_frame, Task task);
+
+private:
+	void WorkerThread();
+
+	ov::String _name;
+
+	ov::Queue<Task> _task_queue;
+
+	std::mutex _dropping_track_ids_lock;
+	// Tracks waiting for a key frame after their samples are dropped
+	std::set<int32_t> _dropping_track_ids;
+	uint64_t _dropped_sample_count = 0;
+
+	std::atomic<bool> _stop_thread_flag{true};
+	std::thread _worker_thread;
+};
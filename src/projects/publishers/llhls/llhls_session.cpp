@@ -85,13 +85,23 @@ bool LLHlsSession::Start()
 
 	_hls_legacy = llhls_conf.GetDefaultQueryString().GetBoolValue("_HLS_legacy", kDefaultHlsLegacy);
 	_hls_rewind = llhls_conf.GetDefaultQueryString().GetBoolValue("_HLS_rewind", kDefaultHlsRewind);
+
+	_preload_hint_push_enabled = llhls_conf.IsPreloadHintEnabled() && llhls_conf.IsPreloadHintPushEnabled();
+	_progressive_part_delivery_enabled = llhls_conf.IsProgressivePartDeliveryEnabled();
 	
 	return Session::Start();
 }
 
 bool LLHlsSession::Stop()
 {
-	logtd("LLHlsSession(%u) : Pending request size(%d)", GetId(), _pending_requests.size());
+	logtd("LLHlsSession(%u) has been stopped", GetId());
+
+	// Held requests must not be completed after the session is gone
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream != nullptr)
+	{
+		llhls_stream->RemoveWaiters(GetId());
+	}
 
 	return Session::Stop();
 }
@@ -144,32 +154,18 @@ bool LLHlsSession::IsNoConnection() const
 // pub::Session Interface
 void LLHlsSession::SendOutgoingData(const std::any &notification)
 {
-	// Check expired time
-	if(_session_life_time != 0 && _session_life_time < ov::Clock::NowMSec())
-	{
-		return;
-	}
+	// Nothing is broadcast to LL-HLS sessions, held requests are completed by OnWaiterCompleted()
+}
 
-	std::shared_ptr<LLHlsStream::PlaylistUpdatedEvent> event;
-	try
-	{
-		event = std::any_cast<std::shared_ptr<LLHlsStream::PlaylistUpdatedEvent>>(notification);
-		if (event == nullptr)
-		{
-			return;
-		}
-	}
-	catch (const std::bad_any_cast& e)
+void LLHlsSession::OnMessageReceived(const std::any &message)
+{
+	// A held request has been completed by LLHlsStream
+	if (message.type() == typeid(std::shared_ptr<LLHlsWaiterIndex::Waiter>))
 	{
-		logtc("LLHlsSession : Invalid notification type : %s", e.what());
+		OnWaiterCompleted(std::any_cast<std::shared_ptr<LLHlsWaiterIndex::Waiter>>(message));
 		return;
 	}
 
-	OnPlaylistUpdated(event->track_id, event->msn, event->part);
-}
-
-void LLHlsSession::OnMessageReceived(const std::any &message)
-{
 	std::shared_ptr<http::svr::HttpExchange> exchange = nullptr;
 	try 
 	{
@@ -329,6 +325,16 @@ void LLHlsSession::OnMessageReceived(const std::any &message)
 			}
 		}
 
+		// A request beyond the limits of the delivery directives is not held (_HLS_part requires _HLS_msn)
+		if ((request_uri->HasQueryKey("_HLS_part") && (request_uri->HasQueryKey("_HLS_msn") == false)) ||
+			((msn >= 0) && (llhls_stream->IsValidDeliveryDirective(track_id, msn, part) == false)))
+		{
+			logtd("LLHlsSession::OnMessageReceived(%u) - Invalid delivery directives : %s", GetId(), request_uri->Source().CStr());
+			response->SetStatusCode(http::StatusCode::BadRequest);
+			ResponseData(exchange);
+			return;
+		}
+
 		ResponseChunklist(exchange, file, track_id, msn, part, skip, legacy, rewind);
 		break;
 	}
@@ -487,7 +493,11 @@ void LLHlsSession::ResponsePlaylist(const std::shared_ptr<http::svr::HttpExchang
 	else if (result == LLHlsStream::RequestResult::Accepted && holdIfAccepted == true)
 	{
 		// llhls.m3u8 is transmitted when more than one segment (any track) is created.
-		AddPendingRequest(exchange, RequestType::Playlist, file_name, 0, 1, 0, false, legacy, rewind);
+		if (HoldRequest(exchange, LLHlsWaiterIndex::RequestType::Playlist, file_name, 0, 1, 0, "", false, legacy, rewind) == false)
+		{
+			// Updated in the meantime
+			ResponsePlaylist(exchange, file_name, legacy, rewind, false);
+		}
 		return ;
 	}
 	else
@@ -514,8 +524,6 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 
 	auto request = exchange->GetRequest();
 	auto request_uri = request->GetParsedUri();
-	auto response = exchange->GetResponse();
-	bool has_delivery_directives = request_uri->HasQueryKey("_HLS_msn");
 
 	if (msn == -1 && part == -1)
 	{
@@ -525,27 +533,48 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 		part = 0;
 	}
 
-	ov::String content_encoding = "identity";
 	bool gzip = false;
 	auto encodings = request->GetHeader("Accept-Encoding");
 	if (encodings.IndexOf("gzip") >= 0 || encodings.IndexOf("*") >= 0)
 	{
 		gzip = true;
-		content_encoding = "gzip";
 	}
 
 	// Get the chunklist
 	auto query_string = MakeQueryStringToPropagate(request_uri);
 
 	auto [result, chunklist] = llhls_stream->GetChunklist(query_string, track_id, msn, part, skip, gzip, legacy, rewind);
-	if (result == LLHlsStream::RequestResult::Success)
+	if (result == LLHlsStream::RequestResult::Accepted && holdIfAccepted == true)
+	{
+		// Hold
+		//TODO(Getroot): EXT-X-SKIP is under debugging
+
+		skip = false;
+		if (HoldRequest(exchange, LLHlsWaiterIndex::RequestType::Chunklist, file_name, track_id, msn, part, query_string, skip, legacy, rewind, gzip) == false)
+		{
+			// The part has been created in the meantime
+			ResponseChunklist(exchange, file_name, track_id, msn, part, skip, legacy, rewind, false);
+		}
+		return ;
+	}
+
+	ResponseChunklistData(exchange, file_name, track_id, result, chunklist, gzip, holdIfAccepted);
+}
+
+void LLHlsSession::ResponseChunklistData(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id, LLHlsStream::RequestResult result, const std::shared_ptr<const ov::Data> &chunklist, bool gzip, bool holdIfAccepted)
+{
+	auto request_uri = exchange->GetRequest()->GetParsedUri();
+	auto response = exchange->GetResponse();
+	bool has_delivery_directives = (request_uri != nullptr) && request_uri->HasQueryKey("_HLS_msn");
+
+	if (result == LLHlsStream::RequestResult::Success && chunklist != nullptr)
 	{
 		// Send the chunklist
 		response->SetStatusCode(http::StatusCode::OK);
 		// Set Content-Type header
 		response->SetHeader("Content-Type", "application/vnd.apple.mpegurl");
 		// gzip compression
-		response->SetHeader("Content-Encoding", content_encoding);
+		response->SetHeader("Content-Encoding", gzip ? "gzip" : "identity");
 
 		// Cache-Control header
 		ov::String cache_control;
@@ -582,6 +611,12 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 
 		response->AppendData(chunklist);
 
+		if (has_delivery_directives == true)
+		{
+			// The promise must be sent before the chunklist that refers to the part
+			PushPreloadHint(exchange, track_id);
+		}
+
 		// If a client uses previously cached llhls.m3u8 and requests chunklist
 		if (_origin_mode == false && _number_of_players == 0)
 		{
@@ -589,15 +624,6 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 			_number_of_players += 1;
 		}
 	}
-	else if (result == LLHlsStream::RequestResult::Accepted && holdIfAccepted == true)
-	{
-		// Hold
-		//TODO(Getroot): EXT-X-SKIP is under debugging
-
-		skip = false;
-		AddPendingRequest(exchange, RequestType::Chunklist, file_name, track_id, msn, part, skip, legacy, rewind);
-		return ;
-	}
 	else
 	{
 		if (holdIfAccepted == false)
@@ -674,8 +700,17 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 
 	auto response = exchange->GetResponse();
 
-	// Get the segment
-	auto [result, segment] = llhls_stream->GetSegment(track_id, segment_number);
+	// Segments in the DVR storage are sent from the file without being loaded into memory
+	auto file_region = llhls_stream->GetSegmentFileRegion(track_id, segment_number);
+
+	LLHlsStream::RequestResult result = LLHlsStream::RequestResult::Success;
+	std::shared_ptr<ov::Data> segment;
+
+	if (file_region == nullptr)
+	{
+		std::tie(result, segment) = llhls_stream->GetSegment(track_id, segment_number);
+	}
+
 	if (result == LLHlsStream::RequestResult::Success)
 	{
 		// Send the segment
@@ -712,7 +747,14 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 			response->SetHeader("Cache-Control", cache_control);
 		}
 
-		response->AppendData(segment);
+		if (file_region != nullptr)
+		{
+			response->AppendFileRegion(file_region);
+		}
+		else
+		{
+			response->AppendData(segment);
+		}
 	}
 	else
 	{
@@ -739,58 +781,195 @@ void LLHlsSession::ResponsePartialSegment(const std::shared_ptr<http::svr::HttpE
 	{
 		// Send the partial segment
 		response->SetStatusCode(http::StatusCode::OK);
-		// Set Content-Type header
-		if (GetStream()->GetTrack(track_id)->GetMediaType() == cmn::MediaType::Video)
+		SetPartialSegmentHeader(response, track_id);
+
+		response->AppendData(partial_segment);
+	}
+	else if (result == LLHlsStream::RequestResult::Accepted && holdIfAccepted == true)
+	{
+		// The part being built is sent progressively instead of waiting for the whole part
+		if (_progressive_part_delivery_enabled && StartPartialSegmentStream(exchange, file_name, track_id, segment_number, partial_number))
 		{
-			response->SetHeader("Content-Type", "video/mp4");
+			return;
 		}
-		else if (GetStream()->GetTrack(track_id)->GetMediaType() == cmn::MediaType::Audio)
+
+		// Hold
+		if (HoldRequest(exchange, LLHlsWaiterIndex::RequestType::PartialSegment, file_name, track_id, segment_number, partial_number) == false)
 		{
-			response->SetHeader("Content-Type", "audio/mp4");
+			// The part has been created in the meantime
+			ResponsePartialSegment(exchange, file_name, track_id, segment_number, partial_number, false);
 		}
-		else if (GetStream()->GetTrack(track_id)->GetMediaType() == cmn::MediaType::Subtitle)
+		return ;
+	}
+	else
+	{
+		if (holdIfAccepted == false)
 		{
-			response->SetHeader("Content-Type", "text/vtt");
+			logtw("%s/%s/%s Failed to respond to pending request.", GetApplication()->GetVHostAppName().CStr(), GetStream()->GetName().CStr(), file_name.CStr());
+		}
+
+		// Send error response
+		response->SetStatusCode(http::StatusCode::NotFound);
+	}
+
+	ResponseData(exchange);
+}
+
+void LLHlsSession::SetPartialSegmentHeader(const std::shared_ptr<http::svr::HttpResponse> &response, const int32_t &track_id)
+{
+	// Set Content-Type header
+	if (GetStream()->GetTrack(track_id)->GetMediaType() == cmn::MediaType::Video)
+	{
+		response->SetHeader("Content-Type", "video/mp4");
+	}
+	else if (GetStream()->GetTrack(track_id)->GetMediaType() == cmn::MediaType::Audio)
+	{
+		response->SetHeader("Content-Type", "audio/mp4");
+	}
+	else if (GetStream()->GetTrack(track_id)->GetMediaType() == cmn::MediaType::Subtitle)
+	{
+		response->SetHeader("Content-Type", "text/vtt");
+	}
+	else
+	{
+		response->SetHeader("Content-Type", "application/octet-stream");
+	}
+
+	if (_partial_segment_max_age >= 0)
+	{
+		ov::String cache_control;
+		if (_partial_segment_max_age == 0)
+		{
+			cache_control = ov::String::FormatString("no-cache, no-store");
 		}
 		else
 		{
-			response->SetHeader("Content-Type", "application/octet-stream");
+			cache_control = ov::String::FormatString("max-age=%d", _partial_segment_max_age);
+		}
+		response->SetHeader("Cache-Control", cache_control);
+	}
+}
+
+bool LLHlsSession::StartPartialSegmentStream(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number)
+{
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream == nullptr)
+	{
+		return false;
+	}
+
+	std::vector<std::shared_ptr<const ov::Data>> fragments;
+	if (llhls_stream->GetBuildingPartialFragments(track_id, segment_number, partial_number, 0, fragments) == false)
+	{
+		// A part after the next one, it is held until it is created
+		return false;
+	}
+
+	auto response = exchange->GetResponse();
+	if (response->StartStreamingResponse() == false)
+	{
+		return false;
+	}
+
+	response->SetStatusCode(http::StatusCode::OK);
+	SetPartialSegmentHeader(response, track_id);
+
+	auto waiter = std::make_shared<LLHlsWaiterIndex::Waiter>();
+	waiter->type = LLHlsWaiterIndex::RequestType::PartialSegmentStream;
+	waiter->session_id = GetId();
+	waiter->exchange = exchange;
+	waiter->file_name = file_name;
+	waiter->track_id = track_id;
+	waiter->msn = segment_number;
+	waiter->part = partial_number;
+
+	logtd("LLHlsSession::StartPartialSegmentStream track_id: %d, msn: %lld, part: %lld", track_id, segment_number, partial_number);
+
+	// If the part has been created in the meantime, the waiter is not added and the whole part is sent below
+	llhls_stream->AddWaiter(waiter);
+
+	ContinuePartialSegmentStream(waiter);
+
+	return true;
+}
+
+void LLHlsSession::ContinuePartialSegmentStream(const std::shared_ptr<LLHlsWaiterIndex::Waiter> &waiter)
+{
+	if (waiter->stream_finished)
+	{
+		return;
+	}
+
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream == nullptr)
+	{
+		return;
+	}
+
+	auto exchange = waiter->exchange;
+	auto response = exchange->GetResponse();
+	int32_t sent_size = 0;
+
+	std::vector<std::shared_ptr<const ov::Data>> fragments;
+	if (llhls_stream->GetBuildingPartialFragments(waiter->track_id, waiter->msn, waiter->part, waiter->sent_fragment_count, fragments) == true)
+	{
+		// Sends the fragments appended since the last time
+		for (const auto &fragment : fragments)
+		{
+			response->AppendData(fragment);
+			waiter->sent_bytes += fragment->GetLength();
 		}
+		waiter->sent_fragment_count += fragments.size();
 
-		if (_partial_segment_max_age >= 0)
+		sent_size = response->Response();
+		if (sent_size >= 0)
 		{
-			ov::String cache_control;
-			if (_partial_segment_max_age == 0)
-			{
-				cache_control = ov::String::FormatString("no-cache, no-store");
-			}
-			else
+			if (sent_size > 0)
 			{
-				cache_control = ov::String::FormatString("max-age=%d", _partial_segment_max_age);
+				MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::LLHls, sent_size);
 			}
-			response->SetHeader("Cache-Control", cache_control);
+
+			return;
 		}
 
-		response->AppendData(partial_segment);
-	}
-	else if (result == LLHlsStream::RequestResult::Accepted && holdIfAccepted == true)
-	{
-		// Hold
-		AddPendingRequest(exchange, RequestType::PartialSegment, file_name, track_id, segment_number, partial_number, false, false, false);
-		return ;
+		logtw("%s/%s/%s Failed to send the part being built", GetApplication()->GetVHostAppName().CStr(), GetStream()->GetName().CStr(), waiter->file_name.CStr());
 	}
 	else
 	{
-		if (holdIfAccepted == false)
+		// The part has been created, the data of the part is the same as its fragments
+		auto [result, partial_segment] = llhls_stream->GetPartial(waiter->track_id, waiter->msn, waiter->part);
+		if (result == LLHlsStream::RequestResult::Accepted)
 		{
-			logtw("%s/%s/%s Failed to respond to pending request.", GetApplication()->GetVHostAppName().CStr(), GetStream()->GetName().CStr(), file_name.CStr());
+			// Not expected, the part is created before its fragments are removed
+			return;
 		}
 
-		// Send error response
-		response->SetStatusCode(http::StatusCode::NotFound);
+		if ((result == LLHlsStream::RequestResult::Success) && (partial_segment->GetLength() >= waiter->sent_bytes))
+		{
+			if (partial_segment->GetLength() > waiter->sent_bytes)
+			{
+				response->AppendData(partial_segment->Subdata(waiter->sent_bytes));
+			}
+		}
+		else
+		{
+			// The response cannot be completed, it ends with the data sent so far
+			logtw("%s/%s/%s Failed to complete the part being sent", GetApplication()->GetVHostAppName().CStr(), GetStream()->GetName().CStr(), waiter->file_name.CStr());
+		}
+
+		sent_size = response->EndStreamingResponse();
+		if (sent_size > 0)
+		{
+			MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::LLHls, sent_size);
+		}
 	}
 
-	ResponseData(exchange);
+	waiter->stream_finished = true;
+
+	logtd("\n%s", exchange->GetDebugInfo().CStr());
+
+	// Terminate the HTTP/2 stream
+	exchange->Release();
 }
 
 void LLHlsSession::ResponseData(const std::shared_ptr<http::svr::HttpExchange> &exchange)
@@ -809,85 +988,148 @@ void LLHlsSession::ResponseData(const std::shared_ptr<http::svr::HttpExchange> &
 	exchange->Release();
 }
 
-void LLHlsSession::OnPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part)
+void LLHlsSession::PushPreloadHint(const std::shared_ptr<http::svr::HttpExchange> &exchange, const int32_t &track_id)
 {
-	logtd("LLHlsSession::OnPlaylistUpdated track_id: %d, msn: %lld, part: %lld", track_id, msn, part);
-	// Find the pending request
+	if (_preload_hint_push_enabled == false)
+	{
+		return;
+	}
 
-	auto it = _pending_requests.begin();
-	while (it != _pending_requests.end())
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream == nullptr)
 	{
-		if ( (it->type == RequestType::Playlist) &&
-			 ((it->segment_number < msn) || (it->segment_number <= msn && it->partial_number <= part)) )
-		{
-			// Send the playlist
-			auto exchange = it->exchange;
-			ResponsePlaylist(exchange, it->file_name, it->legacy, it->rewind, false);
-			it = _pending_requests.erase(it);
-		}
-		else if ( (it->track_id == track_id) && 
-			 ((it->segment_number < msn) || (it->segment_number <= msn && it->partial_number <= part)) )
-		{
-			// Resume the request
-			switch (it->type)
-			{
-			case RequestType::Chunklist:
-				ResponseChunklist(it->exchange, it->file_name, it->track_id, it->segment_number, it->partial_number, it->skip, it->legacy, it->rewind, false);
-				break;
-			case RequestType::PartialSegment:
-				ResponsePartialSegment(it->exchange, it->file_name, it->track_id, it->segment_number, it->partial_number, false);
-				break;
-			case RequestType::Segment:
-				ResponseSegment(it->exchange, it->file_name, it->track_id, it->segment_number);
-				break;
-			case RequestType::Playlist:
-				// Playlist is processed already above
-			case RequestType::InitializationSegment:
-				// Initialization segment request is not pending 
-			default:
-				// Assertion
-				OV_ASSERT2(false);
-				break;
-			}
+		return;
+	}
 
-			// Remove the request
-			it = _pending_requests.erase(it);
-		}
-		else
+	int64_t msn = -1, part = -1;
+	ov::String file_name;
+	if (llhls_stream->GetPreloadHint(track_id, msn, part, file_name) == false)
+	{
+		return;
+	}
+
+	auto request_uri = exchange->GetRequest()->GetParsedUri();
+	if (request_uri == nullptr)
+	{
+		return;
+	}
+
+	// The URI of the preload hint is relative to the chunklist, and has the same query string as the chunklist
+	auto chunklist_path = request_uri->Path();
+	auto path = chunklist_path.Substring(0, chunklist_path.IndexOfRev('/') + 1) + file_name;
+	auto query_string = MakeQueryStringToPropagate(request_uri);
+	if (query_string.IsEmpty() == false)
+	{
+		path.AppendFormat("?%s", query_string.CStr());
+	}
+
+	// nullptr if the connection is HTTP/1.1 or the client disabled server push
+	auto pushed_exchange = exchange->Push(path);
+	if (pushed_exchange == nullptr)
+	{
+		return;
+	}
+
+	// The CORS headers of the chunklist apply to the pushed part
+	auto response = exchange->GetResponse();
+	auto pushed_response = pushed_exchange->GetResponse();
+	for (const auto &header_name : {"Access-Control-Allow-Origin", "Access-Control-Allow-Credentials"})
+	{
+		for (const auto &header_value : response->GetHeader(header_name))
 		{
-			// Next
-			++it;
+			pushed_response->AddHeader(header_name, header_value);
 		}
 	}
+
+	logtd("LLHlsSession::PushPreloadHint track_id: %d, msn: %lld, part: %lld, path: %s", track_id, msn, part, path.CStr());
+
+	// Responds to the promised request like a Blocking Preload Hint request, it is held until the part is created
+	ResponsePartialSegment(pushed_exchange, file_name, track_id, msn, part);
 }
 
-bool LLHlsSession::AddPendingRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange, const RequestType &type, const ov::String &file_name, const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number, const bool &skip, const bool &legacy, const bool &rewind)
+bool LLHlsSession::HoldRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange, const LLHlsWaiterIndex::RequestType &type, const ov::String &file_name, const int32_t &track_id, const int64_t &msn, const int64_t &part, const ov::String &query_string, bool skip, bool legacy, bool rewind, bool gzip)
 {
-	// Add the request to the pending list
-	PendingRequest request;
-	request.type = type;
-	request.file_name = file_name;
-	request.track_id = track_id;
-	request.segment_number = segment_number;
-	request.partial_number = partial_number;
-	request.skip = skip;
-	request.legacy = legacy;
-	request.rewind = rewind;
-	request.exchange = exchange;
-
-	// Add the request to the pending list
-	_pending_requests.push_back(request);
-
-	if (_pending_requests.size() > MAX_PENDING_REQUESTS)
-	{
-		logtd("[%s/%s/%u] Too many pending requests (%u)", 
-				GetApplication()->GetVHostAppName().CStr(),
-				GetStream()->GetName().CStr(),
-				GetId(),
-				_pending_requests.size());
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream == nullptr)
+	{
+		return false;
 	}
 
-	return true;
+	auto waiter = std::make_shared<LLHlsWaiterIndex::Waiter>();
+	waiter->type = type;
+	waiter->session_id = GetId();
+	waiter->exchange = exchange;
+	waiter->file_name = file_name;
+	waiter->track_id = track_id;
+	waiter->msn = msn;
+	waiter->part = part;
+	waiter->query_string = query_string;
+	waiter->skip = skip;
+	waiter->legacy = legacy;
+	waiter->rewind = rewind;
+	waiter->gzip = gzip;
+
+	return llhls_stream->AddWaiter(waiter);
+}
+
+void LLHlsSession::OnWaiterCompleted(const std::shared_ptr<LLHlsWaiterIndex::Waiter> &waiter)
+{
+	if (waiter == nullptr || waiter->exchange == nullptr)
+	{
+		return;
+	}
+
+	logtd("LLHlsSession::OnWaiterCompleted track_id: %d, msn: %lld, part: %lld", waiter->track_id, waiter->msn, waiter->part);
+
+	if (waiter->exchange->GetStatus() == http::svr::HttpExchange::Status::Error)
+	{
+		// The client reset the stream (e.g. cancelled the pushed preload hint), nothing can be sent on it anymore
+		logtd("LLHlsSession::OnWaiterCompleted the request of %s has been cancelled", waiter->file_name.CStr());
+
+		auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+		if (llhls_stream != nullptr)
+		{
+			// PartialSegmentStream waiters are kept in the index until the part is created
+			llhls_stream->RemoveWaiter(waiter);
+		}
+
+		waiter->stream_finished = true;
+		return;
+	}
+
+	if (waiter->type == LLHlsWaiterIndex::RequestType::PartialSegmentStream)
+	{
+		// A fragment of the part has been appended or the part has been created,
+		// the response has already been started so the session life time is not checked
+		ContinuePartialSegmentStream(waiter);
+		return;
+	}
+
+	// Check expired time
+	if (_session_life_time != 0 && _session_life_time < ov::Clock::NowMSec())
+	{
+		waiter->exchange->GetResponse()->SetStatusCode(http::StatusCode::Unauthorized);
+		ResponseData(waiter->exchange);
+		return;
+	}
+
+	switch (waiter->type)
+	{
+		case LLHlsWaiterIndex::RequestType::Playlist:
+			ResponsePlaylist(waiter->exchange, waiter->file_name, waiter->legacy, waiter->rewind, false);
+			break;
+		case LLHlsWaiterIndex::RequestType::Chunklist:
+			// Rendered on the thread of the session, the chunklist caches the rendered variants so the sessions
+			// requesting the same variant (same query string) share it
+			ResponseChunklist(waiter->exchange, waiter->file_name, waiter->track_id, waiter->msn, waiter->part, waiter->skip, waiter->legacy, waiter->rewind, false);
+			break;
+		case LLHlsWaiterIndex::RequestType::PartialSegment:
+			ResponsePartialSegment(waiter->exchange, waiter->file_name, waiter->track_id, waiter->msn, waiter->part, false);
+			break;
+		case LLHlsWaiterIndex::RequestType::PartialSegmentStream:
+			// Handled above
+			break;
+	}
 }
 
 ov::String LLHlsSession::MakeQueryStringToPropagate(const std::shared_ptr<ov::Url> &request_uri)
@@ -9,11 +9,11 @@
 #pragma once
 
 #include <base/publisher/session.h>
-#include <list>
 
 #include <modules/access_control/access_controller.h>
 
-#define MAX_PENDING_REQUESTS 10
+#include "llhls_stream.h"
+#include "llhls_waiter_index.h"
 
 class LLHlsSession : public pub::Session
 {
@@ -75,34 +75,31 @@ private:
 
 	void ResponsePlaylist(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, bool legacy, bool rewind, bool holdIfAccepted = true);
 	void ResponseChunklist(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id, int64_t msn, int64_t part, bool skip, bool legacy, bool rewind, bool holdIfAccepted = true);
+	void ResponseChunklistData(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id, LLHlsStream::RequestResult result, const std::shared_ptr<const ov::Data> &chunklist, bool gzip, bool holdIfAccepted);
 	void ResponseInitializationSegment(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id);
 	void ResponseSegment(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id, const int64_t &segment_number);
 	void ResponsePartialSegment(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number, bool holdIfAccepted = true);
+	void SetPartialSegmentHeader(const std::shared_ptr<http::svr::HttpResponse> &response, const int32_t &track_id);
 
-	void ResponseData(const std::shared_ptr<http::svr::HttpExchange> &exchange);
-
-	void OnPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part);
+	// Progressive part delivery - the part being built is sent whenever a fragment is appended,
+	// and the response is completed when the part is created
+	// Returns false if the part is not being built
+	bool StartPartialSegmentStream(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number);
+	void ContinuePartialSegmentStream(const std::shared_ptr<LLHlsWaiterIndex::Waiter> &waiter);
 
-	ov::String MakeQueryStringToPropagate(const std::shared_ptr<ov::Url> &request_uri);
+	void ResponseData(const std::shared_ptr<http::svr::HttpExchange> &exchange);
 
-	// Pending requests
-	struct PendingRequest
-	{
-		RequestType type;
-		ov::String file_name;
-		int32_t track_id;
-		int64_t segment_number = -1;
-		int64_t partial_number = -1;
-		bool skip = false;
-		bool legacy = false;
-		bool rewind = false;
-
-		std::shared_ptr<http::svr::HttpExchange> exchange;
-	};
+	// Pushes the part that the preload hint of the chunklist points to (HTTP/2 server push)
+	// The part is sent on the connection of the chunklist request as soon as it is created.
+	void PushPreloadHint(const std::shared_ptr<http::svr::HttpExchange> &exchange, const int32_t &track_id);
 
-	bool AddPendingRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange, const RequestType &type, const ov::String &file_name, const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number, const bool &skip, const bool &legacy, const bool &rewind);
+	// Holds the request in the waiter index of the stream
+	// Returns false if the requested part has already been created
+	bool HoldRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange, const LLHlsWaiterIndex::RequestType &type, const ov::String &file_name, const int32_t &track_id, const int64_t &msn, const int64_t &part, const ov::String &query_string = "", bool skip = false, bool legacy = false, bool rewind = false, bool gzip = false);
+	// Called when the part that the held request waits for is created
+	void OnWaiterCompleted(const std::shared_ptr<LLHlsWaiterIndex::Waiter> &waiter);
 
-	std::list<PendingRequest> _pending_requests;
+	ov::String MakeQueryStringToPropagate(const std::shared_ptr<ov::Url> &request_uri);
 
 	// ID list of connections requesting this session
 	// Connection ID : last request time
@@ -128,4 +125,7 @@ private:
 	// default querystring value
 	bool _hls_legacy = false;
 	bool _hls_rewind = false;
+
+	bool _preload_hint_push_enabled = false;
+	bool _progressive_part_delivery_enabled = false;
 };
\ No newline at end of file
@@ -94,6 +94,7 @@ bool LLHlsStream::Start()
 
 	_packager_config.chunk_duration_ms = llhls_config.GetChunkDuration() * 1000.0;
 	_packager_config.segment_duration_ms = llhls_config.GetSegmentDuration() * 1000.0;
+	_packager_config.progressive_part = llhls_config.IsProgressivePartDeliveryEnabled();
 	// cenc property will be set in AddPackager
 
 	_storage_config.max_segments = llhls_config.GetSegmentCount();
@@ -106,6 +107,7 @@ bool LLHlsStream::Start()
 	_storage_config.dvr_enabled = dvr_config.IsEnabled();
 	_storage_config.dvr_storage_path = dvr_config.GetTempStoragePath();
 	_storage_config.dvr_duration_sec = dvr_config.GetMaxDuration();
+	_storage_config.dvr_max_bytes = static_cast<uint64_t>(std::max(dvr_config.GetMaxStorageSize(), 0)) * 1024 * 1024;
 	_storage_config.server_time_based_segment_numbering = llhls_config.IsServerTimeBasedSegmentNumbering();
 
 	_configured_part_hold_back = llhls_config.GetPartHoldBack();
@@ -149,6 +151,11 @@ bool LLHlsStream::Start()
 
 	_vtt_reference_track_id = first_video_track ? first_video_track->GetId() : first_audio_track ? first_audio_track->GetId() : -1;
 
+	if (_storage_config.dvr_enabled == true)
+	{
+		RecoverDvrSegments();
+	}
+
 	// Set renditions to each chunklist writer
 	{
 		std::lock_guard<std::shared_mutex> lock(_chunklist_map_lock);
@@ -225,6 +232,12 @@ bool LLHlsStream::Start()
 		}
 	}
 
+	if (CreatePackagingWorkers(llhls_config.GetPackagingWorkerCount()) == false)
+	{
+		logte("LLHlsStream(%s/%s) - Failed to create packaging workers", GetApplication()->GetVHostAppName().CStr(), GetName().CStr());
+		return false;
+	}
+
 	logti("LLHlsStream has been created : %s/%u\nOriginMode(%s) Chunk Duration(%.2f) Segment Duration(%.2f) Segment Count(%u) DRM(%s)", GetName().CStr(), GetId(),
 		  ov::Converter::ToString(llhls_config.IsOriginMode()).CStr(), llhls_config.GetChunkDuration(), llhls_config.GetSegmentDuration(), llhls_config.GetSegmentCount(), bmff::CencProtectSchemeToString(_cenc_property.scheme));
 
@@ -235,6 +248,9 @@ bool LLHlsStream::Stop()
 {
 	logtd("LLHlsStream(%s) has been stopped", GetName().CStr());
 
+	// Packaging tasks take the locks below, so the workers are stopped first
+	StopPackagingWorkers();
+
 	{
 		std::scoped_lock lock{_packager_map_lock, _storage_map_lock, _chunklist_map_lock, _master_playlists_lock, _dumps_lock};
 
@@ -262,6 +278,9 @@ bool LLHlsStream::Stop()
 		}
 	}
 
+	// Pending requests are released along with the sessions
+	_waiter_index.Clear();
+
 	return Stream::Stop();
 }
 
@@ -275,18 +294,22 @@ std::tuple<bool, ov::String> LLHlsStream::ConcludeLive()
 
 	_concluded = true;
 
-	// Flush all packagers
+	// Flush all packagers, after the samples already queued to the packaging workers
 	for (auto &it : _packager_map)
 	{
 		auto packager = it.second;
-		packager->Flush();
+		RunPackagingTask(it.first, [packager]() {
+			packager->Flush();
+		});
 	}
 
-	// Append #EXT-X-ENDLIST all chunklists
+	// Append #EXT-X-ENDLIST all chunklists, after the last part of the track is appended
 	for (auto &it : _chunklist_map)
 	{
 		auto chunklist_writer = it.second;
-		chunklist_writer->SetEndList();
+		RunPackagingTask(it.first, [chunklist_writer]() {
+			chunklist_writer->SetEndList();
+		});
 	}
 
 	return {true, ""};
@@ -865,6 +888,17 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	return {RequestResult::Success, segment->GetData()};
 }
 
+std::shared_ptr<ov::FileRegion> LLHlsStream::GetSegmentFileRegion(const int32_t &track_id, const int64_t &segment_number) const
+{
+	auto storage = std::dynamic_pointer_cast<bmff::FMP4Storage>(GetStorage(track_id));
+	if (storage == nullptr)
+	{
+		return nullptr;
+	}
+
+	return storage->GetSegmentFileRegion(segment_number);
+}
+
 std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetPartial(const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number) const
 {
 	logtd("LLHlsStream(%s) - GetChunk(%d, %ld, %ld)", GetName().CStr(), track_id, segment_number, partial_number);
@@ -899,6 +933,28 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	return {RequestResult::Success, partial->GetData()};
 }
 
+bool LLHlsStream::GetBuildingPartialFragments(const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number, size_t from_index, std::vector<std::shared_ptr<const ov::Data>> &fragments) const
+{
+	auto storage = std::dynamic_pointer_cast<bmff::FMP4Storage>(GetStorage(track_id));
+	if (storage == nullptr)
+	{
+		return false;
+	}
+
+	return storage->GetBuildingPartialFragments(segment_number, partial_number, from_index, fragments);
+}
+
+bool LLHlsStream::GetPreloadHint(const int32_t &track_id, int64_t &msn, int64_t &part, ov::String &file_name) const
+{
+	auto chunklist = GetChunklistWriter(track_id);
+	if (chunklist == nullptr)
+	{
+		return false;
+	}
+
+	return chunklist->GetPreloadHint(msn, part, file_name);
+}
+
 void LLHlsStream::BufferMediaPacketUntilReadyToPlay(const std::shared_ptr<MediaPacket> &media_packet)
 {
 	if (_initial_media_packet_buffer.Size() >= MAX_INITIAL_MEDIA_PACKET_BUFFER_SIZE)
@@ -1030,7 +1086,10 @@ void LLHlsStream::SendDataFrame(const std::shared_ptr<MediaPacket> &media_packet
 			}
 			logtd("AppendSample : track(%d) length(%d)", media_packet->GetTrackId(), media_packet->GetDataLength());
 
-			packager->ReserveDataPacket(media_packet);
+			// Reserved in order with the samples of the track
+			RunPackagingTask(track->GetId(), [packager, media_packet]() {
+				packager->ReserveDataPacket(media_packet);
+			});
 		}
 	}
 	else if (media_packet->GetBitstreamFormat() == cmn::BitstreamFormat::CUE || media_packet->GetBitstreamFormat() == cmn::BitstreamFormat::SCTE35)
@@ -1305,11 +1364,141 @@ bool LLHlsStream::AppendMediaPacket(const std::shared_ptr<MediaPacket> &media_pa
 
 	logtd("AppendSample : track(%d) length(%d)", media_packet->GetTrackId(), media_packet->GetDataLength());
 
-	packager->AppendSample(media_packet);
+	auto worker = GetPackagingWorker(track->GetId());
+	if (worker == nullptr)
+	{
+		packager->AppendSample(media_packet);
+		return true;
+	}
+
+	// Every audio frame can be decoded by itself
+	auto key_frame = media_packet->IsKeyFrame() || (track->GetMediaType() == cmn::MediaType::Audio);
+
+	// If the worker falls behind, the sample is dropped instead of piling up in the queue
+	worker->PostSampleTask(track->GetId(), key_frame, [packager, media_packet]() {
+		packager->AppendSample(media_packet);
+	});
 
 	return true;
 }
 
+bool LLHlsStream::CreatePackagingWorkers(int worker_count)
+{
+	std::lock_guard<std::shared_mutex> lock(_packaging_worker_map_lock);
+
+	std::vector<std::shared_ptr<const MediaTrack>> video_tracks, audio_tracks;
+	{
+		std::shared_lock<std::shared_mutex> packager_lock(_packager_map_lock);
+		for (const auto &[track_id, packager] : _packager_map)
+		{
+			auto track = GetTrack(track_id);
+			if (track == nullptr)
+			{
+				continue;
+			}
+
+			if (track->GetMediaType() == cmn::MediaType::Video)
+			{
+				video_tracks.push_back(track);
+			}
+			else
+			{
+				audio_tracks.push_back(track);
+			}
+		}
+	}
+
+	auto track_count = static_cast<int>(video_tracks.size() + audio_tracks.size());
+	worker_count = std::min({worker_count, track_count, MAX_LLHLS_PACKAGING_WORKER_COUNT});
+	if (worker_count <= 0)
+	{
+		// All tracks are packaged by the thread that receives the frames
+		return true;
+	}
+
+	for (int i = 0; i < worker_count; i++)
+	{
+		auto worker = std::make_shared<LLHlsPackagingWorker>(ov::String::FormatString("%s/%s #%d", GetApplication()->GetVHostAppName().CStr(), GetName().CStr(), i));
+		if (worker->Start() == false)
+		{
+			for (auto &started_worker : _packaging_workers)
+			{
+				started_worker->Stop();
+			}
+			_packaging_workers.clear();
+
+			return false;
+		}
+
+		_packaging_workers.push_back(worker);
+	}
+
+	// Video tracks are assigned first so that the heavy renditions are spread over the workers
+	size_t index = 0;
+	for (const auto &tracks : {video_tracks, audio_tracks})
+	{
+		for (const auto &track : tracks)
+		{
+			_packaging_worker_map[track->GetId()] = _packaging_workers[index % _packaging_workers.size()];
+			index++;
+		}
+	}
+
+	// VTT parts are made when the part of the reference track is created
+	auto reference_worker_it = _packaging_worker_map.find(_vtt_reference_track_id);
+	if (reference_worker_it != _packaging_worker_map.end())
+	{
+		auto reference_worker = reference_worker_it->second;
+		for (const auto &[vtt_track_id, vtt_packager] : GetVttPackagers())
+		{
+			_packaging_worker_map[vtt_track_id] = reference_worker;
+		}
+	}
+
+	logti("LLHlsStream(%s/%s) - %d tracks are packaged by %d packaging workers", GetApplication()->GetVHostAppName().CStr(), GetName().CStr(), track_count, worker_count);
+
+	return true;
+}
+
+void LLHlsStream::StopPackagingWorkers()
+{
+	std::unique_lock<std::shared_mutex> lock(_packaging_worker_map_lock);
+	auto workers = std::move(_packaging_workers);
+	_packaging_workers.clear();
+	_packaging_worker_map.clear();
+	lock.unlock();
+
+	// A running task may look up the packaging worker, so the workers are stopped without the lock
+	for (auto &worker : workers)
+	{
+		worker->Stop();
+	}
+}
+
+std::shared_ptr<LLHlsPackagingWorker> LLHlsStream::GetPackagingWorker(const int32_t &track_id) const
+{
+	std::shared_lock<std::shared_mutex> lock(_packaging_worker_map_lock);
+	auto it = _packaging_worker_map.find(track_id);
+	if (it == _packaging_worker_map.end())
+	{
+		return nullptr;
+	}
+
+	return it->second;
+}
+
+void LLHlsStream::RunPackagingTask(const int32_t &track_id, LLHlsPackagingWorker::Task task)
+{
+	auto worker = GetPackagingWorker(track_id);
+	if (worker == nullptr)
+	{
+		task();
+		return;
+	}
+
+	worker->PostTask(std::move(task));
+}
+
 double LLHlsStream::ComputeOptimalPartDuration(const std::shared_ptr<const MediaTrack> &track) const
 {
 	auto part_target = _packager_config.chunk_duration_ms;
@@ -1785,22 +1974,42 @@ void LLHlsStream::OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &s
 	auto chunk_duration = static_cast<double>(partial_segment->GetDurationMs()) / static_cast<double>(1000.0);
 
 	// Human readable timestamp
-	if (_first_chunk == true)
+	int64_t wallclock_offset_ms = 0;
 	{
-		_first_chunk = false;
+		// The first chunk of any track sets the offset of all tracks, the tracks may be packaged by different workers
+		std::lock_guard<std::mutex> lock(_wallclock_offset_lock);
+		if (_first_chunk == true)
+		{
+			_first_chunk = false;
 
-		auto first_chunk_timestamp_ms = (static_cast<double>(partial_segment->GetStartTimestamp()) / GetTrack(track_id)->GetTimeBase().GetTimescale()) * 1000.0;
+			auto first_chunk_timestamp_ms = (static_cast<double>(partial_segment->GetStartTimestamp()) / GetTrack(track_id)->GetTimeBase().GetTimescale()) * 1000.0;
 
-		_wallclock_offset_ms = std::chrono::duration_cast<std::chrono::milliseconds>(GetInputStreamPublishedTime().time_since_epoch()).count() - first_chunk_timestamp_ms;
+			_wallclock_offset_ms = std::chrono::duration_cast<std::chrono::milliseconds>(GetInputStreamPublishedTime().time_since_epoch()).count() - first_chunk_timestamp_ms;
 
-		for (const auto &[track_id, chunklist] : _chunklist_map)
-		{
-			chunklist->SetWallclockOffset(_wallclock_offset_ms);
+			std::shared_lock<std::shared_mutex> chunklist_lock(_chunklist_map_lock);
+			for (const auto &[track_id, chunklist] : _chunklist_map)
+			{
+				chunklist->SetWallclockOffset(_wallclock_offset_ms);
+			}
+			chunklist_lock.unlock();
+
+			// DVR segments are saved with their wall clock, so they can be listed after restart
+			std::shared_lock<std::shared_mutex> storage_lock(_storage_map_lock);
+			for (const auto &[track_id, storage] : _storage_map)
+			{
+				auto fmp4_storage = std::dynamic_pointer_cast<bmff::FMP4Storage>(storage);
+				if (fmp4_storage != nullptr)
+				{
+					fmp4_storage->SetWallclockOffset(_wallclock_offset_ms);
+				}
+			}
 		}
+
+		wallclock_offset_ms = _wallclock_offset_ms;
 	}
 
 	auto start_timestamp = (static_cast<double>(partial_segment->GetStartTimestamp()) / GetTrack(track_id)->GetTimeBase().GetTimescale()) * 1000.0;
-	start_timestamp += _wallclock_offset_ms;
+	start_timestamp += wallclock_offset_ms;
 
 	auto partial_info = LLHlsChunklist::SegmentInfo(partial_segment->GetNumber(), start_timestamp, chunk_duration, partial_segment->GetDataLength(),
 												  GetPartialSegmentName(track_id, segment_number, partial_segment->GetNumber()),
@@ -1877,6 +2086,81 @@ void LLHlsStream::OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &s
 	}
 }
 
+void LLHlsStream::OnMediaFragmentAppended(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number)
+{
+	// The sessions streaming this part send the new fragment, the waiters are completed by NotifyPlaylistUpdated()
+	auto waiters = _waiter_index.GetStreamWaiters(track_id, segment_number, chunk_number);
+
+	for (auto &waiter : waiters)
+	{
+		auto session = GetSession(waiter->session_id);
+		if (session == nullptr)
+		{
+			continue;
+		}
+
+		SendMessage(session, std::make_any<std::shared_ptr<LLHlsWaiterIndex::Waiter>>(waiter));
+	}
+}
+
+void LLHlsStream::RecoverDvrSegments()
+{
+	std::vector<std::tuple<int32_t, std::shared_ptr<bmff::FMP4Storage>>> storages;
+	{
+		std::shared_lock<std::shared_mutex> lock(_storage_map_lock);
+		for (const auto &[track_id, storage] : _storage_map)
+		{
+			auto fmp4_storage = std::dynamic_pointer_cast<bmff::FMP4Storage>(storage);
+			if (fmp4_storage != nullptr)
+			{
+				storages.emplace_back(track_id, fmp4_storage);
+			}
+		}
+	}
+
+	// All tracks must have the same segment numbers, so the live segments start after the newest recovered segment of any track
+	int64_t first_live_segment_number = 0;
+	for (const auto &[track_id, storage] : storages)
+	{
+		first_live_segment_number = std::max(first_live_segment_number, storage->GetLastSegmentNumber() + 1);
+	}
+
+	size_t recovered_count = 0;
+	for (const auto &[track_id, storage] : storages)
+	{
+		storage->SetInitialSegmentNumber(first_live_segment_number);
+
+		auto chunklist = GetChunklistWriter(track_id);
+		if (chunklist == nullptr)
+		{
+			continue;
+		}
+
+		auto recovered_segments = storage->GetRecoveredSegments();
+		for (const auto &segment : recovered_segments)
+		{
+			// Milliseconds to seconds
+			auto segment_info = LLHlsChunklist::SegmentInfo(segment.segment_number, segment.start_time_ms, segment.duration_ms / 1000.0, segment.length,
+															 GetSegmentName(track_id, segment.segment_number), "", segment.independent, true);
+			chunklist->CreateSegmentInfo(segment_info);
+		}
+
+		if (recovered_segments.empty() == false)
+		{
+			chunklist->SetDiscontinuity(first_live_segment_number);
+			recovered_count = std::max(recovered_count, recovered_segments.size());
+		}
+	}
+
+	_first_live_segment_number = first_live_segment_number;
+
+	if (recovered_count > 0)
+	{
+		logti("LLHlsStream(%s/%s) - %zu DVR segments are recovered, live segments start from %lld",
+			  GetApplication()->GetVHostAppName().CStr(), GetName().CStr(), recovered_count, first_live_segment_number);
+	}
+}
+
 void LLHlsStream::OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t &segment_number)
 {
 	auto playlist = GetChunklistWriter(track_id);
@@ -1886,7 +2170,7 @@ void LLHlsStream::OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t
 		return;
 	}
 
-	if (IsVttEnabled() && track_id == _vtt_reference_track_id)
+	if (IsVttEnabled() && track_id == _vtt_reference_track_id && static_cast<int64_t>(segment_number) >= _first_live_segment_number)
 	{
 		std::shared_lock<std::shared_mutex> vtt_packagers_lock(_vtt_packagers_lock);
 		// If this is a VTT reference track, we need to delete a chunklist for vtt chunklists as well
@@ -1911,13 +2195,86 @@ void LLHlsStream::OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t
 	logtd("Media segment deleted : track_id = %d, segment_number = %d", track_id, segment_number);
 }
 
+bool LLHlsStream::AddWaiter(const std::shared_ptr<LLHlsWaiterIndex::Waiter> &waiter)
+{
+	return _waiter_index.Add(waiter);
+}
+
+void LLHlsStream::RemoveWaiters(session_id_t session_id)
+{
+	_waiter_index.Remove(session_id);
+}
+
+void LLHlsStream::RemoveWaiter(const std::shared_ptr<LLHlsWaiterIndex::Waiter> &waiter)
+{
+	_waiter_index.Remove(waiter);
+}
+
+bool LLHlsStream::IsValidDeliveryDirective(const int32_t &track_id, int64_t msn, int64_t part) const
+{
+	auto chunklist = GetChunklistWriter(track_id);
+	if (chunklist == nullptr)
+	{
+		// Responded with 404 by GetChunklist()
+		return true;
+	}
+
+	int64_t last_msn, last_part;
+	chunklist->GetLastSequenceNumber(last_msn, last_part);
+
+	if (last_msn < 0)
+	{
+		// No part has been created yet, the request is held until the stream is ready
+		return true;
+	}
+
+	// https://datatracker.ietf.org/doc/html/draft-pantos-hls-rfc8216bis#section-6.2.5.2
+	// The server SHOULD return 400 if _HLS_msn is greater than the last MSN plus two,
+	// or if _HLS_part exceeds the last part by the Advance Part Limit. Requests within them are blocked.
+	if (msn > last_msn + 2)
+	{
+		return false;
+	}
+
+	if ((part < 0) || (msn < last_msn))
+	{
+		return true;
+	}
+
+	// The Advance Part Limit is three divided by the Part Target Duration if it is less than one second, or three otherwise
+	auto part_target_duration = chunklist->GetPartTargetDuration();
+	int64_t advance_part_limit = ((part_target_duration > 0.0) && (part_target_duration < 1.0)) ? static_cast<int64_t>(std::ceil(3.0 / part_target_duration)) : 3;
+
+	// Parts ahead of the last one (The number of parts left in the last segment is unknown, so they are not counted)
+	int64_t advance_parts = (msn == last_msn) ? (part - last_part) : (part + 1);
+
+	return advance_parts <= advance_part_limit;
+}
+
 void LLHlsStream::NotifyPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part)
 {
-	// Make std::any for broadcast
-	// I think make_shared is better than copy sizeof(PlaylistUpdatedEvent) to all sessions
-	auto event = std::make_shared<PlaylistUpdatedEvent>(track_id, msn, part);
-	auto notification = std::make_any<std::shared_ptr<PlaylistUpdatedEvent>>(event);
-	BroadcastPacket(notification);
+	// Only the sessions waiting for this part are woken up
+	auto waiters = _waiter_index.Notify(track_id, msn, part);
+	if (waiters.empty())
+	{
+		return;
+	}
+
+	logtd("LLHlsStream(%s) - %zu waiters are completed by track_id = %d, msn = %ld, part = %ld", GetName().CStr(), waiters.size(), track_id, msn, part);
+
+	// This runs on the packaging thread, so the responses (chunklists are rendered and compressed per session
+	// when the query string has the session key) are made by the sessions
+	for (auto &waiter : waiters)
+	{
+		auto session = GetSession(waiter->session_id);
+		if (session == nullptr)
+		{
+			// The session has been deleted
+			continue;
+		}
+
+		SendMessage(session, std::make_any<std::shared_ptr<LLHlsWaiterIndex::Waiter>>(waiter));
+	}
 }
 
 int64_t LLHlsStream::GetMinimumLastSegmentNumber() const
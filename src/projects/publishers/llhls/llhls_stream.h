@@ -19,6 +19,8 @@
 #include "modules/containers/webvtt/webvtt_packager.h"
 #include "llhls_master_playlist.h"
 #include "llhls_chunklist.h"
+#include "llhls_packaging_worker.h"
+#include "llhls_waiter_index.h"
 
 // max initial media packet buffer size, for OOM protection
 #define MAX_INITIAL_MEDIA_PACKET_BUFFER_SIZE		10000
@@ -54,27 +56,30 @@ public:
 		UnknownError,
 	};
 
-	struct PlaylistUpdatedEvent
-	{
-		PlaylistUpdatedEvent(const int32_t &id, const int64_t &new_msn, const int64_t &new_part)
-		{
-			track_id = id;
-			msn = new_msn;
-			part = new_part;
-		}
-
-		int32_t track_id;
-		int64_t msn;
-		int64_t part;
-	};
-	
 	const ov::String &GetStreamKey() const;
 
+	// Holds the request until the track has the part (waiter->msn, waiter->part).
+	// When the part is created, the waiter is sent to the session with SendMessage().
+	// Returns false if the part has already been created, the caller must respond by itself.
+	bool AddWaiter(const std::shared_ptr<LLHlsWaiterIndex::Waiter> &waiter);
+	void RemoveWaiters(session_id_t session_id);
+	void RemoveWaiter(const std::shared_ptr<LLHlsWaiterIndex::Waiter> &waiter);
+	// Returns false if (msn, part) of the delivery directives is beyond the next part of the track,
+	// such a request is responded with 400 Bad Request instead of being held
+	bool IsValidDeliveryDirective(const int32_t &track_id, int64_t msn, int64_t part) const;
+
 	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetMasterPlaylist(const ov::String &file_name, const ov::String &chunk_query_string, bool gzip, bool legacy, bool rewind, bool include_path=true);
 	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetChunklist(const ov::String &chunk_query_string, const int32_t &track_id, int64_t msn, int64_t psn, bool skip, bool gzip, bool legacy, bool rewind) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetInitializationSegment(const int32_t &track_id) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetSegment(const int32_t &track_id, const int64_t &segment_number) const;
+	// Returns the range of the segment in the DVR storage (sendfile()), nullptr if the segment is in memory
+	std::shared_ptr<ov::FileRegion> GetSegmentFileRegion(const int32_t &track_id, const int64_t &segment_number) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetPartial(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const;
+	// Returns false if the part is not being built (progressive part delivery)
+	// otherwise <fragments> has the fragments of the part from <from_index>
+	bool GetBuildingPartialFragments(const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number, size_t from_index, std::vector<std::shared_ptr<const ov::Data>> &fragments) const;
+	// Returns the part that EXT-X-PRELOAD-HINT of the chunklist points to
+	bool GetPreloadHint(const int32_t &track_id, int64_t &msn, int64_t &part, ov::String &file_name) const;
 
 	//////////////////////////
 	// For Dump API
@@ -107,6 +112,7 @@ private:
 	void OnFMp4StorageInitialized(const int32_t &track_id) override;
 	void OnMediaSegmentCreated(const int32_t &track_id, const uint32_t &segment_number) override;
 	void OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number, bool last_chunk) override;
+	void OnMediaFragmentAppended(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number) override;
 	void OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t &segment_number) override;
 
 	// Create and Get fMP4 packager and storage with track info, storage and packager_config
@@ -129,9 +135,19 @@ private:
 
 	bool AppendMediaPacket(const std::shared_ptr<MediaPacket> &media_packet);
 
+	// Packaging workers, the tracks are packaged in parallel if PackagingWorkerCount is set
+	bool CreatePackagingWorkers(int worker_count);
+	void StopPackagingWorkers();
+	std::shared_ptr<LLHlsPackagingWorker> GetPackagingWorker(const int32_t &track_id) const;
+	// Runs the task on the packaging worker of the track, or immediately if the track has no worker
+	void RunPackagingTask(const int32_t &track_id, LLHlsPackagingWorker::Task task);
+
 	bool IsReadyToPlay() const;
 	bool CheckPlaylistReady();
 
+	// Lists the DVR segments left by the previous process in the chunklists, the live segments continue after them
+	void RecoverDvrSegments();
+
 	void DumpMasterPlaylistsOfAllItems();
 	bool DumpMasterPlaylist(const std::shared_ptr<mdl::Dump> &item);
 	void DumpInitSegmentOfAllItems(const int32_t &track_id);
@@ -165,6 +181,11 @@ private:
 	std::map<int32_t, std::shared_ptr<LLHlsChunklist>> _chunklist_map;
 	mutable std::shared_mutex _chunklist_map_lock;
 
+	std::vector<std::shared_ptr<LLHlsPackagingWorker>> _packaging_workers;
+	// Track ID : Packaging worker, VTT tracks use the worker of the VTT reference track
+	std::map<int32_t, std::shared_ptr<LLHlsPackagingWorker>> _packaging_worker_map;
+	mutable std::shared_mutex _packaging_worker_map_lock;
+
 	uint64_t _max_chunk_duration_ms = 0;
 	uint64_t _min_chunk_duration_ms = std::numeric_limits<uint64_t>::max();
 
@@ -174,6 +195,8 @@ private:
 	std::map<ov::String, std::shared_ptr<LLHlsMasterPlaylist>> _master_playlists;
 	std::mutex _master_playlists_lock;
 
+	LLHlsWaiterIndex _waiter_index;
+
 	bool _playlist_ready = false;
 	mutable std::shared_mutex _playlist_ready_lock;
 
@@ -199,9 +222,13 @@ private:
 	bmff::CencProperty _cenc_property;
 	ov::String _key_uri; // string, only for FairPlay
 
+	// Segments older than this are recovered from DVR, they have no VTT segments
+	int64_t _first_live_segment_number = 0;
+
 	// PROGRAM-DATE-TIME
 	bool _first_chunk = true;
 	int64_t _wallclock_offset_ms = 0;
+	std::mutex _wallclock_offset_lock;
 
 	// ConcludeLive
 	// Append #EXT-X-ENDLIST all chunklists, and no more update segment and chunklist
@@ -0,0 +1,221 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#include "llhls_waiter_index.h"
+
+#include <algorithm>
+
+bool LLHlsWaiterIndex::Add(const std::shared_ptr<Waiter> &waiter)
+{
+	if (waiter == nullptr)
+	{
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto &track_index = (waiter->type == RequestType::Playlist) ? _any_track_index : _track_index_map[waiter->track_id];
+
+	if (AddToTrackIndex(track_index, waiter) == false)
+	{
+		return false;
+	}
+
+	_session_waiters_map[waiter->session_id].push_back(waiter);
+
+	return true;
+}
+
+bool LLHlsWaiterIndex::AddToTrackIndex(TrackIndex &track_index, const std::shared_ptr<Waiter> &waiter)
+{
+	Key key{waiter->msn, waiter->part};
+
+	if (key <= track_index.last_notified_key)
+	{
+		// The part was created while the request was being processed
+		return false;
+	}
+
+	track_index.waiter_map[key].push_back(waiter);
+	_waiter_count++;
+
+	return true;
+}
+
+std::vector<std::shared_ptr<LLHlsWaiterIndex::Waiter>> LLHlsWaiterIndex::Notify(int32_t track_id, int64_t msn, int64_t part)
+{
+	std::vector<std::shared_ptr<Waiter>> completed_waiters;
+	Key key{msn, part};
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	PopCompletedWaiters(_track_index_map[track_id], key, completed_waiters);
+	PopCompletedWaiters(_any_track_index, key, completed_waiters);
+
+	for (const auto &waiter : completed_waiters)
+	{
+		RemoveFromSessionIndex(waiter);
+	}
+
+	return completed_waiters;
+}
+
+std::vector<std::shared_ptr<LLHlsWaiterIndex::Waiter>> LLHlsWaiterIndex::GetStreamWaiters(int32_t track_id, int64_t msn, int64_t part) const
+{
+	std::vector<std::shared_ptr<Waiter>> stream_waiters;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto track_it = _track_index_map.find(track_id);
+	if (track_it == _track_index_map.end())
+	{
+		return stream_waiters;
+	}
+
+	auto waiters_it = track_it->second.waiter_map.find({msn, part});
+	if (waiters_it == track_it->second.waiter_map.end())
+	{
+		return stream_waiters;
+	}
+
+	for (const auto &waiter : waiters_it->second)
+	{
+		if (waiter->type == RequestType::PartialSegmentStream)
+		{
+			stream_waiters.push_back(waiter);
+		}
+	}
+
+	return stream_waiters;
+}
+
+void LLHlsWaiterIndex::PopCompletedWaiters(TrackIndex &track_index, const Key &key, std::vector<std::shared_ptr<Waiter>> &completed_waiters)
+{
+	if (track_index.last_notified_key < key)
+	{
+		track_index.last_notified_key = key;
+	}
+
+	// Every waiter whose (msn, part) <= the new part is completed
+	auto end = track_index.waiter_map.upper_bound(track_index.last_notified_key);
+
+	for (auto it = track_index.waiter_map.begin(); it != end; ++it)
+	{
+		auto &waiters = it->second;
+
+		completed_waiters.insert(completed_waiters.end(), waiters.begin(), waiters.end());
+		_waiter_count -= waiters.size();
+	}
+
+	track_index.waiter_map.erase(track_index.waiter_map.begin(), end);
+}
+
+void LLHlsWaiterIndex::Remove(session_id_t session_id)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto session_it = _session_waiters_map.find(session_id);
+	if (session_it == _session_waiters_map.end())
+	{
+		return;
+	}
+
+	for (const auto &waiter : session_it->second)
+	{
+		RemoveFromTrackIndex(waiter);
+	}
+
+	_session_waiters_map.erase(session_it);
+}
+
+void LLHlsWaiterIndex::Remove(const std::shared_ptr<Waiter> &waiter)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (RemoveFromTrackIndex(waiter))
+	{
+		RemoveFromSessionIndex(waiter);
+	}
+}
+
+bool LLHlsWaiterIndex::RemoveFromTrackIndex(const std::shared_ptr<Waiter> &waiter)
+{
+	TrackIndex *track_index = &_any_track_index;
+
+	if (waiter->type != RequestType::Playlist)
+	{
+		auto track_index_it = _track_index_map.find(waiter->track_id);
+		if (track_index_it == _track_index_map.end())
+		{
+			return false;
+		}
+
+		track_index = &track_index_it->second;
+	}
+
+	auto waiters_it = track_index->waiter_map.find({waiter->msn, waiter->part});
+	if (waiters_it == track_index->waiter_map.end())
+	{
+		return false;
+	}
+
+	auto &waiters = waiters_it->second;
+	auto item_it = std::find(waiters.begin(), waiters.end(), waiter);
+	if (item_it == waiters.end())
+	{
+		return false;
+	}
+
+	waiters.erase(item_it);
+	_waiter_count--;
+
+	if (waiters.empty())
+	{
+		track_index->waiter_map.erase(waiters_it);
+	}
+
+	return true;
+}
+
+void LLHlsWaiterIndex::RemoveFromSessionIndex(const std::shared_ptr<Waiter> &waiter)
+{
+	auto session_it = _session_waiters_map.find(waiter->session_id);
+	if (session_it == _session_waiters_map.end())
+	{
+		return;
+	}
+
+	// A session has only a few waiters at a time
+	auto &waiters = session_it->second;
+	auto item_it = std::find(waiters.begin(), waiters.end(), waiter);
+	if (item_it != waiters.end())
+	{
+		waiters.erase(item_it);
+	}
+
+	if (waiters.empty())
+	{
+		_session_waiters_map.erase(session_it);
+	}
+}
+
+void LLHlsWaiterIndex::Clear()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_track_index_map.clear();
+	_any_track_index = TrackIndex();
+	_session_waiters_map.clear();
+	_waiter_count = 0;
+}
+
+size_t LLHlsWaiterIndex::GetWaiterCount() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _waiter_count;
+}
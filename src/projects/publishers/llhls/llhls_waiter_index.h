@@ -0,0 +1,106 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/common_types.h>
+#include <base/info/session.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <modules/http/server/http_exchange.h>
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Requests held until a part is created (Blocking Playlist Reload, Blocking Preload Hint)
+//
+// Waiters are indexed by track and (msn, part), so a new part completes exactly the waiters
+// that asked for it instead of waking every session of the stream.
+class LLHlsWaiterIndex
+{
+public:
+	enum class RequestType : uint8_t
+	{
+		// llhls.m3u8, waits for any track
+		Playlist,
+		Chunklist,
+		PartialSegment,
+		// The part being built, it is sent progressively whenever a fragment is appended
+		PartialSegmentStream,
+	};
+
+	struct Waiter
+	{
+		RequestType type = RequestType::Chunklist;
+		session_id_t session_id = 0;
+		std::shared_ptr<http::svr::HttpExchange> exchange;
+
+		ov::String file_name;
+		int32_t track_id = -1;
+		int64_t msn = -1;
+		int64_t part = -1;
+
+		// Chunklist - waiters with the same values get the same response
+		ov::String query_string;
+		bool skip = false;
+		bool legacy = false;
+		bool rewind = false;
+		bool gzip = false;
+
+		// PartialSegmentStream - updated only by the session
+		size_t sent_fragment_count = 0;
+		size_t sent_bytes = 0;
+		bool stream_finished = false;
+	};
+
+	// Returns false if (msn, part) of the waiter has already been notified.
+	// In this case the waiter is not added and the caller must respond by itself.
+	bool Add(const std::shared_ptr<Waiter> &waiter);
+
+	// Removes and returns the waiters completed by the new part (msn, part) of the track
+	std::vector<std::shared_ptr<Waiter>> Notify(int32_t track_id, int64_t msn, int64_t part);
+
+	// Returns the PartialSegmentStream waiters of the part (msn, part) being built, they are kept in the index
+	std::vector<std::shared_ptr<Waiter>> GetStreamWaiters(int32_t track_id, int64_t msn, int64_t part) const;
+
+	// Removes the waiters of the session, called when the session is stopped
+	void Remove(session_id_t session_id);
+	// Removes the waiter, called when its request is cancelled (e.g. the client reset the pushed stream)
+	void Remove(const std::shared_ptr<Waiter> &waiter);
+
+	void Clear();
+
+	size_t GetWaiterCount() const;
+
+private:
+	// (msn, part)
+	using Key = std::pair<int64_t, int64_t>;
+
+	struct TrackIndex
+	{
+		Key last_notified_key{-1, -1};
+		std::map<Key, std::vector<std::shared_ptr<Waiter>>> waiter_map;
+	};
+
+	bool AddToTrackIndex(TrackIndex &track_index, const std::shared_ptr<Waiter> &waiter);
+	// Returns false if the waiter is not in the index
+	bool RemoveFromTrackIndex(const std::shared_ptr<Waiter> &waiter);
+	void RemoveFromSessionIndex(const std::shared_ptr<Waiter> &waiter);
+	void PopCompletedWaiters(TrackIndex &track_index, const Key &key, std::vector<std::shared_ptr<Waiter>> &completed_waiters);
+
+	mutable std::mutex _mutex;
+
+	// Track ID : TrackIndex
+	std::map<int32_t, TrackIndex> _track_index_map;
+	// Waiters completed by a part of any track
+	TrackIndex _any_track_index;
+	// Session ID : Waiters of the session (the same waiters as in the track indexes, to remove them without a full scan)
+	std::unordered_map<session_id_t, std::vector<std::shared_ptr<Waiter>>> _session_waiters_map;
+
+	size_t _waiter_count = 0;
+};
@@ -0,0 +1,430 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtc_bandwidth_estimator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "rtc_private.h"
+
+// Packets sent within this interval are grouped, the delay is measured between the groups
+#define BWE_BURST_INTERVAL_US 5000
+
+// Trendline filter
+#define BWE_TRENDLINE_WINDOW_SIZE 20
+#define BWE_TRENDLINE_SMOOTHING_COEFF 0.9
+#define BWE_TRENDLINE_THRESHOLD_GAIN 4.0
+#define BWE_MAX_NUM_OF_DELTAS 60
+
+// Overuse detector
+#define BWE_OVERUSING_TIME_THRESHOLD_MS 10.0
+#define BWE_THRESHOLD_K_UP 0.0087
+#define BWE_THRESHOLD_K_DOWN 0.039
+#define BWE_MIN_THRESHOLD 6.0
+#define BWE_MAX_THRESHOLD 600.0
+#define BWE_MAX_ADAPT_OFFSET 15.0
+#define BWE_MAX_THRESHOLD_TIME_DELTA_MS 100
+
+// AIMD rate control
+#define BWE_INCREASE_FACTOR_PER_SECOND 1.08
+#define BWE_DECREASE_FACTOR 0.85
+#define BWE_MIN_DECREASE_INTERVAL_MS 200
+// The estimate does not go too far beyond what has actually been delivered
+#define BWE_MAX_ACKED_BITRATE_RATIO 1.5
+#define BWE_ACKED_BITRATE_MARGIN_BPS 10000
+
+// Loss-based
+#define BWE_MIN_PACKETS_FOR_LOSS 20
+#define BWE_HIGH_LOSS_RATIO 0.1
+#define BWE_LOW_LOSS_RATIO 0.02
+#define BWE_LOSS_INCREASE_FACTOR 1.05
+#define BWE_MIN_LOSS_DECREASE_INTERVAL_MS 300
+
+// Acked bitrate
+#define BWE_ACKED_WINDOW_MS 500
+#define BWE_ACKED_MIN_WINDOW_MS 100
+
+RtcBandwidthEstimator::RtcBandwidthEstimator(int64_t start_bitrate_bps, int64_t min_bitrate_bps, int64_t max_bitrate_bps)
+	: _min_bitrate_bps(min_bitrate_bps),
+	  _max_bitrate_bps(max_bitrate_bps)
+{
+	start_bitrate_bps = std::clamp(start_bitrate_bps, _min_bitrate_bps, _max_bitrate_bps);
+
+	_delay_based_bitrate_bps = start_bitrate_bps;
+	_loss_based_bitrate_bps = start_bitrate_bps;
+}
+
+void RtcBandwidthEstimator::OnFeedback(int64_t now_ms, const std::vector<PacketResult> &results)
+{
+	if (results.empty())
+	{
+		return;
+	}
+
+	size_t lost_count = 0;
+
+	for (const auto &result : results)
+	{
+		if (result.arrival_time_us < 0)
+		{
+			lost_count++;
+			continue;
+		}
+
+		UpdateAckedBitrate(result);
+		OnPacketArrived(now_ms, result);
+	}
+
+	UpdateLossBasedBitrate(now_ms, lost_count, results.size());
+	UpdateDelayBasedBitrate(now_ms);
+
+	_has_estimate = true;
+}
+
+bool RtcBandwidthEstimator::HasEstimate() const
+{
+	return _has_estimate;
+}
+
+int64_t RtcBandwidthEstimator::GetEstimatedBitrate() const
+{
+	return std::clamp(std::min(_delay_based_bitrate_bps, _loss_based_bitrate_bps), _min_bitrate_bps, _max_bitrate_bps);
+}
+
+int64_t RtcBandwidthEstimator::GetAckedBitrate() const
+{
+	return _acked_bitrate_bps;
+}
+
+RtcBandwidthEstimator::BandwidthUsage RtcBandwidthEstimator::GetBandwidthUsage() const
+{
+	return _bandwidth_usage;
+}
+
+double RtcBandwidthEstimator::GetLossRatio() const
+{
+	return _loss_ratio;
+}
+
+void RtcBandwidthEstimator::OnPacketArrived(int64_t now_ms, const PacketResult &result)
+{
+	if (_current_group.IsValid() == false)
+	{
+		_current_group.first_send_time_us = result.send_time_us;
+		_current_group.last_send_time_us = result.send_time_us;
+		_current_group.last_arrival_time_us = result.arrival_time_us;
+		_current_group.size = result.size;
+		return;
+	}
+
+	if (result.send_time_us < _current_group.first_send_time_us)
+	{
+		// Reordered packet of the previous group
+		return;
+	}
+
+	if ((result.send_time_us - _current_group.first_send_time_us) <= BWE_BURST_INTERVAL_US)
+	{
+		_current_group.last_send_time_us = std::max(_current_group.last_send_time_us, result.send_time_us);
+		_current_group.last_arrival_time_us = std::max(_current_group.last_arrival_time_us, result.arrival_time_us);
+		_current_group.size += result.size;
+		return;
+	}
+
+	// The packet starts a new group, so the current group is completed
+	if (_prev_group.IsValid())
+	{
+		OnGroupCompleted(now_ms, _current_group);
+	}
+
+	_prev_group = _current_group;
+
+	_current_group.first_send_time_us = result.send_time_us;
+	_current_group.last_send_time_us = result.send_time_us;
+	_current_group.last_arrival_time_us = result.arrival_time_us;
+	_current_group.size = result.size;
+}
+
+void RtcBandwidthEstimator::OnGroupCompleted(int64_t now_ms, const PacketGroup &group)
+{
+	double send_delta_ms = static_cast<double>(group.last_send_time_us - _prev_group.last_send_time_us) / 1000.0;
+	double arrival_delta_ms = static_cast<double>(group.last_arrival_time_us - _prev_group.last_arrival_time_us) / 1000.0;
+
+	if (arrival_delta_ms < 0.0)
+	{
+		// The clock of the receiver has been reset or the packets have been reordered
+		logtd("BWE - Negative arrival delta(%f), the group is ignored", arrival_delta_ms);
+		return;
+	}
+
+	UpdateTrendline(now_ms, send_delta_ms, arrival_delta_ms, group.last_arrival_time_us / 1000);
+}
+
+void RtcBandwidthEstimator::UpdateTrendline(int64_t now_ms, double send_delta_ms, double arrival_delta_ms, int64_t arrival_time_ms)
+{
+	double delta_ms = arrival_delta_ms - send_delta_ms;
+
+	_num_of_deltas = std::min<size_t>(_num_of_deltas + 1, 1000);
+
+	if (_first_arrival_time_ms < 0)
+	{
+		_first_arrival_time_ms = arrival_time_ms;
+	}
+
+	// Exponential backoff filter
+	_accumulated_delay_ms += delta_ms;
+	_smoothed_delay_ms = (BWE_TRENDLINE_SMOOTHING_COEFF * _smoothed_delay_ms) + ((1.0 - BWE_TRENDLINE_SMOOTHING_COEFF) * _accumulated_delay_ms);
+
+	_delay_history.emplace_back(static_cast<double>(arrival_time_ms - _first_arrival_time_ms), _smoothed_delay_ms);
+	if (_delay_history.size() > BWE_TRENDLINE_WINDOW_SIZE)
+	{
+		_delay_history.pop_front();
+	}
+
+	double trend = _prev_trend;
+	if (_delay_history.size() == BWE_TRENDLINE_WINDOW_SIZE)
+	{
+		// 0 < trend < 1 : the delay increases, the queues are being filled up
+		// trend == 0 : the delay does not change
+		// trend < 0 : the delay decreases, the queues are being emptied
+		trend = GetTrendlineSlope();
+	}
+
+	DetectOveruse(now_ms, trend, send_delta_ms);
+
+	_prev_trend = trend;
+}
+
+double RtcBandwidthEstimator::GetTrendlineSlope() const
+{
+	// Linear regression of the smoothed delay over the arrival time
+	double sum_x = 0.0;
+	double sum_y = 0.0;
+
+	for (const auto &[x, y] : _delay_history)
+	{
+		sum_x += x;
+		sum_y += y;
+	}
+
+	double avg_x = sum_x / _delay_history.size();
+	double avg_y = sum_y / _delay_history.size();
+
+	double numerator = 0.0;
+	double denominator = 0.0;
+
+	for (const auto &[x, y] : _delay_history)
+	{
+		numerator += (x - avg_x) * (y - avg_y);
+		denominator += (x - avg_x) * (x - avg_x);
+	}
+
+	if (denominator == 0.0)
+	{
+		return _prev_trend;
+	}
+
+	return numerator / denominator;
+}
+
+void RtcBandwidthEstimator::DetectOveruse(int64_t now_ms, double trend, double send_delta_ms)
+{
+	if (_num_of_deltas < 2)
+	{
+		_bandwidth_usage = BandwidthUsage::Normal;
+		return;
+	}
+
+	double modified_trend = std::min<size_t>(_num_of_deltas, BWE_MAX_NUM_OF_DELTAS) * trend * BWE_TRENDLINE_THRESHOLD_GAIN;
+
+	if (modified_trend > _threshold)
+	{
+		if (_time_over_using_ms < 0.0)
+		{
+			// Assume that the overuse started halfway between the groups
+			_time_over_using_ms = send_delta_ms / 2.0;
+		}
+		else
+		{
+			_time_over_using_ms += send_delta_ms;
+		}
+
+		_overuse_counter++;
+
+		// The delay must keep increasing for a while to be detected as overuse
+		if ((_time_over_using_ms > BWE_OVERUSING_TIME_THRESHOLD_MS) && (_overuse_counter > 1) && (trend >= _prev_trend))
+		{
+			_time_over_using_ms = 0.0;
+			_overuse_counter = 0;
+			_bandwidth_usage = BandwidthUsage::Overusing;
+		}
+	}
+	else if (modified_trend < -_threshold)
+	{
+		_time_over_using_ms = -1.0;
+		_overuse_counter = 0;
+		_bandwidth_usage = BandwidthUsage::Underusing;
+	}
+	else
+	{
+		_time_over_using_ms = -1.0;
+		_overuse_counter = 0;
+		_bandwidth_usage = BandwidthUsage::Normal;
+	}
+
+	UpdateThreshold(modified_trend, now_ms);
+}
+
+void RtcBandwidthEstimator::UpdateThreshold(double modified_trend, int64_t now_ms)
+{
+	if (_last_threshold_update_ms < 0)
+	{
+		_last_threshold_update_ms = now_ms;
+	}
+
+	double abs_trend = std::fabs(modified_trend);
+
+	if (abs_trend > (_threshold + BWE_MAX_ADAPT_OFFSET))
+	{
+		// Spikes are not used to adapt the threshold, they would make it insensitive
+		_last_threshold_update_ms = now_ms;
+		return;
+	}
+
+	// The threshold follows the trend slowly when it goes up, quickly when it goes down
+	double k = (abs_trend < _threshold) ? BWE_THRESHOLD_K_DOWN : BWE_THRESHOLD_K_UP;
+	int64_t time_delta_ms = std::min<int64_t>(now_ms - _last_threshold_update_ms, BWE_MAX_THRESHOLD_TIME_DELTA_MS);
+
+	_threshold += k * (abs_trend - _threshold) * time_delta_ms;
+	_threshold = std::clamp(_threshold, BWE_MIN_THRESHOLD, BWE_MAX_THRESHOLD);
+
+	_last_threshold_update_ms = now_ms;
+}
+
+void RtcBandwidthEstimator::UpdateDelayBasedBitrate(int64_t now_ms)
+{
+	// State transition
+	switch (_bandwidth_usage)
+	{
+		case BandwidthUsage::Overusing:
+			_rate_control_state = RateControlState::Decrease;
+			break;
+
+		case BandwidthUsage::Underusing:
+			// The queues are being emptied, wait until they are empty
+			_rate_control_state = RateControlState::Hold;
+			break;
+
+		case BandwidthUsage::Normal:
+			if (_rate_control_state == RateControlState::Hold)
+			{
+				_rate_control_state = RateControlState::Increase;
+			}
+			else if (_rate_control_state == RateControlState::Decrease)
+			{
+				_rate_control_state = RateControlState::Hold;
+			}
+			break;
+	}
+
+	int64_t elapsed_ms = (_last_rate_update_ms < 0) ? 0 : (now_ms - _last_rate_update_ms);
+	_last_rate_update_ms = now_ms;
+
+	switch (_rate_control_state)
+	{
+		case RateControlState::Increase: {
+			double factor = std::pow(BWE_INCREASE_FACTOR_PER_SECOND, std::min<double>(elapsed_ms / 1000.0, 1.0));
+			auto bitrate_bps = static_cast<int64_t>(_delay_based_bitrate_bps * factor) + 1000;
+
+			if (_acked_bitrate_bps > 0)
+			{
+				// Don't increase the estimate when the sender doesn't use it
+				auto limit_bps = static_cast<int64_t>(BWE_MAX_ACKED_BITRATE_RATIO * _acked_bitrate_bps) + BWE_ACKED_BITRATE_MARGIN_BPS;
+				bitrate_bps = std::max(std::min(bitrate_bps, limit_bps), _delay_based_bitrate_bps);
+			}
+
+			_delay_based_bitrate_bps = bitrate_bps;
+			break;
+		}
+
+		case RateControlState::Decrease:
+			if ((_last_decrease_ms < 0) || ((now_ms - _last_decrease_ms) >= BWE_MIN_DECREASE_INTERVAL_MS))
+			{
+				auto base_bps = (_acked_bitrate_bps > 0) ? _acked_bitrate_bps : _delay_based_bitrate_bps;
+				auto bitrate_bps = static_cast<int64_t>(BWE_DECREASE_FACTOR * base_bps);
+
+				logtd("BWE - Overusing is detected, the estimate is decreased from %lld to %lld (acked: %lld)",
+					  _delay_based_bitrate_bps, std::min(bitrate_bps, _delay_based_bitrate_bps), _acked_bitrate_bps);
+
+				_delay_based_bitrate_bps = std::min(bitrate_bps, _delay_based_bitrate_bps);
+				_last_decrease_ms = now_ms;
+			}
+
+			_rate_control_state = RateControlState::Hold;
+			break;
+
+		case RateControlState::Hold:
+			break;
+	}
+
+	_delay_based_bitrate_bps = std::clamp(_delay_based_bitrate_bps, _min_bitrate_bps, _max_bitrate_bps);
+}
+
+void RtcBandwidthEstimator::UpdateLossBasedBitrate(int64_t now_ms, size_t lost_count, size_t total_count)
+{
+	_lost_packets_since_update += lost_count;
+	_packets_since_update += total_count;
+
+	if (_packets_since_update < BWE_MIN_PACKETS_FOR_LOSS)
+	{
+		return;
+	}
+
+	_loss_ratio = static_cast<double>(_lost_packets_since_update) / _packets_since_update;
+
+	_lost_packets_since_update = 0;
+	_packets_since_update = 0;
+
+	if (_loss_ratio > BWE_HIGH_LOSS_RATIO)
+	{
+		if ((_last_loss_decrease_ms < 0) || ((now_ms - _last_loss_decrease_ms) >= BWE_MIN_LOSS_DECREASE_INTERVAL_MS))
+		{
+			auto base_bps = std::min(_loss_based_bitrate_bps, _delay_based_bitrate_bps);
+			_loss_based_bitrate_bps = static_cast<int64_t>(base_bps * (1.0 - (0.5 * _loss_ratio)));
+			_last_loss_decrease_ms = now_ms;
+
+			logtd("BWE - Heavy loss(%.2f%%), the estimate is decreased to %lld", _loss_ratio * 100.0, _loss_based_bitrate_bps);
+		}
+	}
+	else if (_loss_ratio < BWE_LOW_LOSS_RATIO)
+	{
+		_loss_based_bitrate_bps = static_cast<int64_t>(_loss_based_bitrate_bps * BWE_LOSS_INCREASE_FACTOR);
+	}
+
+	_loss_based_bitrate_bps = std::clamp(_loss_based_bitrate_bps, _min_bitrate_bps, _max_bitrate_bps);
+}
+
+void RtcBandwidthEstimator::UpdateAckedBitrate(const PacketResult &result)
+{
+	auto arrival_time_ms = result.arrival_time_us / 1000;
+
+	_acked_history.emplace_back(arrival_time_ms, result.size);
+	_acked_history_bytes += result.size;
+
+	while ((_acked_history.empty() == false) && (_acked_history.front().first < (arrival_time_ms - BWE_ACKED_WINDOW_MS)))
+	{
+		_acked_history_bytes -= _acked_history.front().second;
+		_acked_history.pop_front();
+	}
+
+	auto window_ms = _acked_history.back().first - _acked_history.front().first;
+	if (window_ms >= BWE_ACKED_MIN_WINDOW_MS)
+	{
+		_acked_bitrate_bps = static_cast<int64_t>(_acked_history_bytes) * 8 * 1000 / window_ms;
+	}
+}
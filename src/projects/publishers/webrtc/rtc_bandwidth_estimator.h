@@ -0,0 +1,128 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <deque>
+#include <vector>
+
+// Send-side bandwidth estimation using the TransportCC feedback (draft-ietf-rmcat-gcc-02)
+//
+// The delay-based estimate is controlled by the trend of the one-way delay variation (trendline filter
+// + overuse detector + AIMD rate control), and the loss-based estimate is lowered when the feedback reports
+// heavy loss. The estimated bitrate is the lower of the two.
+class RtcBandwidthEstimator
+{
+public:
+	struct PacketResult
+	{
+		int64_t send_time_us = 0;
+		// -1 if the packet has not been received
+		int64_t arrival_time_us = -1;
+		size_t size = 0;
+	};
+
+	enum class BandwidthUsage : uint8_t
+	{
+		Normal,
+		Underusing,
+		Overusing,
+	};
+
+	RtcBandwidthEstimator(int64_t start_bitrate_bps, int64_t min_bitrate_bps, int64_t max_bitrate_bps);
+
+	// results must be in the order of the transport-wide sequence number
+	void OnFeedback(int64_t now_ms, const std::vector<PacketResult> &results);
+
+	// true after the first feedback is received
+	bool HasEstimate() const;
+	int64_t GetEstimatedBitrate() const;
+	int64_t GetAckedBitrate() const;
+	BandwidthUsage GetBandwidthUsage() const;
+	double GetLossRatio() const;
+
+private:
+	struct PacketGroup
+	{
+		int64_t first_send_time_us = -1;
+		int64_t last_send_time_us = -1;
+		int64_t last_arrival_time_us = -1;
+		size_t size = 0;
+
+		bool IsValid() const
+		{
+			return first_send_time_us >= 0;
+		}
+	};
+
+	enum class RateControlState : uint8_t
+	{
+		Hold,
+		Increase,
+		Decrease,
+	};
+
+	// Delay-based
+	void OnPacketArrived(int64_t now_ms, const PacketResult &result);
+	void OnGroupCompleted(int64_t now_ms, const PacketGroup &group);
+	void UpdateTrendline(int64_t now_ms, double send_delta_ms, double arrival_delta_ms, int64_t arrival_time_ms);
+	double GetTrendlineSlope() const;
+	void DetectOveruse(int64_t now_ms, double trend, double send_delta_ms);
+	void UpdateThreshold(double modified_trend, int64_t now_ms);
+	void UpdateDelayBasedBitrate(int64_t now_ms);
+
+	// Loss-based
+	void UpdateLossBasedBitrate(int64_t now_ms, size_t lost_count, size_t total_count);
+
+	void UpdateAckedBitrate(const PacketResult &result);
+
+	int64_t _min_bitrate_bps = 0;
+	int64_t _max_bitrate_bps = 0;
+
+	bool _has_estimate = false;
+
+	// Inter-arrival
+	PacketGroup _current_group;
+	PacketGroup _prev_group;
+
+	// Trendline filter
+	size_t _num_of_deltas = 0;
+	int64_t _first_arrival_time_ms = -1;
+	double _accumulated_delay_ms = 0.0;
+	double _smoothed_delay_ms = 0.0;
+	// <arrival time, smoothed delay>
+	std::deque<std::pair<double, double>> _delay_history;
+	double _prev_trend = 0.0;
+
+	// Overuse detector
+	double _threshold = 12.5;
+	int64_t _last_threshold_update_ms = -1;
+	double _time_over_using_ms = -1.0;
+	int _overuse_counter = 0;
+	BandwidthUsage _bandwidth_usage = BandwidthUsage::Normal;
+
+	// AIMD rate control
+	RateControlState _rate_control_state = RateControlState::Hold;
+	int64_t _delay_based_bitrate_bps = 0;
+	int64_t _last_rate_update_ms = -1;
+	int64_t _last_decrease_ms = -1;
+
+	// Loss-based
+	int64_t _loss_based_bitrate_bps = 0;
+	size_t _lost_packets_since_update = 0;
+	size_t _packets_since_update = 0;
+	int64_t _last_loss_decrease_ms = -1;
+	double _loss_ratio = 0.0;
+
+	// Acked bitrate
+	// <arrival time, size>
+	std::deque<std::pair<int64_t, size_t>> _acked_history;
+	size_t _acked_history_bytes = 0;
+	int64_t _acked_bitrate_bps = 0;
+};
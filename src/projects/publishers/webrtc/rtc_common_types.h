@@ -12,6 +12,34 @@
 
 #define MAX_RTP_RECORDS 1500
 
+// Maximum number of SRTP packets collected before they are sent with a single syscall
+#define MAX_EGRESS_BATCH_PACKETS 16
+// Size reserved for each packet in the egress batch buffer (RTP packet + SRTP auth tag)
+#define EGRESS_BATCH_PACKET_SIZE 1500
+
+// Send-side bandwidth estimation (BandwidthEstimation: TransportCC)
+#define RTC_BWE_MIN_BITRATE 50000
+#define RTC_BWE_MAX_BITRATE 50000000
+#define RTC_BWE_START_BITRATE 1000000
+// The packets are sent faster than the estimate so that the pacer doesn't add delay to the frames
+#define RTC_PACING_FACTOR 2.5
+// Interval at which the queued packets are sent
+#define RTC_PACER_INTERVAL_MS 5
+// Maximum size of a burst, in time at the pacing rate
+#define RTC_PACER_MAX_BURST_MS 10
+// Maximum time a packet waits in the queue of the pacer
+#define RTC_PACER_MAX_QUEUE_TIME_MS 500
+
+// NACK storm protection (per session)
+// A packet is not retransmitted again within this time, the previous retransmission may still be in flight
+#define RTC_RTX_MIN_RESEND_INTERVAL_MS 100
+// Retransmissions are limited to this ratio of the estimated bandwidth
+#define RTC_RTX_MAX_BANDWIDTH_RATIO 0.5
+// Limit of the retransmission bitrate until the bandwidth is estimated
+#define RTC_RTX_DEFAULT_MAX_BITRATE 2000000
+// Maximum size of a burst of retransmissions, in time at the limited bitrate
+#define RTC_RTX_MAX_BURST_MS 250
+
 // https://tools.ietf.org/html/rfc5761#section-4
 // - payload type values in the range 64-95 MUST NOT be used
 // - dynamic RTP payload types SHOULD be chosen in the range 96-127 where possible
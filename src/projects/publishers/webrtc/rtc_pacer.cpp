@@ -0,0 +1,110 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtc_pacer.h"
+
+#include <algorithm>
+
+#include "rtc_common_types.h"
+#include "rtc_private.h"
+
+void RtcPacer::SetPacingRate(int64_t pacing_rate_bps)
+{
+	_pacing_rate_bps = pacing_rate_bps;
+}
+
+int64_t RtcPacer::GetPacingRate() const
+{
+	return _pacing_rate_bps;
+}
+
+void RtcPacer::Enqueue(const Packet &packet)
+{
+	_queue.push_back(packet);
+	_queued_bytes += packet.rtp_packet->GetDataLength();
+}
+
+bool RtcPacer::Dequeue(int64_t now_ms, Packet &packet)
+{
+	if (_queue.empty())
+	{
+		return false;
+	}
+
+	UpdateBudget(now_ms);
+
+	if (_budget_bytes <= 0)
+	{
+		return false;
+	}
+
+	packet = std::move(_queue.front());
+	_queue.pop_front();
+
+	auto length = packet.rtp_packet->GetDataLength();
+	_queued_bytes -= length;
+	_budget_bytes -= length;
+
+	return true;
+}
+
+void RtcPacer::Consume(size_t bytes)
+{
+	_budget_bytes -= bytes;
+
+	// Don't fall behind too much because of the packets sent without the queue
+	_budget_bytes = std::max<int64_t>(_budget_bytes, -(GetEffectiveRate() * RTC_PACER_MAX_BURST_MS / 8000));
+}
+
+bool RtcPacer::IsEmpty() const
+{
+	return _queue.empty();
+}
+
+size_t RtcPacer::GetQueuedBytes() const
+{
+	return _queued_bytes;
+}
+
+void RtcPacer::Clear()
+{
+	_queue.clear();
+	_queued_bytes = 0;
+}
+
+void RtcPacer::UpdateBudget(int64_t now_ms)
+{
+	if (_last_update_ms < 0)
+	{
+		_last_update_ms = now_ms;
+		_budget_bytes = EGRESS_BATCH_PACKET_SIZE;
+		return;
+	}
+
+	auto elapsed_ms = now_ms - _last_update_ms;
+	if (elapsed_ms <= 0)
+	{
+		return;
+	}
+
+	_last_update_ms = now_ms;
+
+	auto rate_bps = GetEffectiveRate();
+
+	// The budget is not accumulated while the pacer is idle, so a burst is limited to RTC_PACER_MAX_BURST_MS
+	auto max_budget_bytes = std::max<int64_t>(rate_bps * RTC_PACER_MAX_BURST_MS / 8000, EGRESS_BATCH_PACKET_SIZE);
+	_budget_bytes = std::min(_budget_bytes + (rate_bps * elapsed_ms / 8000), max_budget_bytes);
+}
+
+int64_t RtcPacer::GetEffectiveRate() const
+{
+	// If the estimate is too low for the stream, the queue would grow indefinitely.
+	// The rate is raised to drain the queue within RTC_PACER_MAX_QUEUE_TIME_MS, the estimator sees the congestion instead.
+	auto drain_rate_bps = static_cast<int64_t>(_queued_bytes) * 8000 / RTC_PACER_MAX_QUEUE_TIME_MS;
+
+	return std::max(_pacing_rate_bps, drain_rate_bps);
+}
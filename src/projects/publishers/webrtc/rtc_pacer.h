@@ -0,0 +1,58 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <modules/rtp_rtcp/rtp_packet.h>
+
+#include <deque>
+
+// Token bucket that spreads the packets of a frame (especially a keyframe) over time
+// instead of sending them in a single burst.
+//
+// It is not thread-safe, the owner must serialize the calls.
+class RtcPacer
+{
+public:
+	// The packet of the stream is queued instead of a copy, the header fields of the session are written when it is sent
+	struct Packet
+	{
+		// Shared by all sessions, must not be modified
+		std::shared_ptr<const RtpPacket> rtp_packet;
+		uint16_t sequence_number = 0;
+		uint16_t wide_sequence_number = 0;
+	};
+
+	void SetPacingRate(int64_t pacing_rate_bps);
+	int64_t GetPacingRate() const;
+
+	void Enqueue(const Packet &packet);
+	// Returns false if the budget is exhausted or there is no packet in the queue
+	bool Dequeue(int64_t now_ms, Packet &packet);
+
+	// Packets sent without the queue (audio, retransmission) consume the budget too
+	void Consume(size_t bytes);
+
+	bool IsEmpty() const;
+	size_t GetQueuedBytes() const;
+
+	void Clear();
+
+private:
+	void UpdateBudget(int64_t now_ms);
+	int64_t GetEffectiveRate() const;
+
+	int64_t _pacing_rate_bps = 0;
+
+	// Can be negative, a packet is sent if there is any budget left
+	int64_t _budget_bytes = 0;
+	int64_t _last_update_ms = -1;
+
+	std::deque<Packet> _queue;
+	size_t _queued_bytes = 0;
+};
@@ -59,6 +59,9 @@ RtcSession::RtcSession(const info::Session &session_info,
 	_ice_session_id = ice_session_id;
 	_ws_session		= ws_session;
 	_file_name		= file_name;
+
+	_egress_batch	= std::make_shared<ov::Data>(MAX_EGRESS_BATCH_PACKETS * EGRESS_BATCH_PACKET_SIZE);
+	_egress_batch_segment_lengths.reserve(MAX_EGRESS_BATCH_PACKETS);
 }
 
 RtcSession::~RtcSession()
@@ -95,6 +98,8 @@ bool RtcSession::Start()
 
 	_rtp_rtcp									= std::make_shared<RtpRtcp>(RtpRtcpInterface::GetSharedPtr());
 	_srtp_transport								= std::make_shared<SrtpTransport>();
+	// All RTP/RTCP packets of the session are sent under _egress_batch_lock
+	_srtp_transport->SetSendContextConfined(true);
 
 	_dtls_transport								= std::make_shared<DtlsTransport>();
 	std::shared_ptr<RtcApplication> application = std::static_pointer_cast<RtcApplication>(GetApplication());
@@ -116,6 +121,11 @@ bool RtcSession::Start()
 			return false;
 		}
 
+		if (first_payload->IsRtcpFbEnabled(PayloadAttr::RtcpFbType::TransportCc))
+		{
+			_transport_cc_enabled = true;
+		}
+
 		if (peer_media_desc->GetMediaType() == MediaDescription::MediaType::Audio)
 		{
 			_audio_payload_type = first_payload->GetId();
@@ -162,6 +172,13 @@ bool RtcSession::Start()
 	_current_rendition = _playlist->GetFirstRendition();
 	RecordAutoSelectedRendition(_current_rendition, true);
 
+	if (_transport_cc_enabled == true)
+	{
+		// The estimate starts from the bitrate of the first rendition and converges from there
+		auto start_bitrate	 = std::max<int64_t>(static_cast<int64_t>(_current_rendition->GetBitrates()), RTC_BWE_START_BITRATE);
+		_bandwidth_estimator = std::make_shared<RtcBandwidthEstimator>(start_bitrate, RTC_BWE_MIN_BITRATE, RTC_BWE_MAX_BITRATE);
+	}
+
 	auto current_video_track = _current_rendition->GetVideoTrack();
 	auto current_audio_track = _current_rendition->GetAudioTrack();
 
@@ -228,6 +245,11 @@ bool RtcSession::Stop()
 
 	ov::Node::Stop();
 
+	{
+		std::lock_guard<std::mutex> egress_lock(_egress_batch_lock);
+		_pacer.Clear();
+	}
+
 	return Session::Stop();
 }
 
@@ -524,38 +546,113 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	// RTP Session must be copied and sent because data is altered due to SRTP.
-	auto copy_packet = std::make_shared<RtpPacket>(*session_packet);
+	// The packet is shared by all sessions, only the header fields of this session are written
+	// when it is assembled in the egress batch (see StageRtpPacket())
+	RtcPacer::Packet egress_packet;
+	egress_packet.rtp_packet		   = session_packet;
+	egress_packet.sequence_number	   = session_packet->IsVideoPacket() ? _video_rtp_sequence_number++ : _audio_rtp_sequence_number++;
+	egress_packet.wide_sequence_number = _wide_sequence_number;
 
-	if (copy_packet->IsVideoPacket())
+	// rtp_rtcp(RTCP) -> srtp -> dtls -> Edge Node(RtcSession)
 	{
-		copy_packet->SetSequenceNumber(_video_rtp_sequence_number++);
+		std::lock_guard<std::mutex> egress_lock(_egress_batch_lock);
+		_egress_batch_owner = std::this_thread::get_id();
+
+		_rtp_rtcp->UpdateSenderReport(session_packet);
+
+		auto now_ms = ov::Clock::NowMSec();
+
+		if ((_pacing_rate_bps > 0) && session_packet->IsVideoPacket())
+		{
+			_pacer.Enqueue(egress_packet);
+		}
+		else
+		{
+			if (_pacing_rate_bps > 0)
+			{
+				_pacer.Consume(session_packet->GetDataLength());
+			}
+
+			// Packet loss simulation codes
+			// if (ov::Random::GenerateUInt32(1, 33) != 10)
+			{
+				StageRtpPacket(egress_packet, now_ms);
+			}
+		}
+
+		_egress_batch_owner = std::thread::id();
+
+		// Send the collected packets when the frame is completed
+		if ((session_packet->IsVideoPacket() == false) || session_packet->Marker())
+		{
+			SendPacedPackets(now_ms);
+			FlushEgressBatch();
+		}
 	}
-	else
+
+	RecordRtpSent(session_packet, egress_packet.sequence_number, _wide_sequence_number);
+
+	_wide_sequence_number++;
+
+	MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, session_packet->GetDataLength());
+}
+
+uint8_t *RtcSession::AppendEgressRtpPacket(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t sequence_number, size_t &offset)
+{
+	if ((_egress_batch_segment_lengths.size() >= MAX_EGRESS_BATCH_PACKETS) ||
+		((_egress_batch->GetLength() + rtp_packet->GetDataLength() + SRTP_MAX_TRAILER_LEN) > _egress_batch->GetCapacity()))
 	{
-		copy_packet->SetSequenceNumber(_audio_rtp_sequence_number++);
+		FlushEgressBatch();
 	}
 
-	// Set transport-wide sequence number
-	SetTransportWideSequenceNumber(copy_packet, _wide_sequence_number);
-	SetAbsSendTime(copy_packet, ov::Clock::NowMSec());
+	offset = _egress_batch->GetLength();
+
+	// This is the only copy of the packet for this session, it is encrypted in place right after
+	_egress_batch->Append(rtp_packet->GetData());
+
+	auto header = _egress_batch->GetWritableDataAs<uint8_t>() + offset;
+	ByteWriter<uint16_t>::WriteBigEndian(header + 2, sequence_number);
 
-	// rtp_rtcp -> srtp -> dtls -> Edge Node(RtcSession)
+	return header;
+}
 
-	// Packet loss simulation codes
-	// if (ov::Random::GenerateUInt32(1, 33) != 10)
+bool RtcSession::ProtectEgressRtpPacket(size_t offset)
+{
+	if (_srtp_transport->ProtectRtp(_egress_batch, offset) == false)
 	{
-		_rtp_rtcp->SendRtpPacket(copy_packet);
+		// Drop the packet
+		_egress_batch->SetLength(offset);
+		return false;
 	}
 
-	RecordRtpSent(copy_packet, session_packet->SequenceNumber(), _wide_sequence_number);
+	_egress_batch_segment_lengths.push_back(_egress_batch->GetLength() - offset);
 
-	_wide_sequence_number++;
+	return true;
+}
+
+bool RtcSession::StageRtpPacket(const RtcPacer::Packet &packet, int64_t now_ms)
+{
+	size_t offset = 0;
+	auto header = AppendEgressRtpPacket(packet.rtp_packet, packet.sequence_number, offset);
 
-	MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, copy_packet->GetDataLength());
+	SetTransportWideSequenceNumber(packet.rtp_packet, header, packet.wide_sequence_number);
+	SetAbsSendTime(packet.rtp_packet, header, now_ms);
+
+	return ProtectEgressRtpPacket(offset);
+}
+
+bool RtcSession::StageRtxPacket(const std::shared_ptr<const RtxRtpPacket> &rtx_packet, uint16_t sequence_number, uint16_t original_sequence_number)
+{
+	size_t offset = 0;
+	auto header = AppendEgressRtpPacket(rtx_packet, sequence_number, offset);
+
+	// OSN is placed right before the original payload
+	ByteWriter<uint16_t>::WriteBigEndian(header + rtx_packet->HeadersSize() - RTX_HEADER_SIZE, original_sequence_number);
+
+	return ProtectEgressRtpPacket(offset);
 }
 
-bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number)
+bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *header, uint16_t wide_sequence_number)
 {
 	auto extension_buffer = rtp_packet->Extension(RTP_HEADER_EXTENSION_TRANSPORT_CC_ID);
 	if (extension_buffer == nullptr)
@@ -563,14 +660,16 @@ bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket>
 		return false;
 	}
 
-	auto payload_offset = rtp_packet->GetExtensionType() == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER ? 1 : 2;
+	// The extension is at the same offset in the header assembled for this session
+	auto extension_offset = extension_buffer - rtp_packet->Header();
+	auto payload_offset	  = rtp_packet->GetExtensionType() == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER ? 1 : 2;
 
-	ByteWriter<uint16_t>::WriteBigEndian(extension_buffer + payload_offset, wide_sequence_number);
+	ByteWriter<uint16_t>::WriteBigEndian(header + extension_offset + payload_offset, wide_sequence_number);
 
 	return true;
 }
 
-bool RtcSession::SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms)
+bool RtcSession::SetAbsSendTime(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *header, uint64_t time_ms)
 {
 	auto extension_buffer = rtp_packet->Extension(RTP_HEADER_EXTENSION_ABS_SEND_TIME_ID);
 	if (extension_buffer == nullptr)
@@ -578,15 +677,16 @@ bool RtcSession::SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, ui
 		return false;
 	}
 
-	auto payload_offset = rtp_packet->GetExtensionType() == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER ? 1 : 2;
+	auto extension_offset = extension_buffer - rtp_packet->Header();
+	auto payload_offset	  = rtp_packet->GetExtensionType() == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER ? 1 : 2;
 
-	auto abs_send_time	= RtpHeaderExtensionAbsSendTime::MsToAbsSendTime(time_ms);
-	ByteWriter<uint24_t>::WriteBigEndian(extension_buffer + payload_offset, abs_send_time);
+	auto abs_send_time	  = RtpHeaderExtensionAbsSendTime::MsToAbsSendTime(time_ms);
+	ByteWriter<uint24_t>::WriteBigEndian(header + extension_offset + payload_offset, abs_send_time);
 
 	return true;
 }
 
-bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number)
+bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t sequence_number, uint16_t wide_sequence_number)
 {
 	if (rtp_packet == nullptr)
 	{
@@ -594,11 +694,11 @@ bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packe
 	}
 
 	auto sent_log					  = std::make_shared<RtpSentLog>();
-	sent_log->_sequence_number		  = rtp_packet->SequenceNumber();
+	sent_log->_sequence_number		  = sequence_number;
 	sent_log->_wide_sequence_number	  = wide_sequence_number;
 	sent_log->_track_id				  = rtp_packet->GetTrackId();
 	sent_log->_payload_type			  = rtp_packet->PayloadType();
-	sent_log->_origin_sequence_number = origin_sequence_number;
+	sent_log->_origin_sequence_number = rtp_packet->SequenceNumber();
 	sent_log->_timestamp			  = rtp_packet->Timestamp();
 	sent_log->_marker				  = rtp_packet->Marker();
 	sent_log->_ssrc					  = rtp_packet->Ssrc();
@@ -626,8 +726,9 @@ std::shared_ptr<RtcSession::RtpSentLog> RtcSession::TraceRtpSentByVideoSeqNo(uin
 
 	auto key = sequence_number % MAX_RTP_RECORDS;
 	auto it	 = _video_rtp_sent_record_map.find(key);
-	if (it == _video_rtp_sent_record_map.end())
+	if ((it == _video_rtp_sent_record_map.end()) || (it->second->_sequence_number != sequence_number))
 	{
+		// Not sent or already overwritten by a newer packet
 		return nullptr;
 	}
 
@@ -649,6 +750,22 @@ std::shared_ptr<RtcSession::RtpSentLog> RtcSession::TraceRtpSentByWideSeqNo(uint
 	return it->second;
 }
 
+bool RtcSession::UpdateRtpSentTime(uint16_t wide_sequence_number, const std::chrono::system_clock::time_point &sent_time)
+{
+	std::lock_guard<std::shared_mutex> lock(_rtp_record_map_lock);
+
+	auto it = _wide_rtp_sent_record_map.find(wide_sequence_number % MAX_RTP_RECORDS);
+	if ((it == _wide_rtp_sent_record_map.end()) || (it->second->_wide_sequence_number != wide_sequence_number))
+	{
+		// Not recorded yet, it will be recorded with the current time
+		return false;
+	}
+
+	it->second->_sent_time = sent_time;
+
+	return true;
+}
+
 void RtcSession::OnRtpFrameReceived(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets)
 {
 	// No player sends RTP packet
@@ -724,6 +841,12 @@ bool RtcSession::ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info)
 		return false;
 	}
 
+	// The SRTP send context is used by one thread at a time
+	std::lock_guard<std::mutex> egress_lock(_egress_batch_lock);
+	_egress_batch_owner = std::this_thread::get_id();
+
+	auto now_ms = ov::Clock::NowMSec();
+
 	// Retransmission
 	for (size_t i = 0; i < nack->GetLostIdCount(); i++)
 	{
@@ -737,14 +860,63 @@ bool RtcSession::ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info)
 		logtd("RTX requested(%d) - TrackID(%u) PayloadType(%d) OriginSeqNo(%u)", seq_no, sent_log->_track_id, sent_log->_payload_type, sent_log->_origin_sequence_number);
 
 		auto rtx_packet = stream->GetRtxRtpPacket(sent_log->_track_id, sent_log->_payload_type, sent_log->_origin_sequence_number);
-		if (rtx_packet != nullptr)
+		if (rtx_packet == nullptr)
+		{
+			continue;
+		}
+
+		if (AllowRetransmission(sent_log, rtx_packet->GetDataLength(), now_ms) == false)
+		{
+			continue;
+		}
+
+		_rtp_rtcp->UpdateSenderReport(rtx_packet);
+
+		if (_pacing_rate_bps > 0)
 		{
-			auto copy_rtx_packet = std::make_shared<RtxRtpPacket>(*rtx_packet);
-			copy_rtx_packet->SetSequenceNumber(_rtx_sequence_number++);
-			copy_rtx_packet->SetOriginalSequenceNumber(sent_log->_sequence_number);
-			return _rtp_rtcp->SendRtpPacket(copy_rtx_packet);
+			_pacer.Consume(rtx_packet->GetDataLength());
 		}
+
+		// The RTX packet of the stream is shared too, the sequence number and OSN of this session are written
+		StageRtxPacket(rtx_packet, _rtx_sequence_number++, sent_log->_sequence_number);
+	}
+
+	_egress_batch_owner = std::thread::id();
+
+	return FlushEgressBatch();
+}
+
+bool RtcSession::AllowRetransmission(const std::shared_ptr<RtpSentLog> &sent_log, size_t bytes, int64_t now_ms)
+{
+	// The same packet is requested repeatedly while the retransmission is in flight (or lost again)
+	if ((sent_log->_retransmitted_time_ms >= 0) && ((now_ms - sent_log->_retransmitted_time_ms) < RTC_RTX_MIN_RESEND_INTERVAL_MS))
+	{
+		logtd("RTX is ignored - seqno(%u) was retransmitted %lld ms ago", sent_log->_sequence_number, now_ms - sent_log->_retransmitted_time_ms);
+		return false;
+	}
+
+	// Retransmissions must not take the bandwidth of the media when the network is congested
+	auto rate_bps = (_estimated_bitrates > 0) ? static_cast<int64_t>(_estimated_bitrates * RTC_RTX_MAX_BANDWIDTH_RATIO) : RTC_RTX_DEFAULT_MAX_BITRATE;
+	auto max_budget_bytes = rate_bps * RTC_RTX_MAX_BURST_MS / 8000;
+
+	if (_rtx_budget_updated_ms < 0)
+	{
+		_rtx_budget_bytes = max_budget_bytes;
+	}
+	else
+	{
+		_rtx_budget_bytes = std::min(_rtx_budget_bytes + (rate_bps * (now_ms - _rtx_budget_updated_ms) / 8000), max_budget_bytes);
 	}
+	_rtx_budget_updated_ms = now_ms;
+
+	if (_rtx_budget_bytes < static_cast<int64_t>(bytes))
+	{
+		logtd("RTX is ignored - seqno(%u), the retransmission bitrate exceeds %lld bps", sent_log->_sequence_number, rate_bps);
+		return false;
+	}
+
+	_rtx_budget_bytes -= bytes;
+	sent_log->_retransmitted_time_ms = now_ms;
 
 	return true;
 }
@@ -759,76 +931,69 @@ bool RtcSession::ProcessTransportCc(const std::shared_ptr<RtcpInfo> &rtcp_info)
 		return false;
 	}
 
-	uint64_t sent_bytes	  = 0;
-	int64_t sent_duration = 0;
-
-	// For debug
-	// logtd("TransportCC - SenderSsrc(%u) MediaSsrc(%u) PacketStatusCount(%u)", transport_cc->GetSenderSsrc(), transport_cc->GetMediaSsrc(), transport_cc->GetPacketStatusCount());
+	if (_bandwidth_estimator == nullptr)
+	{
+		// TransportCC is not negotiated
+		return true;
+	}
 
-	// for (size_t i = 0; i < transport_cc->GetPacketStatusCount(); i++)
-	// {
-	// 	auto packet_status = transport_cc->GetPacketFeedbackInfo(i);
-	// 	auto sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number);
-	// 	if (sent_log == nullptr)
-	// 	{
-	// 		logte("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
-	// 		continue;
-	// 	}
-
-	// 	logtd("%s", sent_log->ToString().CStr());
-	// }
+	std::vector<RtcBandwidthEstimator::PacketResult> results;
+	results.reserve(transport_cc->GetPacketStatusCount());
 
-	// return true;
+	// Reference time is in multiples of 64ms, receive deltas are in multiples of 250us
+	int64_t arrival_time_us = static_cast<int64_t>(transport_cc->GetReferenceTime()) * 64000;
 
-	for (size_t i = 1; i < transport_cc->GetPacketStatusCount(); i++)
 	{
-		auto packet_status = transport_cc->GetPacketFeedbackInfo(i);
-		auto sent_log	   = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number);
-		if (sent_log == nullptr)
-		{
-			logte("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
-			continue;
-		}
-		auto prev_sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number - 1);
-		if (prev_sent_log == nullptr)
+		std::shared_lock<std::shared_mutex> lock(_rtp_record_map_lock);
+
+		for (const auto &packet_status : transport_cc->GetPacketFeedbacks())
 		{
-			logtd("TransportCC - No prev sent log found for seqno(%u)", packet_status->_wide_sequence_number - 1);
-			continue;
-		}
+			if (packet_status->_received)
+			{
+				arrival_time_us += static_cast<int64_t>(packet_status->_received_delta) * 250;
+			}
 
-		// Calc delta of sent_log and prev_sent_log
-		int32_t sent_delta_time = (std::chrono::duration_cast<std::chrono::microseconds>(sent_log->_sent_time - prev_sent_log->_sent_time).count()) / 250;
+			auto it = _wide_rtp_sent_record_map.find(packet_status->_wide_sequence_number % MAX_RTP_RECORDS);
+			if ((it == _wide_rtp_sent_record_map.end()) || (it->second->_wide_sequence_number != packet_status->_wide_sequence_number))
+			{
+				logtd("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
+				continue;
+			}
 
-		auto duration			= packet_status->_received_delta - sent_delta_time;
-		if (duration <= 0)
-		{
-			//duration = 1;
-		}
+			auto &sent_log = it->second;
 
-		sent_bytes += sent_log->_sent_bytes;
-		sent_duration += duration;
+			RtcBandwidthEstimator::PacketResult result;
+			result.send_time_us	   = std::chrono::duration_cast<std::chrono::microseconds>(sent_log->_sent_time.time_since_epoch()).count();
+			result.arrival_time_us = packet_status->_received ? arrival_time_us : -1;
+			result.size			   = sent_log->_sent_bytes;
 
-		logtd("WideSeqNo(%u) Refer(%u) RecvDelta(%u) SentDelta(%u) SentBytes(%u) Duration(%d)", packet_status->_wide_sequence_number, transport_cc->GetReferenceTime(), packet_status->_received_delta, sent_delta_time, sent_log->_sent_bytes, duration);
+			results.push_back(result);
+		}
 	}
 
-	if (sent_bytes > 0)
+	_bandwidth_estimator->OnFeedback(ov::Clock::NowMSec(), results);
+
+	if (_bandwidth_estimator->HasEstimate() == false)
 	{
-		double sent_seconds = static_cast<double>(sent_duration) / 4000.0;
+		return true;
+	}
 
-		_total_sent_seconds += sent_seconds;
-		_total_sent_bytes += sent_bytes;
-		_estimated_bitrates = static_cast<double>((_total_sent_bytes * 8)) / _total_sent_seconds;
+	auto estimated_bitrate = _bandwidth_estimator->GetEstimatedBitrate();
 
-		if (_bitrate_estimate_watch.IsElapsed(1000) == true)
-		{
-			_bitrate_estimate_watch.Update();
-			ChangeRenditionIfNeeded();
+	_estimated_bitrates	   = static_cast<double>(estimated_bitrate);
+	_pacing_rate_bps	   = static_cast<int64_t>(estimated_bitrate * RTC_PACING_FACTOR);
 
-			logtd("Estimated Bandwidth(%f) TotalSentBytes(%u) TotalSentSeconds(%f)", static_cast<double>(_total_sent_bytes * 8) / _total_sent_seconds, _total_sent_bytes, _total_sent_seconds);
+	if (_bitrate_estimate_watch.IsElapsed(1000) == true)
+	{
+		_bitrate_estimate_watch.Update();
 
-			_total_sent_seconds = 0;
-			_total_sent_bytes	= 0;
-		}
+		logtd("Estimated Bandwidth(%lld) AckedBitrate(%lld) Loss(%.2f%%) Usage(%d)",
+			  estimated_bitrate, _bandwidth_estimator->GetAckedBitrate(), _bandwidth_estimator->GetLossRatio() * 100.0,
+			  static_cast<int>(_bandwidth_estimator->GetBandwidthUsage()));
+
+		ChangeRenditionIfNeeded();
+
+		_previous_estimated_bitrate = _estimated_bitrates;
 	}
 
 	return true;
@@ -989,9 +1154,100 @@ bool RtcSession::OnDataReceivedFromPrevNode(NodeType from_node, const std::share
 		return false;
 	}
 
+	if (_egress_batch_owner.load() == std::this_thread::get_id())
+	{
+		// RTCP generated while the session is sending, _egress_batch_lock is already held
+		if (_pacing_rate_bps > 0)
+		{
+			_pacer.Consume(data->GetLength());
+		}
+
+		return StageEgressPacket(data);
+	}
+
 	return _ice_port->Send(_ice_session_id, data);
 }
 
+bool RtcSession::StageEgressPacket(const std::shared_ptr<const ov::Data> &data)
+{
+	if ((_egress_batch_segment_lengths.size() >= MAX_EGRESS_BATCH_PACKETS) ||
+		((_egress_batch->GetLength() + data->GetLength()) > _egress_batch->GetCapacity()))
+	{
+		FlushEgressBatch();
+	}
+
+	if (data->GetLength() > _egress_batch->GetCapacity())
+	{
+		// Too big to be batched
+		return _ice_port->Send(_ice_session_id, data);
+	}
+
+	_egress_batch->Append(data);
+	_egress_batch_segment_lengths.push_back(data->GetLength());
+
+	return true;
+}
+
+bool RtcSession::FlushEgressBatch()
+{
+	if (_egress_batch_segment_lengths.empty())
+	{
+		return true;
+	}
+
+	// A single packet is sent through SendBatch() too: it is sent straight from the batch buffer, while Send() clones it
+	auto result = _ice_port->SendBatch(_ice_session_id, _egress_batch, _egress_batch_segment_lengths);
+
+	// The buffer is reused if the socket doesn't hold it anymore (otherwise, it is copied on write)
+	_egress_batch->SetLength(0);
+	_egress_batch_segment_lengths.clear();
+
+	return result;
+}
+
+bool RtcSession::IsPacingEnabled() const
+{
+	return _bandwidth_estimator != nullptr;
+}
+
+void RtcSession::ProcessPacer()
+{
+	if (pub::Session::GetState() != SessionState::Started)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> egress_lock(_egress_batch_lock);
+
+	if (_pacer.IsEmpty())
+	{
+		return;
+	}
+
+	SendPacedPackets(ov::Clock::NowMSec());
+	FlushEgressBatch();
+}
+
+void RtcSession::SendPacedPackets(int64_t now_ms)
+{
+	if (_pacer.IsEmpty())
+	{
+		return;
+	}
+
+	_pacer.SetPacingRate(_pacing_rate_bps);
+
+	// The delay-based estimation uses the time when the packet is actually sent
+	auto sent_time = std::chrono::system_clock::now();
+
+	RtcPacer::Packet packet;
+	while (_pacer.Dequeue(now_ms, packet))
+	{
+		StageRtpPacket(packet, now_ms);
+		UpdateRtpSentTime(packet.wide_sequence_number, sent_time);
+	}
+}
+
 // RtcSession Node has not a lower node so it will not be called
 bool RtcSession::OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data)
 {
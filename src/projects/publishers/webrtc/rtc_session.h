@@ -10,6 +10,7 @@
 #include <modules/http/server/web_socket/web_socket_session.h>
 #include <monitoring/monitoring.h>
 
+#include <thread>
 #include <unordered_set>
 
 #include "base/info/media_track.h"
@@ -18,7 +19,10 @@
 #include "modules/ice/ice_port.h"
 #include "modules/rtp_rtcp/rtp_packetizer_interface.h"
 #include "modules/rtp_rtcp/rtp_rtcp.h"
+#include "modules/rtp_rtcp/rtx_rtp_packet.h"
 #include "modules/sdp/session_description.h"
+#include "rtc_bandwidth_estimator.h"
+#include "rtc_pacer.h"
 #include "rtc_playlist.h"
 
 /*	Node Connection
@@ -97,6 +101,11 @@ public:
 		return _ice_session_id;
 	}
 
+	// true if the peer sends TransportCC feedback, the packets are paced using the estimated bandwidth
+	bool IsPacingEnabled() const;
+	// Called periodically (RTC_PACER_INTERVAL_MS) to send the packets queued in the pacer
+	void ProcessPacer();
+
 private:
 	bool ProcessReceiverReport(const std::shared_ptr<RtcpInfo> &rtcp_info);
 	bool ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info);
@@ -108,6 +117,24 @@ private:
 
 	void ChangeRendition();
 
+	// Batched egress
+	// SRTP packets produced while SendOutgoingData() is running are collected in one contiguous buffer
+	// and sent with a single syscall when a frame is completed (or the buffer is full).
+	bool StageEgressPacket(const std::shared_ptr<const ov::Data> &data);
+	bool FlushEgressBatch();
+
+	// RTP packets of the stream are shared by all sessions and never copied per session.
+	// The packet is assembled directly in the egress batch with the header fields of this session,
+	// then protected in place, so the payload is copied once (into the buffer that SRTP encrypts).
+	bool StageRtpPacket(const RtcPacer::Packet &packet, int64_t now_ms);
+	bool StageRtxPacket(const std::shared_ptr<const RtxRtpPacket> &rtx_packet, uint16_t sequence_number, uint16_t original_sequence_number);
+	// Returns the header of the packet in the batch, offset is set to the position of the packet
+	uint8_t *AppendEgressRtpPacket(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t sequence_number, size_t &offset);
+	// The packet is removed from the batch if it could not be protected
+	bool ProtectEgressRtpPacket(size_t offset);
+	// Moves the packets allowed by the pacer to the egress batch, _egress_batch_lock must be held
+	void SendPacedPackets(int64_t now_ms);
+
 	bool SendPlaylistInfo(const std::shared_ptr<const RtcPlaylist> &playlist) const;
 	bool SendRenditionChanged(const std::shared_ptr<const RtcRendition> &rendition) const;
 
@@ -134,6 +161,24 @@ private:
 	uint16_t _rtx_sequence_number  = 1;
 	uint64_t _session_expired_time = 0;
 
+	// Only the thread holding this lock (_egress_batch_owner) stages packets in the batch.
+	// Packets sent through the nodes by other threads (DTLS) bypass the batch.
+	// RTP/RTCP packets are always sent under this lock, so the SRTP send context is confined to one thread at a time.
+	std::mutex _egress_batch_lock;
+	std::atomic<std::thread::id> _egress_batch_owner{std::thread::id()};
+	std::shared_ptr<ov::Data> _egress_batch;
+	std::vector<size_t> _egress_batch_segment_lengths;
+
+	// Pacing, guarded by _egress_batch_lock
+	// Video packets are queued in the pacer, audio packets are sent immediately.
+	RtcPacer _pacer;
+
+	// NACK storm protection (see AllowRetransmission()), guarded by _egress_batch_lock
+	int64_t _rtx_budget_bytes		= 0;
+	int64_t _rtx_budget_updated_ms	= -1;
+	// 0 until the first estimate is made (pacing is not active)
+	std::atomic<int64_t> _pacing_rate_bps{0};
+
 	std::shared_mutex _start_stop_lock;
 
 	// For ABR
@@ -167,6 +212,9 @@ private:
 		uint32_t _sent_bytes			 = 0;
 		std::chrono::system_clock::time_point _sent_time;
 
+		// Last time the packet was retransmitted, guarded by _egress_batch_lock
+		int64_t _retransmitted_time_ms	 = -1;
+
 		ov::String ToString()
 		{
 			return ov::String::FormatString("WideSeq(%d) SSRC(%u) Seq(%d) Track(%d) PT(%d) Timestamp(%u) Marker(%s) OriginSeq(%d) SentBytes(%u)",
@@ -174,7 +222,8 @@ private:
 		}
 	};
 
-	bool RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number);
+	// rtp_packet is the packet of the stream, its sequence number is the origin sequence number
+	bool RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t sequence_number, uint16_t wide_sequence_number);
 
 	std::shared_mutex _rtp_record_map_lock;
 	// For NACK
@@ -186,13 +235,19 @@ private:
 
 	std::shared_ptr<RtpSentLog> TraceRtpSentByVideoSeqNo(uint16_t sequence_number);
 	std::shared_ptr<RtpSentLog> TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number);
+	// Returns false if the retransmission of the packet is not allowed (recently retransmitted, or over the RTX budget)
+	bool AllowRetransmission(const std::shared_ptr<RtpSentLog> &sent_log, size_t bytes, int64_t now_ms);
+	// Updates the sent time of the packet delayed by the pacer
+	bool UpdateRtpSentTime(uint16_t wide_sequence_number, const std::chrono::system_clock::time_point &sent_time);
 
-	bool SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number);
-	bool SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms);
+	// Write the extension in the header assembled from rtp_packet
+	bool SetTransportWideSequenceNumber(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *header, uint16_t wide_sequence_number);
+	bool SetAbsSendTime(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *header, uint64_t time_ms);
 
 	// For Estimated bitrate
-	double _total_sent_seconds = 0;
-	uint64_t _total_sent_bytes = 0;
+	bool _transport_cc_enabled = false;
+	// Send-side estimation using TransportCC feedback, nullptr if TransportCC is not negotiated
+	std::shared_ptr<RtcBandwidthEstimator> _bandwidth_estimator;
 	double _estimated_bitrates = 0;
 	ov::StopWatch _bitrate_estimate_watch;
 
@@ -974,7 +974,7 @@ std::shared_ptr<RtpHistory> RtcStream::GetHistory(uint32_t track_id, uint8_t ori
 	return _rtp_history_map[key];
 }
 
-std::shared_ptr<RtxRtpPacket> RtcStream::GetRtxRtpPacket(uint32_t track_id, uint8_t origin_payload_type, uint16_t origin_sequence_number)
+std::shared_ptr<const RtxRtpPacket> RtcStream::GetRtxRtpPacket(uint32_t track_id, uint8_t origin_payload_type, uint16_t origin_sequence_number)
 {
 	if (GetState() != State::STARTED)
 	{
@@ -13,6 +13,7 @@
 #include <utility>
 
 #include "config/config_manager.h"
+#include "rtc_common_types.h"
 #include "rtc_private.h"
 #include "rtc_session.h"
 #include "rtc_stream.h"
@@ -109,6 +110,14 @@ bool WebRtcPublisher::Start()
 	if (StartSignallingServer(server_config, webrtc_bind_config) &&
 		StartICEPorts(server_config, webrtc_bind_config))
 	{
+		_pacer_timer.Push(
+			[this](void *parameter) -> ov::DelayQueueAction {
+				ProcessPacers();
+				return ov::DelayQueueAction::Repeat;
+			},
+			RTC_PACER_INTERVAL_MS);
+		_pacer_timer.Start();
+
 		return Publisher::Start();
 	}
 
@@ -126,6 +135,8 @@ bool WebRtcPublisher::Start()
 
 bool WebRtcPublisher::Stop()
 {
+	_pacer_timer.Stop();
+
 	IcePortManager::GetInstance()->Release(IcePortObserver::GetSharedPtr());
 
 	if (_signalling_server != nullptr)
@@ -141,6 +152,7 @@ bool WebRtcPublisher::DisconnectSessionInternal(const std::shared_ptr<RtcSession
 {
 	auto stream = std::dynamic_pointer_cast<RtcStream>(session->GetStream());
 
+	RemovePacedSession(session->GetId());
 	stream->RemoveSession(session->GetId());
 
 	MonitorInstance->OnSessionDisconnected(*stream, PublisherType::Webrtc);
@@ -150,6 +162,53 @@ bool WebRtcPublisher::DisconnectSessionInternal(const std::shared_ptr<RtcSession
 	return true;
 }
 
+void WebRtcPublisher::AddPacedSession(const std::shared_ptr<RtcSession> &session)
+{
+	std::lock_guard<std::mutex> lock(_paced_sessions_lock);
+	_paced_sessions[session->GetId()] = session;
+}
+
+void WebRtcPublisher::RemovePacedSession(session_id_t session_id)
+{
+	std::lock_guard<std::mutex> lock(_paced_sessions_lock);
+	_paced_sessions.erase(session_id);
+}
+
+void WebRtcPublisher::ProcessPacers()
+{
+	std::vector<std::shared_ptr<RtcSession>> sessions;
+
+	{
+		std::lock_guard<std::mutex> lock(_paced_sessions_lock);
+
+		if (_paced_sessions.empty())
+		{
+			return;
+		}
+
+		sessions.reserve(_paced_sessions.size());
+
+		for (auto it = _paced_sessions.begin(); it != _paced_sessions.end();)
+		{
+			auto session = it->second.lock();
+			if (session == nullptr)
+			{
+				// The session has been deleted without being disconnected (e.g. the stream is deleted)
+				it = _paced_sessions.erase(it);
+				continue;
+			}
+
+			sessions.push_back(std::move(session));
+			++it;
+		}
+	}
+
+	for (const auto &session : sessions)
+	{
+		session->ProcessPacer();
+	}
+}
+
 bool WebRtcPublisher::OnCreateHost(const info::Host &host_info)
 {
 	if (_signalling_server != nullptr && host_info.GetCertificate() != nullptr)
@@ -451,6 +510,11 @@ bool WebRtcPublisher::OnAddRemoteDescription(const std::shared_ptr<http::svr::ws
 			return false;
 		}
 
+		if (session->IsPacingEnabled())
+		{
+			AddPacedSession(session);
+		}
+
 		MonitorInstance->OnSessionConnected(*stream, PublisherType::Webrtc);
 
 		auto ice_timeout = application->GetConfig().GetPublishers().GetWebrtcPublisher().GetTimeout();
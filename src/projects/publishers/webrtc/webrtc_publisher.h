@@ -80,6 +80,11 @@ private:
 	bool Start() override;
 	bool DisconnectSessionInternal(const std::shared_ptr<RtcSession> &session);
 
+	// Pacing
+	void AddPacedSession(const std::shared_ptr<RtcSession> &session);
+	void RemovePacedSession(session_id_t session_id);
+	void ProcessPacers();
+
 	//--------------------------------------------------------------------
 	// Implementation of Publisher
 	//--------------------------------------------------------------------
@@ -105,6 +110,11 @@ private:
 	std::shared_ptr<IcePort> _ice_port;
 	std::shared_ptr<RtcSignallingServer> _signalling_server;
 
+	// Sends the packets queued in the pacers of the sessions every RTC_PACER_INTERVAL_MS
+	ov::DelayQueue _pacer_timer{"RtcPacer"};
+	std::map<session_id_t, std::weak_ptr<RtcSession>> _paced_sessions;
+	std::mutex _paced_sessions_lock;
+
 	// for special purpose log - Deprecated
 	// ov::DelayQueue _timer;
 };
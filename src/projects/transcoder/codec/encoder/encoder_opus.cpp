@@ -285,7 +285,7 @@ void EncoderOPUS::CodecThread()
 
 		int64_t duration = _frame_size;
 
-		auto packet_buffer = std::make_shared<MediaPacket>(
+		auto packet_buffer = ov::MakePooledShared<MediaPacket>(
 			0,
 			cmn::MediaType::Audio,
 			0,